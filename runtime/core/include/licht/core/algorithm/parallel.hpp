@@ -0,0 +1,214 @@
+#pragma once
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/containers/array_view.hpp"
+#include "licht/core/defines.hpp"
+#include "licht/core/thread/thread_pool.hpp"
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+namespace licht {
+
+/**
+ * @brief Number of elements handed to a thread at once by the parallel algorithms.
+ * It does not depend on the machine, so `parallel_reduce` gives the same result everywhere.
+ */
+inline constexpr size_t parallel_default_grain_size = 1024;
+
+namespace internal {
+
+inline constexpr size_t parallel_chunk_count(size_t count, size_t grain_size) {
+    grain_size = grain_size == 0 ? 1 : grain_size;
+    return (count + grain_size - 1) / grain_size;
+}
+
+template <typename ElementType, typename Func>
+void parallel_for_each(ElementType* data, size_t count, Func& func, size_t grain_size, ThreadPool& pool);
+
+}  //namespace internal
+
+/**
+ * @brief Calls `func(begin, end)` on consecutive ranges of at most `grain_size` indices covering [0, count),
+ * spread across the threads of `pool`. Returns once every range is done.
+ */
+template <typename Func>
+void parallel_for_chunks(size_t count,
+                         Func&& func,
+                         size_t grain_size = parallel_default_grain_size,
+                         ThreadPool& pool = ThreadPool::get_instance()) {
+    grain_size = grain_size == 0 ? 1 : grain_size;
+    const size_t chunk_count = internal::parallel_chunk_count(count, grain_size);
+
+    pool.run_parallel(chunk_count, [&](size_t chunk) {
+        const size_t begin = chunk * grain_size;
+        const size_t end = std::min(begin + grain_size, count);
+        func(begin, end);
+    });
+}
+
+/**
+ * @brief Calls `func(index)` for every index in [0, count), spread across the threads of `pool`.
+ */
+template <typename Func>
+void parallel_for(size_t count,
+                  Func&& func,
+                  size_t grain_size = parallel_default_grain_size,
+                  ThreadPool& pool = ThreadPool::get_instance()) {
+    parallel_for_chunks(count, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            func(i);
+        }
+    }, grain_size, pool);
+}
+
+/**
+ * @brief Calls `func(element)` for every element, spread across the threads of `pool`.
+ */
+template <typename ElementType, typename AllocatorType, typename Func>
+void parallel_for(Array<ElementType, AllocatorType>& array,
+                  Func&& func,
+                  size_t grain_size = parallel_default_grain_size,
+                  ThreadPool& pool = ThreadPool::get_instance()) {
+    internal::parallel_for_each(array.data(), array.size(), func, grain_size, pool);
+}
+
+template <typename ElementType, typename AllocatorType, typename Func>
+void parallel_for(const Array<ElementType, AllocatorType>& array,
+                  Func&& func,
+                  size_t grain_size = parallel_default_grain_size,
+                  ThreadPool& pool = ThreadPool::get_instance()) {
+    internal::parallel_for_each(array.data(), array.size(), func, grain_size, pool);
+}
+
+template <typename ElementType, typename Func>
+void parallel_for(ArrayView<ElementType> view,
+                  Func&& func,
+                  size_t grain_size = parallel_default_grain_size,
+                  ThreadPool& pool = ThreadPool::get_instance()) {
+    internal::parallel_for_each(view.data(), view.size(), func, grain_size, pool);
+}
+
+/**
+ * @brief Builds an array of `mapper(element)` for every element, computed across the threads of `pool`.
+ * The mapped type must be default constructible.
+ */
+template <typename ElementType,
+          typename Mapper,
+          typename OtherElementType = std::decay_t<std::invoke_result_t<Mapper&, const ElementType&>>>
+Array<OtherElementType> parallel_map(ArrayView<ElementType> view,
+                                     Mapper&& mapper,
+                                     size_t grain_size = parallel_default_grain_size,
+                                     ThreadPool& pool = ThreadPool::get_instance()) {
+    Array<OtherElementType> other;
+    other.resize(view.size());
+
+    const ElementType* source = view.data();
+    OtherElementType* destination = other.data();
+    parallel_for_chunks(view.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            destination[i] = mapper(source[i]);
+        }
+    }, grain_size, pool);
+
+    return other;
+}
+
+template <typename ElementType,
+          typename AllocatorType,
+          typename Mapper,
+          typename OtherElementType = std::decay_t<std::invoke_result_t<Mapper&, const ElementType&>>>
+Array<OtherElementType> parallel_map(const Array<ElementType, AllocatorType>& array,
+                                     Mapper&& mapper,
+                                     size_t grain_size = parallel_default_grain_size,
+                                     ThreadPool& pool = ThreadPool::get_instance()) {
+    return parallel_map(ArrayView<ElementType>(array), std::forward<Mapper>(mapper), grain_size, pool);
+}
+
+/**
+ * @brief Folds the elements with `reduce(result, element)` on chunks of `grain_size` elements in parallel,
+ * each chunk starting from `identity`, then folds the chunk results in order with `combine(result, result)`.
+ *
+ * The chunks only depend on the element count and the grain size, and are combined from first to last,
+ * so the result is the same on every run and every machine, floating point sums included.
+ */
+template <typename ElementType, typename ResultType, typename Reduce, typename Combine>
+    requires std::invocable<Combine&, ResultType, ResultType>
+ResultType parallel_reduce(ArrayView<ElementType> view,
+                           ResultType identity,
+                           Reduce&& reduce,
+                           Combine&& combine,
+                           size_t grain_size = parallel_default_grain_size,
+                           ThreadPool& pool = ThreadPool::get_instance()) {
+    grain_size = grain_size == 0 ? 1 : grain_size;
+    const size_t chunk_count = internal::parallel_chunk_count(view.size(), grain_size);
+    if (chunk_count == 0) {
+        return identity;
+    }
+
+    Array<ResultType> partial_results;
+    partial_results.resize(chunk_count, identity);
+
+    const ElementType* data = view.data();
+    parallel_for_chunks(view.size(), [&](size_t begin, size_t end) {
+        ResultType& partial_result = partial_results[begin / grain_size];
+        for (size_t i = begin; i < end; i++) {
+            partial_result = reduce(std::move(partial_result), data[i]);
+        }
+    }, grain_size, pool);
+
+    ResultType result = std::move(partial_results[0]);
+    for (size_t chunk = 1; chunk < chunk_count; chunk++) {
+        result = combine(std::move(result), std::move(partial_results[chunk]));
+    }
+    return result;
+}
+
+template <typename ElementType, typename AllocatorType, typename ResultType, typename Reduce, typename Combine>
+    requires std::invocable<Combine&, ResultType, ResultType>
+ResultType parallel_reduce(const Array<ElementType, AllocatorType>& array,
+                           ResultType identity,
+                           Reduce&& reduce,
+                           Combine&& combine,
+                           size_t grain_size = parallel_default_grain_size,
+                           ThreadPool& pool = ThreadPool::get_instance()) {
+    return parallel_reduce(ArrayView<ElementType>(array), std::move(identity),
+                           std::forward<Reduce>(reduce), std::forward<Combine>(combine), grain_size, pool);
+}
+
+/**
+ * @brief `parallel_reduce` where the chunk results are combined with `reduce` too, e.g. a sum.
+ */
+template <typename ElementType, typename ResultType, typename Reduce>
+ResultType parallel_reduce(ArrayView<ElementType> view,
+                           ResultType identity,
+                           Reduce&& reduce,
+                           size_t grain_size = parallel_default_grain_size,
+                           ThreadPool& pool = ThreadPool::get_instance()) {
+    return parallel_reduce(view, std::move(identity), reduce, reduce, grain_size, pool);
+}
+
+template <typename ElementType, typename AllocatorType, typename ResultType, typename Reduce>
+ResultType parallel_reduce(const Array<ElementType, AllocatorType>& array,
+                           ResultType identity,
+                           Reduce&& reduce,
+                           size_t grain_size = parallel_default_grain_size,
+                           ThreadPool& pool = ThreadPool::get_instance()) {
+    return parallel_reduce(ArrayView<ElementType>(array), std::move(identity), reduce, reduce, grain_size, pool);
+}
+
+namespace internal {
+
+template <typename ElementType, typename Func>
+void parallel_for_each(ElementType* data, size_t count, Func& func, size_t grain_size, ThreadPool& pool) {
+    parallel_for_chunks(count, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            func(data[i]);
+        }
+    }, grain_size, pool);
+}
+
+}  //namespace internal
+
+}  //namespace licht
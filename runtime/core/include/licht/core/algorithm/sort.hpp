@@ -0,0 +1,401 @@
+#pragma once
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/defines.hpp"
+#include "licht/core/memory/memory.hpp"
+#include "licht/core/thread/thread_pool.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace licht {
+
+/**
+ * @brief Integer types `radix_sort` can order, signed ones included.
+ */
+template <typename Key>
+concept CRadixKey = std::integral<Key> && !std::same_as<Key, bool> && sizeof(Key) <= 8;
+
+namespace internal {
+
+inline constexpr size_t radix_digit_bits = 8;
+inline constexpr size_t radix_bucket_count = size_t(1) << radix_digit_bits;
+
+/**
+ * @brief Below this many keys, a comparison sort beats the histogram passes.
+ */
+inline constexpr size_t radix_sort_threshold = 64;
+
+/**
+ * @brief Marks a radix sort without values carried along the keys.
+ */
+struct RadixNoValue {};
+
+/**
+ * @brief Unsigned image of a key, ordered like the key: the sign bit of signed keys is flipped.
+ */
+template <CRadixKey Key>
+inline constexpr std::make_unsigned_t<Key> radix_bits(Key key) {
+    using Unsigned = std::make_unsigned_t<Key>;
+    if constexpr (std::is_signed_v<Key>) {
+        return static_cast<Unsigned>(key) ^ (Unsigned(1) << (sizeof(Key) * 8 - 1));
+    } else {
+        return key;
+    }
+}
+
+template <CRadixKey Key>
+inline constexpr size_t radix_digit(Key key, size_t pass) {
+    return static_cast<size_t>((radix_bits(key) >> (pass * radix_digit_bits)) & (radix_bucket_count - 1));
+}
+
+/**
+ * @brief LSD radix sort of `keys`, moving `values[i]` along with `keys[i]` unless `Value` is `RadixNoValue`.
+ *
+ * All the digit histograms are built in a single read of the keys. A pass whose digit is the same for every key
+ * (e.g. the unused high bits of a draw key) is skipped.
+ */
+template <CRadixKey Key, typename Value>
+void radix_sort(Key* keys, Key* key_scratch, Value* values, Value* value_scratch, size_t count) {
+    constexpr size_t pass_count = sizeof(Key);
+    constexpr bool has_values = !std::is_same_v<Value, RadixNoValue>;
+
+    size_t histograms[pass_count][radix_bucket_count] = {};
+    for (size_t i = 0; i < count; i++) {
+        for (size_t pass = 0; pass < pass_count; pass++) {
+            histograms[pass][radix_digit(keys[i], pass)]++;
+        }
+    }
+
+    Key* source_keys = keys;
+    Key* destination_keys = key_scratch;
+    Value* source_values = values;
+    Value* destination_values = value_scratch;
+
+    for (size_t pass = 0; pass < pass_count; pass++) {
+        size_t* histogram = histograms[pass];
+        if (histogram[radix_digit(source_keys[0], pass)] == count) {
+            continue;
+        }
+
+        size_t offset = 0;
+        for (size_t bucket = 0; bucket < radix_bucket_count; bucket++) {
+            const size_t bucket_size = histogram[bucket];
+            histogram[bucket] = offset;
+            offset += bucket_size;
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            const size_t position = histogram[radix_digit(source_keys[i], pass)]++;
+            destination_keys[position] = source_keys[i];
+            if constexpr (has_values) {
+                destination_values[position] = std::move(source_values[i]);
+            }
+        }
+
+        std::swap(source_keys, destination_keys);
+        if constexpr (has_values) {
+            std::swap(source_values, destination_values);
+        }
+    }
+
+    if (source_keys != keys) {
+        Memory::copy(keys, source_keys, sizeof(Key) * count);
+        if constexpr (has_values) {
+            std::move(source_values, source_values + count, values);
+        }
+    }
+}
+
+/**
+ * @brief `radix_sort` with every pass split in `chunk_count` chunks of keys, one per task of `pool`.
+ *
+ * A pass counts the digits of each chunk in parallel, turns the counts into offsets with a prefix sum ordered by
+ * bucket then by chunk, and scatters each chunk in parallel from its own offsets. Chunk `c` places its keys
+ * of a bucket after the ones of the chunks before it, so the sort stays stable.
+ */
+template <CRadixKey Key, typename Value>
+void parallel_radix_sort(Key* keys,
+                         Key* key_scratch,
+                         Value* values,
+                         Value* value_scratch,
+                         size_t count,
+                         size_t chunk_count,
+                         ThreadPool& pool) {
+    using Unsigned = std::make_unsigned_t<Key>;
+    constexpr size_t pass_count = sizeof(Key);
+    constexpr bool has_values = !std::is_same_v<Value, RadixNoValue>;
+
+    // Chunk c is [count * c / chunk_count, count * (c + 1) / chunk_count) in every pass.
+    auto chunk_begin = [count, chunk_count](size_t chunk) -> size_t {
+        return count * chunk / chunk_count;
+    };
+
+    // Bits that differ from the first key somewhere, a pass is skipped when none of its digit bits does.
+    Array<Unsigned> chunk_differing_bits;
+    chunk_differing_bits.resize(chunk_count);
+    const Unsigned first_bits = radix_bits(keys[0]);
+    pool.run_parallel(chunk_count, [&](size_t chunk) {
+        Unsigned differing = 0;
+        for (size_t i = chunk_begin(chunk); i < chunk_begin(chunk + 1); i++) {
+            differing |= radix_bits(keys[i]) ^ first_bits;
+        }
+        chunk_differing_bits[chunk] = differing;
+    });
+
+    Unsigned differing_bits = 0;
+    for (Unsigned differing : chunk_differing_bits) {
+        differing_bits |= differing;
+    }
+
+    // Histogram of chunk c, then its offsets, at [c * radix_bucket_count, (c + 1) * radix_bucket_count).
+    Array<size_t> chunk_offsets;
+    chunk_offsets.resize(chunk_count * radix_bucket_count);
+
+    Key* source_keys = keys;
+    Key* destination_keys = key_scratch;
+    Value* source_values = values;
+    Value* destination_values = value_scratch;
+
+    for (size_t pass = 0; pass < pass_count; pass++) {
+        if (((differing_bits >> (pass * radix_digit_bits)) & (radix_bucket_count - 1)) == 0) {
+            continue;
+        }
+
+        pool.run_parallel(chunk_count, [&](size_t chunk) {
+            size_t* histogram = chunk_offsets.data() + chunk * radix_bucket_count;
+            std::fill(histogram, histogram + radix_bucket_count, size_t(0));
+            for (size_t i = chunk_begin(chunk); i < chunk_begin(chunk + 1); i++) {
+                histogram[radix_digit(source_keys[i], pass)]++;
+            }
+        });
+
+        size_t offset = 0;
+        for (size_t bucket = 0; bucket < radix_bucket_count; bucket++) {
+            for (size_t chunk = 0; chunk < chunk_count; chunk++) {
+                size_t& chunk_offset = chunk_offsets[chunk * radix_bucket_count + bucket];
+                const size_t bucket_size = chunk_offset;
+                chunk_offset = offset;
+                offset += bucket_size;
+            }
+        }
+
+        pool.run_parallel(chunk_count, [&](size_t chunk) {
+            size_t* offsets = chunk_offsets.data() + chunk * radix_bucket_count;
+            for (size_t i = chunk_begin(chunk); i < chunk_begin(chunk + 1); i++) {
+                const size_t position = offsets[radix_digit(source_keys[i], pass)]++;
+                destination_keys[position] = source_keys[i];
+                if constexpr (has_values) {
+                    destination_values[position] = std::move(source_values[i]);
+                }
+            }
+        });
+
+        std::swap(source_keys, destination_keys);
+        if constexpr (has_values) {
+            std::swap(source_values, destination_values);
+        }
+    }
+
+    if (source_keys != keys) {
+        pool.run_parallel(chunk_count, [&](size_t chunk) {
+            const size_t begin = chunk_begin(chunk);
+            const size_t end = chunk_begin(chunk + 1);
+            Memory::copy(keys + begin, source_keys + begin, sizeof(Key) * (end - begin));
+            if constexpr (has_values) {
+                std::move(source_values + begin, source_values + end, values + begin);
+            }
+        });
+    }
+}
+
+}  //namespace internal
+
+/**
+ * @brief Sorts the elements with an introsort, i.e. `std::sort`.
+ */
+template <typename ElementType, typename AllocatorType, typename Compare = std::less<>>
+void sort(Array<ElementType, AllocatorType>& array, Compare compare = Compare()) {
+    std::sort(array.begin(), array.end(), compare);
+}
+
+/**
+ * @brief Sorts integer keys in ascending order with an LSD radix sort, in O(n) time and O(n) extra memory.
+ * @param scratch Buffer of at least `count` keys, its content is overwritten.
+ */
+template <CRadixKey Key>
+void radix_sort(Key* keys, size_t count, Key* scratch) {
+    if (count < internal::radix_sort_threshold) {
+        std::sort(keys, keys + count);
+        return;
+    }
+
+    internal::radix_sort<Key, internal::RadixNoValue>(keys, scratch, nullptr, nullptr, count);
+}
+
+template <CRadixKey Key, typename AllocatorType>
+void radix_sort(Array<Key, AllocatorType>& keys) {
+    if (keys.size() < internal::radix_sort_threshold) {
+        std::sort(keys.begin(), keys.end());
+        return;
+    }
+
+    Array<Key, AllocatorType> scratch;
+    scratch.resize(keys.size());
+    radix_sort(keys.data(), keys.size(), scratch.data());
+}
+
+/**
+ * @brief Sorts integer keys in ascending order, applying the same permutation to `values`.
+ * Keys that compare equal keep the relative order of their values (the sort is stable).
+ */
+template <CRadixKey Key, typename Value, typename KeyAllocatorType, typename ValueAllocatorType>
+void radix_sort(Array<Key, KeyAllocatorType>& keys, Array<Value, ValueAllocatorType>& values) {
+    LCHECK_MSG(keys.size() == values.size(), "radix_sort needs one value per key.");
+    if (keys.empty()) {
+        return;
+    }
+
+    Array<Key, KeyAllocatorType> key_scratch;
+    key_scratch.resize(keys.size());
+    Array<Value, ValueAllocatorType> value_scratch;
+    value_scratch.resize(values.size());
+
+    internal::radix_sort(keys.data(), key_scratch.data(), values.data(), value_scratch.data(), keys.size());
+}
+
+/**
+ * @brief Sorts the elements by splitting them in chunks sorted on the threads of `pool`,
+ * then merging pairs of sorted runs in parallel until one run is left.
+ *
+ * Falls back to `sort` below `min_chunk_size` elements per chunk. Elements must be default constructible.
+ *
+ * @param thread_count Number of chunks to split the work in, 0 for one per thread of the pool.
+ */
+template <typename ElementType, typename AllocatorType, typename Compare = std::less<>>
+void parallel_sort(Array<ElementType, AllocatorType>& array,
+                   Compare compare = Compare(),
+                   size_t thread_count = 0,
+                   size_t min_chunk_size = 16 * 1024,
+                   ThreadPool& pool = ThreadPool::get_instance()) {
+    const size_t count = array.size();
+
+    if (thread_count == 0) {
+        thread_count = pool.get_concurrency();
+    }
+    size_t chunk_count = std::min(thread_count, count / std::max<size_t>(1, min_chunk_size));
+
+    if (chunk_count <= 1) {
+        std::sort(array.begin(), array.end(), compare);
+        return;
+    }
+
+    // Run boundaries: run i is [bounds[i], bounds[i + 1]).
+    Array<size_t> bounds(chunk_count + 1);
+    for (size_t i = 0; i <= chunk_count; i++) {
+        bounds.append(count * i / chunk_count);
+    }
+
+    ElementType* data = array.data();
+    pool.run_parallel(chunk_count, [&](size_t chunk) {
+        std::sort(data + bounds[chunk], data + bounds[chunk + 1], compare);
+    });
+
+    Array<ElementType, AllocatorType> scratch;
+    scratch.resize(count);
+
+    ElementType* source = data;
+    ElementType* destination = scratch.data();
+
+    while (chunk_count > 1) {
+        const size_t merge_count = (chunk_count + 1) / 2;
+
+        pool.run_parallel(merge_count, [&](size_t merge) {
+            const size_t begin = bounds[merge * 2];
+            const size_t middle = bounds[std::min(merge * 2 + 1, chunk_count)];
+            const size_t end = bounds[std::min(merge * 2 + 2, chunk_count)];
+
+            std::merge(std::make_move_iterator(source + begin), std::make_move_iterator(source + middle),
+                       std::make_move_iterator(source + middle), std::make_move_iterator(source + end),
+                       destination + begin, compare);
+        });
+
+        Array<size_t> merged_bounds(merge_count + 1);
+        for (size_t i = 0; i < merge_count; i++) {
+            merged_bounds.append(bounds[i * 2]);
+        }
+        merged_bounds.append(count);
+
+        bounds = std::move(merged_bounds);
+        chunk_count = merge_count;
+        std::swap(source, destination);
+    }
+
+    if (source != data) {
+        std::move(source, source + count, data);
+    }
+}
+
+/**
+ * @brief `radix_sort` spread over the threads of `pool`. Every pass counts digits per chunk in parallel,
+ * then each thread scatters its chunk of keys at the offsets the prefix sum of all the counts gives it.
+ *
+ * Falls back to `radix_sort` below `min_chunk_size` keys per chunk.
+ *
+ * @param thread_count Number of chunks to split the work in, 0 for one per thread of the pool.
+ */
+template <CRadixKey Key, typename AllocatorType>
+void parallel_radix_sort(Array<Key, AllocatorType>& keys,
+                         size_t thread_count = 0,
+                         size_t min_chunk_size = 16 * 1024,
+                         ThreadPool& pool = ThreadPool::get_instance()) {
+    if (thread_count == 0) {
+        thread_count = pool.get_concurrency();
+    }
+    const size_t chunk_count = std::min(thread_count, keys.size() / std::max<size_t>(1, min_chunk_size));
+
+    if (chunk_count <= 1) {
+        radix_sort(keys);
+        return;
+    }
+
+    Array<Key, AllocatorType> scratch;
+    scratch.resize(keys.size());
+    internal::parallel_radix_sort<Key, internal::RadixNoValue>(keys.data(), scratch.data(), nullptr, nullptr,
+                                                               keys.size(), chunk_count, pool);
+}
+
+/**
+ * @brief `parallel_radix_sort` applying the same permutation to `values`, stably like `radix_sort`.
+ */
+template <CRadixKey Key, typename Value, typename KeyAllocatorType, typename ValueAllocatorType>
+void parallel_radix_sort(Array<Key, KeyAllocatorType>& keys,
+                         Array<Value, ValueAllocatorType>& values,
+                         size_t thread_count = 0,
+                         size_t min_chunk_size = 16 * 1024,
+                         ThreadPool& pool = ThreadPool::get_instance()) {
+    LCHECK_MSG(keys.size() == values.size(), "parallel_radix_sort needs one value per key.");
+    if (thread_count == 0) {
+        thread_count = pool.get_concurrency();
+    }
+    const size_t chunk_count = std::min(thread_count, keys.size() / std::max<size_t>(1, min_chunk_size));
+
+    if (chunk_count <= 1) {
+        radix_sort(keys, values);
+        return;
+    }
+
+    Array<Key, KeyAllocatorType> key_scratch;
+    key_scratch.resize(keys.size());
+    Array<Value, ValueAllocatorType> value_scratch;
+    value_scratch.resize(values.size());
+
+    internal::parallel_radix_sort(keys.data(), key_scratch.data(), values.data(), value_scratch.data(), keys.size(),
+                                  chunk_count, pool);
+}
+
+}  //namespace licht
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "licht/core/async/frame_scheduler.hpp"
+#include "licht/core/async/task.hpp"
+#include "licht/core/defines.hpp"
+#include "licht/core/thread/job_system.hpp"
+
+#include <chrono>
+#include <coroutine>
+
+namespace licht {
+
+/**
+ * @brief Suspends the coroutine and resumes it as a job of `job_system`, i.e. on a worker thread when it has some.
+ */
+class ResumeOnWorkerAwaiter {
+public:
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) const {
+        job_system_->run([handle]() { handle.resume(); });
+    }
+
+    void await_resume() const noexcept {}
+
+public:
+    explicit ResumeOnWorkerAwaiter(JobSystem& job_system)
+        : job_system_(&job_system) {}
+
+private:
+    JobSystem* job_system_;
+};
+
+/**
+ * @brief Suspends the coroutine until the next `FrameScheduler::tick`, where it resumes on the frame thread.
+ */
+class NextFrameAwaiter {
+public:
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    template <typename PromiseType>
+    void await_suspend(std::coroutine_handle<PromiseType> handle) const {
+        scheduler_->resume_next_tick(handle, internal::get_detached_root(handle));
+    }
+
+    void await_resume() const noexcept {}
+
+public:
+    explicit NextFrameAwaiter(FrameScheduler& scheduler)
+        : scheduler_(&scheduler) {}
+
+private:
+    FrameScheduler* scheduler_;
+};
+
+/**
+ * @brief Suspends the coroutine until the first `FrameScheduler::tick` after a delay.
+ */
+class DelayAwaiter {
+public:
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    template <typename PromiseType>
+    void await_suspend(std::coroutine_handle<PromiseType> handle) const {
+        scheduler_->resume_after(deadline_, handle, internal::get_detached_root(handle));
+    }
+
+    void await_resume() const noexcept {}
+
+public:
+    DelayAwaiter(FrameScheduler& scheduler, FrameScheduler::Clock::time_point deadline)
+        : scheduler_(&scheduler), deadline_(deadline) {}
+
+private:
+    FrameScheduler* scheduler_;
+    FrameScheduler::Clock::time_point deadline_;
+};
+
+inline ResumeOnWorkerAwaiter resume_on_worker(JobSystem& job_system = JobSystem::get_instance()) {
+    return ResumeOnWorkerAwaiter(job_system);
+}
+
+inline NextFrameAwaiter next_frame(FrameScheduler& scheduler = FrameScheduler::get_instance()) {
+    return NextFrameAwaiter(scheduler);
+}
+
+/**
+ * @param seconds Time to wait before resuming, rounded up to the next frame.
+ */
+inline DelayAwaiter delay(float64 seconds, FrameScheduler& scheduler = FrameScheduler::get_instance()) {
+    const auto duration = std::chrono::duration_cast<FrameScheduler::Clock::duration>(std::chrono::duration<float64>(seconds));
+    return DelayAwaiter(scheduler, FrameScheduler::Clock::now() + duration);
+}
+
+}  //namespace licht
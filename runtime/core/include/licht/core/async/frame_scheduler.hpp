@@ -0,0 +1,75 @@
+#pragma once
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/core_exports.hpp"
+#include "licht/core/defines.hpp"
+
+#include <chrono>
+#include <coroutine>
+#include <mutex>
+
+namespace licht {
+
+/**
+ * @brief Resumes the coroutines waiting for the next frame or for a delay, from the thread ticking the frames.
+ *
+ * The main loop calls `tick` once per frame; any thread can queue a coroutine.
+ * Coroutines still waiting when the scheduler is destroyed are destroyed with it, through the
+ * detached coroutine owning them when there is one.
+ */
+class LICHT_CORE_API FrameScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static FrameScheduler& get_instance();
+
+    /**
+     * @brief Resumes the coroutines queued before this call and the ones whose delay is over.
+     * Coroutines queued while they run wait for the next tick.
+     */
+    void tick();
+
+    /**
+     * @brief Number of ticks since the scheduler was created.
+     */
+    inline uint64 get_frame_index() const {
+        return frame_index_;
+    }
+
+    /**
+     * @param owner Coroutine owning the frame of `handle`, destroyed if the scheduler goes away first. May be null.
+     */
+    void resume_next_tick(std::coroutine_handle<> handle, std::coroutine_handle<> owner = nullptr);
+
+    void resume_after(Clock::time_point deadline, std::coroutine_handle<> handle, std::coroutine_handle<> owner = nullptr);
+
+public:
+    FrameScheduler() = default;
+    ~FrameScheduler();
+
+    FrameScheduler(const FrameScheduler&) = delete;
+    FrameScheduler(FrameScheduler&&) = delete;
+
+    FrameScheduler& operator=(const FrameScheduler&) = delete;
+    FrameScheduler& operator=(FrameScheduler&&) = delete;
+
+private:
+    struct Waiting {
+        std::coroutine_handle<> handle;
+        std::coroutine_handle<> owner;
+    };
+
+    struct Timer {
+        Clock::time_point deadline;
+        Waiting waiting;
+    };
+
+    std::mutex mutex_;
+    Array<Waiting> next_tick_;
+    Array<Timer> timers_;
+
+    Array<Waiting> resuming_;
+    uint64 frame_index_ = 0;
+};
+
+}  //namespace licht
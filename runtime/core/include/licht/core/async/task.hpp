@@ -0,0 +1,328 @@
+#pragma once
+
+#include "licht/core/defines.hpp"
+#include "licht/core/platform/cpu.hpp"
+#include "licht/core/thread/job_system.hpp"
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace licht {
+
+template <typename ResultType = void>
+class Task;
+
+namespace internal {
+
+class TaskPromiseBase {
+public:
+    /**
+     * @brief Resumes the coroutine awaiting the task, if any, in place of returning to the resumer.
+     */
+    struct FinalAwaiter {
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        template <typename PromiseType>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseType> handle) noexcept {
+            std::coroutine_handle<> continuation = handle.promise().continuation_;
+            return continuation ? continuation : std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    /**
+     * @brief Tasks are lazy, they start when awaited.
+     */
+    std::suspend_always initial_suspend() const noexcept {
+        return {};
+    }
+
+    FinalAwaiter final_suspend() const noexcept {
+        return {};
+    }
+
+    void unhandled_exception() const noexcept {
+        std::terminate();
+    }
+
+    void set_continuation(std::coroutine_handle<> continuation) {
+        continuation_ = continuation;
+    }
+
+    void set_parent(TaskPromiseBase* parent) {
+        parent_ = parent;
+    }
+
+    void set_detached_root(std::coroutine_handle<> detached_root) {
+        detached_root_ = detached_root;
+    }
+
+    /**
+     * @brief Detached coroutine at the root of the chain of tasks awaiting this one.
+     * Null when the chain is owned by a `Task` instead, or awaited by another kind of coroutine.
+     */
+    std::coroutine_handle<> get_detached_root() const {
+        const TaskPromiseBase* promise = this;
+        while (promise->parent_) {
+            promise = promise->parent_;
+        }
+        return promise->detached_root_;
+    }
+
+private:
+    std::coroutine_handle<> continuation_;
+    TaskPromiseBase* parent_ = nullptr;
+    std::coroutine_handle<> detached_root_;
+};
+
+template <typename ResultType>
+class TaskPromise : public TaskPromiseBase {
+public:
+    Task<ResultType> get_return_object() noexcept;
+
+    template <typename ValueType>
+        requires std::is_convertible_v<ValueType&&, ResultType>
+    void return_value(ValueType&& value) {
+        result_.emplace(std::forward<ValueType>(value));
+    }
+
+    ResultType take_result() {
+        LCHECK_MSG(result_.has_value(), "The task has no result, it did not complete.");
+        return std::move(*result_);
+    }
+
+private:
+    std::optional<ResultType> result_;
+};
+
+template <>
+class TaskPromise<void> : public TaskPromiseBase {
+public:
+    Task<void> get_return_object() noexcept;
+
+    void return_void() const noexcept {}
+
+    void take_result() const noexcept {}
+};
+
+/**
+ * @brief Coroutine started right away that destroys itself when it completes.
+ */
+struct DetachedCoroutine {
+    struct promise_type {
+        DetachedCoroutine get_return_object() const noexcept {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() const noexcept {
+            return {};
+        }
+
+        std::suspend_never final_suspend() const noexcept {
+            return {};
+        }
+
+        void return_void() const noexcept {}
+
+        void unhandled_exception() const noexcept {
+            std::terminate();
+        }
+    };
+};
+
+}  //namespace internal
+
+/**
+ * @brief Result of a coroutine computing a `ResultType`.
+ *
+ * A task is lazy: its body starts when it is `co_await`ed, and the awaiting coroutine resumes
+ * on whichever thread completes the task. From regular code, a task is run with `sync_wait` or `spawn`.
+ *
+ * Loading code can then be written linearly and still hop between threads:
+ * @code
+ * Task<Mesh> load_mesh(String path) {
+ *     FileOpenError<Array<uint8>> bytes = co_await read_file_async(path);
+ *     co_await resume_on_worker();
+ *     Mesh mesh = decode(bytes.value());
+ *     co_await next_frame();
+ *     co_return mesh;
+ * }
+ * @endcode
+ */
+template <typename ResultType>
+class [[nodiscard]] Task {
+public:
+    using promise_type = internal::TaskPromise<ResultType>;
+    using HandleType = std::coroutine_handle<promise_type>;
+
+    class Awaiter {
+    public:
+        bool await_ready() const noexcept {
+            return !handle_ || handle_.done();
+        }
+
+        /**
+         * @brief Starts the task, symmetric transfer avoids growing the stack across chains of tasks.
+         */
+        template <typename AwaitingPromiseType>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<AwaitingPromiseType> awaiting) noexcept {
+            handle_.promise().set_continuation(awaiting);
+            if constexpr (std::is_base_of_v<internal::TaskPromiseBase, AwaitingPromiseType>) {
+                handle_.promise().set_parent(&awaiting.promise());
+            } else if constexpr (std::is_same_v<AwaitingPromiseType, internal::DetachedCoroutine::promise_type>) {
+                handle_.promise().set_detached_root(awaiting);
+            }
+            return handle_;
+        }
+
+        ResultType await_resume() {
+            return handle_.promise().take_result();
+        }
+
+    public:
+        explicit Awaiter(HandleType handle)
+            : handle_(handle) {}
+
+    private:
+        HandleType handle_;
+    };
+
+    Awaiter operator co_await() && noexcept {
+        return Awaiter(handle_);
+    }
+
+    inline bool is_valid() const {
+        return static_cast<bool>(handle_);
+    }
+
+    inline bool is_done() const {
+        return handle_ && handle_.done();
+    }
+
+public:
+    Task() = default;
+
+    explicit Task(HandleType handle)
+        : handle_(handle) {}
+
+    Task(Task&& other) noexcept
+        : handle_(std::exchange(other.handle_, nullptr)) {}
+
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            destroy();
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() {
+        destroy();
+    }
+
+private:
+    void destroy() {
+        if (handle_) {
+            handle_.destroy();
+            handle_ = nullptr;
+        }
+    }
+
+private:
+    HandleType handle_;
+};
+
+namespace internal {
+
+template <typename ResultType>
+Task<ResultType> TaskPromise<ResultType>::get_return_object() noexcept {
+    return Task<ResultType>(std::coroutine_handle<TaskPromise<ResultType>>::from_promise(*this));
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() noexcept {
+    return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+
+template <typename ResultType>
+DetachedCoroutine run_detached(Task<ResultType> task) {
+    co_await std::move(task);
+}
+
+template <typename ResultType>
+DetachedCoroutine run_and_signal(Task<ResultType> task, std::optional<ResultType>* out_result, std::atomic<bool>* done) {
+    out_result->emplace(co_await std::move(task));
+    done->store(true, std::memory_order_release);
+}
+
+inline DetachedCoroutine run_and_signal(Task<void> task, std::atomic<bool>* done) {
+    co_await std::move(task);
+    done->store(true, std::memory_order_release);
+}
+
+/**
+ * @brief Coroutine owning the frame of `handle` and the frames of everything it awaits, null when a `Task` owns them.
+ */
+template <typename PromiseType>
+std::coroutine_handle<> get_detached_root(std::coroutine_handle<PromiseType> handle) {
+    if constexpr (std::is_base_of_v<TaskPromiseBase, PromiseType>) {
+        return handle.promise().get_detached_root();
+    } else if constexpr (std::is_same_v<PromiseType, DetachedCoroutine::promise_type>) {
+        return handle;
+    } else {
+        return nullptr;
+    }
+}
+
+}  //namespace internal
+
+/**
+ * @brief Starts the task and lets it run to completion on its own, its result is dropped.
+ */
+template <typename ResultType>
+void spawn(Task<ResultType> task) {
+    internal::run_detached(std::move(task));
+}
+
+/**
+ * @brief Runs the task and blocks the calling thread until it completes, running jobs in the meantime.
+ *
+ * The frame thread must not wait this way on a task awaiting `next_frame`, the frame would never end.
+ */
+template <typename ResultType>
+ResultType sync_wait(Task<ResultType> task, JobSystem& job_system = JobSystem::get_instance()) {
+    std::atomic<bool> done = false;
+
+    auto wait_done = [&]() {
+        SpinWait spin;
+        while (!done.load(std::memory_order_acquire)) {
+            if (job_system.try_run_one_job()) {
+                spin.reset();
+            } else {
+                spin.wait();
+            }
+        }
+    };
+
+    if constexpr (std::is_void_v<ResultType>) {
+        internal::run_and_signal(std::move(task), &done);
+        wait_done();
+    } else {
+        std::optional<ResultType> result;
+        internal::run_and_signal(std::move(task), &result, &done);
+        wait_done();
+
+        return std::move(*result);
+    }
+}
+
+}  //namespace licht
@@ -0,0 +1,263 @@
+#pragma once
+
+#include "licht/core/async/task.hpp"
+#include "licht/core/containers/array.hpp"
+#include "licht/core/defines.hpp"
+#include "licht/core/memory/memory.hpp"
+
+#include <array>
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace licht {
+
+namespace internal {
+
+/**
+ * @brief Counts the tasks of a `when_all` left to complete, plus one for the awaiting coroutine.
+ * Whoever brings it to zero resumes the awaiting coroutine.
+ */
+class WhenAllLatch {
+public:
+    std::coroutine_handle<> arrive() noexcept {
+        if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            return continuation_;
+        }
+        return std::noop_coroutine();
+    }
+
+    /**
+     * @return false if every task is already done and the awaiting coroutine must not suspend.
+     */
+    bool try_suspend(std::coroutine_handle<> continuation) noexcept {
+        continuation_ = continuation;
+        return remaining_.fetch_sub(1, std::memory_order_acq_rel) > 1;
+    }
+
+public:
+    explicit WhenAllLatch(size_t count)
+        : remaining_(count + 1) {}
+
+private:
+    std::atomic<size_t> remaining_;
+    std::coroutine_handle<> continuation_;
+};
+
+struct WhenAllLatchAwaiter {
+    WhenAllLatch& latch;
+
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle) noexcept {
+        return latch.try_suspend(handle);
+    }
+
+    void await_resume() const noexcept {}
+};
+
+/**
+ * @brief Result of one task of a `when_all`, written once by its part.
+ */
+template <typename ResultType>
+class WhenAllSlot {
+public:
+    template <typename ValueType>
+    void emplace(ValueType&& value) {
+        lplacement_new(storage_) ResultType(std::forward<ValueType>(value));
+        has_value_ = true;
+    }
+
+    ResultType take() {
+        return std::move(*reinterpret_cast<ResultType*>(storage_));
+    }
+
+public:
+    WhenAllSlot() = default;
+
+    WhenAllSlot(WhenAllSlot&& other) noexcept {
+        if (other.has_value_) {
+            emplace(other.take());
+        }
+    }
+
+    WhenAllSlot(const WhenAllSlot&) = delete;
+    WhenAllSlot& operator=(const WhenAllSlot&) = delete;
+    WhenAllSlot& operator=(WhenAllSlot&&) = delete;
+
+    ~WhenAllSlot() {
+        if (has_value_) {
+            reinterpret_cast<ResultType*>(storage_)->~ResultType();
+        }
+    }
+
+private:
+    alignas(ResultType) uint8 storage_[sizeof(ResultType)];
+    bool has_value_ = false;
+};
+
+/**
+ * @brief Coroutine awaiting one task of a `when_all`, then arriving at the latch.
+ */
+class WhenAllPart {
+public:
+    struct promise_type {
+        WhenAllLatch* latch = nullptr;
+
+        struct FinalAwaiter {
+            bool await_ready() const noexcept {
+                return false;
+            }
+
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+                return handle.promise().latch->arrive();
+            }
+
+            void await_resume() const noexcept {}
+        };
+
+        WhenAllPart get_return_object() noexcept {
+            return WhenAllPart(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() const noexcept {
+            return {};
+        }
+
+        FinalAwaiter final_suspend() const noexcept {
+            return {};
+        }
+
+        void return_void() const noexcept {}
+
+        void unhandled_exception() const noexcept {
+            std::terminate();
+        }
+    };
+
+    void start(WhenAllLatch& latch) {
+        handle_.promise().latch = &latch;
+        handle_.resume();
+    }
+
+public:
+    WhenAllPart() = default;
+
+    explicit WhenAllPart(std::coroutine_handle<promise_type> handle)
+        : handle_(handle) {}
+
+    WhenAllPart(WhenAllPart&& other) noexcept
+        : handle_(std::exchange(other.handle_, nullptr)) {}
+
+    WhenAllPart& operator=(WhenAllPart&& other) noexcept {
+        if (this != &other) {
+            if (handle_) {
+                handle_.destroy();
+            }
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    WhenAllPart(const WhenAllPart&) = delete;
+    WhenAllPart& operator=(const WhenAllPart&) = delete;
+
+    ~WhenAllPart() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+private:
+    std::coroutine_handle<promise_type> handle_;
+};
+
+template <typename ResultType>
+WhenAllPart make_when_all_part(Task<ResultType> task, WhenAllSlot<ResultType>* slot) {
+    slot->emplace(co_await std::move(task));
+}
+
+inline WhenAllPart make_when_all_part(Task<void> task) {
+    co_await std::move(task);
+}
+
+template <typename... ResultTypes, size_t... Indices>
+std::array<WhenAllPart, sizeof...(ResultTypes)> make_when_all_parts(std::index_sequence<Indices...>,
+                                                                    std::tuple<WhenAllSlot<ResultTypes>...>& slots,
+                                                                    Task<ResultTypes>&... tasks) {
+    return {make_when_all_part(std::move(tasks), &std::get<Indices>(slots))...};
+}
+
+}  //namespace internal
+
+/**
+ * @brief Task completing once every given task has, with their results in order.
+ *
+ * The tasks start one after the other on the awaiting thread. The ones hopping to a worker
+ * (see `resume_on_worker`) then run concurrently, and the last to complete resumes the awaiting coroutine.
+ */
+template <typename... ResultTypes>
+    requires(!std::is_void_v<ResultTypes> && ...)
+Task<std::tuple<ResultTypes...>> when_all(Task<ResultTypes>... tasks) {
+    internal::WhenAllLatch latch(sizeof...(ResultTypes));
+    std::tuple<internal::WhenAllSlot<ResultTypes>...> slots;
+
+    std::array<internal::WhenAllPart, sizeof...(ResultTypes)> parts =
+        internal::make_when_all_parts<ResultTypes...>(std::index_sequence_for<ResultTypes...>(), slots, tasks...);
+
+    for (internal::WhenAllPart& part : parts) {
+        part.start(latch);
+    }
+    co_await internal::WhenAllLatchAwaiter{latch};
+
+    co_return std::apply([](auto&... slot) { return std::tuple<ResultTypes...>(slot.take()...); }, slots);
+}
+
+template <typename ResultType>
+Task<Array<ResultType>> when_all(Array<Task<ResultType>> tasks) {
+    const size_t count = tasks.size();
+    internal::WhenAllLatch latch(count);
+
+    Array<internal::WhenAllSlot<ResultType>> slots(count);
+    for (size_t i = 0; i < count; i++) {
+        slots.emplace_back();
+    }
+
+    Array<internal::WhenAllPart> parts(count);
+    for (size_t i = 0; i < count; i++) {
+        parts.append(internal::make_when_all_part(std::move(tasks[i]), &slots[i]));
+    }
+
+    for (internal::WhenAllPart& part : parts) {
+        part.start(latch);
+    }
+    co_await internal::WhenAllLatchAwaiter{latch};
+
+    Array<ResultType> results(count);
+    for (internal::WhenAllSlot<ResultType>& slot : slots) {
+        results.append(slot.take());
+    }
+    co_return results;
+}
+
+inline Task<void> when_all(Array<Task<void>> tasks) {
+    const size_t count = tasks.size();
+    internal::WhenAllLatch latch(count);
+
+    Array<internal::WhenAllPart> parts(count);
+    for (Task<void>& task : tasks) {
+        parts.append(internal::make_when_all_part(std::move(task)));
+    }
+
+    for (internal::WhenAllPart& part : parts) {
+        part.start(latch);
+    }
+    co_await internal::WhenAllLatchAwaiter{latch};
+}
+
+}  //namespace licht
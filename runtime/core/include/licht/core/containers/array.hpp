@@ -4,10 +4,12 @@
 #include "licht/core/memory/concepts.hpp"
 #include "licht/core/memory/default_allocator.hpp"
 #include "licht/core/memory/memory.hpp"
+#include "licht/core/memory/trivially_relocatable.hpp"
 
 #include <algorithm>
 #include <cstddef>
 #include <type_traits>
+#include <utility>
 
 namespace licht {
 
@@ -77,17 +79,11 @@ public:
     }
 
     void append(const ElementType& element) {
-        if (!data_) {
-            reallocate(capacity_);
-        }
-
-        if (size_ >= capacity_) {
-            reserve(capacity_ == 0 ? 1 : capacity_ * 2);
-        }
-
-        lplacement_new(data_ + size_) ElementType(element);
+        emplace_back(element);
+    }
 
-        ++size_;
+    void append(ElementType&& element) {
+        emplace_back(std::move(element));
     }
 
     template <typename OtherAllocatorType>
@@ -99,11 +95,27 @@ public:
 
     template <typename... Args>
     void emplace(Args&&... args) {
-        if (size_ >= capacity_) {
-            reserve(capacity_ == 0 ? 1 : capacity_ * 2);
+        emplace_back(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Constructs an element in place at the end of the array.
+     * The arguments may refer to elements of the array itself, even when it has to grow.
+     *
+     * @return The new element.
+     */
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        if (size_ < capacity_ && data_) {
+            lplacement_new(data_ + size_) ElementType(std::forward<Args>(args)...);
+        } else {
+            const size_type new_capacity = capacity_ == 0 ? 1 : capacity_ * 2;
+            ElementType* new_data = allocator_allocate(new_capacity);
+            lplacement_new(new_data + size_) ElementType(std::forward<Args>(args)...);
+            relocate(new_data, new_capacity);
         }
-        lplacement_new(data_ + size_) ElementType(std::forward<Args>(args)...);
-        ++size_;
+
+        return data_[size_++];
     }
 
     void pop() {
@@ -152,11 +164,13 @@ public:
                     data_[new_size] = std::move(data_[i]);
                 }
                 ++new_size;
-            } else {
-                data_[i].~ElementType();
             }
         }
 
+        for (size_type i = new_size; i < size_; ++i) {
+            data_[i].~ElementType();
+        }
+
         size_ = new_size;
     }
 
@@ -213,8 +227,12 @@ public:
         return data_;
     }
 
-    void push_back(ElementType element) {
-        append(std::move(element));
+    void push_back(const ElementType& element) {
+        emplace_back(element);
+    }
+
+    void push_back(ElementType&& element) {
+        emplace_back(std::move(element));
     }
 
     template <typename Predicate>
@@ -377,42 +395,54 @@ public:
     }
 
 private:
-    void copy_data(ElementType* source) {
+    void copy_data(const ElementType* source) {
         if (size_ <= 0) {
             return;
         }
 
         data_ = allocator_allocate(capacity_);
-        for (size_type i = 0; i < size_; i++) {
-            lplacement_new(data_ + i) ElementType(source[i]);
+        if constexpr (std::is_trivially_copyable_v<ElementType>) {
+            Memory::copy(data_, source, size_ * sizeof(ElementType));
+        } else {
+            for (size_type i = 0; i < size_; i++) {
+                lplacement_new(data_ + i) ElementType(source[i]);
+            }
         }
     }
 
     void reallocate(size_type new_capacity) {
-        ElementType* new_data = allocator_allocate(new_capacity);
-
-        size_type elements_to_move = (size_ < new_capacity) ? size_ : new_capacity;
-
-        for (size_type i = 0; i < elements_to_move; i++) {
-            lplacement_new(new_data + i) ElementType(std::move(data_[i]));
-        }
-
-        if (std::is_destructible_v<ElementType>) {
-            for (size_type i = 0; i < size_; i++) {
+        if (new_capacity < size_) {
+            for (size_type i = new_capacity; i < size_; i++) {
                 data_[i].~ElementType();
             }
+            size_ = new_capacity;
         }
 
+        relocate(allocator_allocate(new_capacity), new_capacity);
+    }
+
+    /**
+     * @brief Moves the elements to `new_data` and releases the current block.
+     * Trivially relocatable elements are copied at once, the others are moved then destroyed one by one.
+     */
+    void relocate(ElementType* new_data, size_type new_capacity) {
         if (data_) {
+            if constexpr (CTriviallyRelocatable<ElementType>) {
+                if (size_ > 0) {
+                    Memory::copy(new_data, data_, size_ * sizeof(ElementType));
+                }
+            } else {
+                for (size_type i = 0; i < size_; i++) {
+                    lplacement_new(new_data + i) ElementType(std::move_if_noexcept(data_[i]));
+                    data_[i].~ElementType();
+                }
+            }
+
             allocator_deallocate(data_, capacity_);
         }
 
         data_ = new_data;
         capacity_ = new_capacity;
-
-        if (new_capacity < size_) {
-            size_ = new_capacity;
-        }
     }
 
     constexpr ElementType* allocator_allocate(size_type n) {
@@ -434,6 +464,9 @@ private:
     AllocatorType allocator_;
 };
 
+template <typename ElementType, typename AllocatorType>
+struct TriviallyRelocatable<Array<ElementType, AllocatorType>> : TriviallyRelocatable<AllocatorType> {};
+
 template <typename ElementType, typename AllocatorType>
 inline constexpr bool operator==(const Array<ElementType, AllocatorType>& lhs,
                                  const Array<ElementType, AllocatorType>& rhs) {
@@ -2,6 +2,7 @@
 
 #include "licht/core/containers/array.hpp"
 #include "licht/core/containers/fixed_array.hpp"
+#include "licht/core/containers/inline_array.hpp"
 #include "licht/core/defines.hpp"
 #include "licht/core/memory/concepts.hpp"
 
@@ -131,6 +132,10 @@ public:
     ArrayView(const Array<ElementType, AllocatorType>& array)
         : data_(const_cast<ElementType*>(array.data())), size_(array.size()) {}
 
+    template <size_type InlineCapacity, CTypedAllocator<ElementType> AllocatorType>
+    ArrayView(const InlineArray<ElementType, InlineCapacity, AllocatorType>& array)
+        : data_(const_cast<ElementType*>(array.data())), size_(array.size()) {}
+
     template <size_type Capacity>
     ArrayView(FixedArray<ElementType, Capacity> array)
         : data_(array.data()), size_(array.size()) {}
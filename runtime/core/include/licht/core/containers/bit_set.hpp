@@ -0,0 +1,596 @@
+#pragma once
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/defines.hpp"
+#include "licht/core/memory/memory.hpp"
+
+#include <bit>
+#include <limits>
+
+#if defined(__AVX2__)
+#define LICHT_BIT_SET_AVX2 1
+#include <immintrin.h>
+#else
+#define LICHT_BIT_SET_AVX2 0
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LICHT_BIT_SET_SSE2 1
+#include <emmintrin.h>
+#else
+#define LICHT_BIT_SET_SSE2 0
+#endif
+
+namespace licht {
+
+namespace internal {
+
+/**
+ * @brief Word level operations shared by `BitSet` and `DynamicBitSet`.
+ *
+ * Bitwise operations and zero scans go through 256-bit (AVX2) or 128-bit (SSE2) lanes when available,
+ * the remaining words one by one. Population counts rely on `std::popcount`, i.e. `popcnt` when enabled.
+ */
+inline constexpr size_t bit_set_word_bits = 64;
+
+inline constexpr size_t bit_set_word_count(size_t bits) {
+    return (bits + bit_set_word_bits - 1) / bit_set_word_bits;
+}
+
+/**
+ * @brief Mask of the bits in use in the last word, all ones when it is full.
+ */
+inline constexpr uint64 bit_set_last_word_mask(size_t bits) {
+    const size_t used = bits % bit_set_word_bits;
+    return used == 0 ? ~uint64(0) : (uint64(1) << used) - 1;
+}
+
+enum class BitSetOperation : uint8 {
+    And,
+    Or,
+    AndNot,  // destination & ~source
+};
+
+template <BitSetOperation Operation>
+inline uint64 bit_set_apply_word(uint64 destination, uint64 source) {
+    if constexpr (Operation == BitSetOperation::And) {
+        return destination & source;
+    } else if constexpr (Operation == BitSetOperation::Or) {
+        return destination | source;
+    } else {
+        return destination & ~source;
+    }
+}
+
+#if LICHT_BIT_SET_SSE2
+template <BitSetOperation Operation>
+inline __m128i bit_set_apply_lane(__m128i destination, __m128i source) {
+    if constexpr (Operation == BitSetOperation::And) {
+        return _mm_and_si128(destination, source);
+    } else if constexpr (Operation == BitSetOperation::Or) {
+        return _mm_or_si128(destination, source);
+    } else {
+        return _mm_andnot_si128(source, destination);
+    }
+}
+#endif
+
+#if LICHT_BIT_SET_AVX2
+template <BitSetOperation Operation>
+inline __m256i bit_set_apply_lane(__m256i destination, __m256i source) {
+    if constexpr (Operation == BitSetOperation::And) {
+        return _mm256_and_si256(destination, source);
+    } else if constexpr (Operation == BitSetOperation::Or) {
+        return _mm256_or_si256(destination, source);
+    } else {
+        return _mm256_andnot_si256(source, destination);
+    }
+}
+#endif
+
+template <BitSetOperation Operation>
+inline void bit_set_apply(uint64* destination, const uint64* source, size_t count) {
+    size_t i = 0;
+#if LICHT_BIT_SET_AVX2
+    for (; i + 4 <= count; i += 4) {
+        __m256i* lane = reinterpret_cast<__m256i*>(destination + i);
+        const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i));
+        _mm256_storeu_si256(lane, bit_set_apply_lane<Operation>(_mm256_loadu_si256(lane), value));
+    }
+#endif
+#if LICHT_BIT_SET_SSE2
+    for (; i + 2 <= count; i += 2) {
+        __m128i* lane = reinterpret_cast<__m128i*>(destination + i);
+        const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+        _mm_storeu_si128(lane, bit_set_apply_lane<Operation>(_mm_loadu_si128(lane), value));
+    }
+#endif
+    for (; i < count; i++) {
+        destination[i] = bit_set_apply_word<Operation>(destination[i], source[i]);
+    }
+}
+
+inline void bit_set_and(uint64* destination, const uint64* source, size_t count) {
+    bit_set_apply<BitSetOperation::And>(destination, source, count);
+}
+
+inline void bit_set_or(uint64* destination, const uint64* source, size_t count) {
+    bit_set_apply<BitSetOperation::Or>(destination, source, count);
+}
+
+/**
+ * @brief `destination &= ~source`.
+ */
+inline void bit_set_and_not(uint64* destination, const uint64* source, size_t count) {
+    bit_set_apply<BitSetOperation::AndNot>(destination, source, count);
+}
+
+inline size_t bit_set_popcount(const uint64* words, size_t count) {
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++) {
+        total += static_cast<size_t>(std::popcount(words[i]));
+    }
+    return total;
+}
+
+/**
+ * @brief Index of the first non-zero word at or after `begin`, `count` if there is none.
+ * Runs of empty words are skipped a lane at a time, which is what makes sparse sets cheap to scan.
+ */
+inline size_t bit_set_find_word(const uint64* words, size_t begin, size_t count) {
+    size_t i = begin;
+#if LICHT_BIT_SET_AVX2
+    for (; i + 4 <= count; i += 4) {
+        const __m256i lane = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words + i));
+        if (!_mm256_testz_si256(lane, lane)) {
+            break;
+        }
+    }
+#endif
+#if LICHT_BIT_SET_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 2 <= count; i += 2) {
+        const __m128i lane = _mm_loadu_si128(reinterpret_cast<const __m128i*>(words + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(lane, zero)) != 0xFFFF) {
+            break;
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        if (words[i] != 0) {
+            return i;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief Index of the first set bit at or after `begin`, `npos` if there is none.
+ */
+inline size_t bit_set_find_next(const uint64* words, size_t word_count, size_t begin) {
+    constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    size_t word_index = begin / bit_set_word_bits;
+    if (word_index >= word_count) {
+        return npos;
+    }
+
+    const uint64 first = words[word_index] & (~uint64(0) << (begin % bit_set_word_bits));
+    if (first != 0) {
+        return word_index * bit_set_word_bits + static_cast<size_t>(std::countr_zero(first));
+    }
+
+    word_index = bit_set_find_word(words, word_index + 1, word_count);
+    if (word_index == word_count) {
+        return npos;
+    }
+    return word_index * bit_set_word_bits + static_cast<size_t>(std::countr_zero(words[word_index]));
+}
+
+}  //namespace internal
+
+/**
+ * @brief Forward iterator over the indices of the set bits.
+ */
+class SetBitIterator {
+public:
+    using value_type = size_t;
+    using difference_type = std::ptrdiff_t;
+
+    inline size_t operator*() const {
+        return word_index_ * internal::bit_set_word_bits + static_cast<size_t>(std::countr_zero(current_));
+    }
+
+    inline SetBitIterator& operator++() {
+        current_ &= current_ - 1;
+        if (current_ == 0) {
+            advance(word_index_ + 1);
+        }
+        return *this;
+    }
+
+    inline bool operator==(const SetBitIterator& other) const {
+        return word_index_ == other.word_index_ && current_ == other.current_;
+    }
+
+    inline bool operator!=(const SetBitIterator& other) const {
+        return !(*this == other);
+    }
+
+public:
+    SetBitIterator(const uint64* words, size_t word_count, size_t word_index)
+        : words_(words)
+        , word_count_(word_count)
+        , word_index_(word_index)
+        , current_(0) {
+        advance(word_index);
+    }
+
+private:
+    inline void advance(size_t word_index) {
+        word_index_ = internal::bit_set_find_word(words_, word_index, word_count_);
+        current_ = word_index_ < word_count_ ? words_[word_index_] : 0;
+    }
+
+private:
+    const uint64* words_;
+    size_t word_count_;
+    size_t word_index_;
+    uint64 current_;
+};
+
+/**
+ * @brief Range of the set bits of a bit set, e.g. `for (size_t index : bits.set_bits())`.
+ */
+class SetBitRange {
+public:
+    SetBitIterator begin() const {
+        return SetBitIterator(words_, word_count_, 0);
+    }
+
+    SetBitIterator end() const {
+        return SetBitIterator(words_, word_count_, word_count_);
+    }
+
+public:
+    SetBitRange(const uint64* words, size_t word_count)
+        : words_(words)
+        , word_count_(word_count) {}
+
+private:
+    const uint64* words_;
+    size_t word_count_;
+};
+
+/**
+ * @brief Fixed-size set of `BitCount` bits stored inline.
+ */
+template <size_t BitCount>
+class BitSet {
+public:
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+    static constexpr size_t word_count = internal::bit_set_word_count(BitCount);
+
+public:
+    inline void set(size_t index) {
+        LCHECK_MSG(index < BitCount, "Bit index out of bounds.");
+        words_[index / internal::bit_set_word_bits] |= uint64(1) << (index % internal::bit_set_word_bits);
+    }
+
+    inline void set(size_t index, bool value) {
+        value ? set(index) : reset(index);
+    }
+
+    inline void reset(size_t index) {
+        LCHECK_MSG(index < BitCount, "Bit index out of bounds.");
+        words_[index / internal::bit_set_word_bits] &= ~(uint64(1) << (index % internal::bit_set_word_bits));
+    }
+
+    inline void flip(size_t index) {
+        LCHECK_MSG(index < BitCount, "Bit index out of bounds.");
+        words_[index / internal::bit_set_word_bits] ^= uint64(1) << (index % internal::bit_set_word_bits);
+    }
+
+    inline bool test(size_t index) const {
+        LCHECK_MSG(index < BitCount, "Bit index out of bounds.");
+        return (words_[index / internal::bit_set_word_bits] >> (index % internal::bit_set_word_bits)) & 1;
+    }
+
+    inline bool operator[](size_t index) const {
+        return test(index);
+    }
+
+    void set_all() {
+        for (size_t i = 0; i < word_count; i++) {
+            words_[i] = ~uint64(0);
+        }
+        words_[word_count - 1] &= internal::bit_set_last_word_mask(BitCount);
+    }
+
+    void reset_all() {
+        for (size_t i = 0; i < word_count; i++) {
+            words_[i] = 0;
+        }
+    }
+
+    size_t count() const {
+        return internal::bit_set_popcount(words_, word_count);
+    }
+
+    bool any() const {
+        return internal::bit_set_find_word(words_, 0, word_count) != word_count;
+    }
+
+    bool none() const {
+        return !any();
+    }
+
+    bool all() const {
+        return count() == BitCount;
+    }
+
+    /**
+     * @brief Index of the first set bit, `npos` if there is none.
+     */
+    size_t find_first() const {
+        return internal::bit_set_find_next(words_, word_count, 0);
+    }
+
+    /**
+     * @brief Index of the first set bit at or after `index`, `npos` if there is none.
+     */
+    size_t find_next(size_t index) const {
+        return internal::bit_set_find_next(words_, word_count, index);
+    }
+
+    SetBitRange set_bits() const {
+        return SetBitRange(words_, word_count);
+    }
+
+    /**
+     * @brief Calls `func(index)` for each set bit, in increasing order.
+     */
+    template <typename Func>
+    void for_each_set(Func&& func) const {
+        for (size_t i = 0; i < word_count; i++) {
+            for (uint64 word = words_[i]; word != 0; word &= word - 1) {
+                func(i * internal::bit_set_word_bits + static_cast<size_t>(std::countr_zero(word)));
+            }
+        }
+    }
+
+    BitSet& operator&=(const BitSet& other) {
+        internal::bit_set_and(words_, other.words_, word_count);
+        return *this;
+    }
+
+    BitSet& operator|=(const BitSet& other) {
+        internal::bit_set_or(words_, other.words_, word_count);
+        return *this;
+    }
+
+    /**
+     * @brief Clears the bits set in `other`.
+     */
+    BitSet& and_not(const BitSet& other) {
+        internal::bit_set_and_not(words_, other.words_, word_count);
+        return *this;
+    }
+
+    bool operator==(const BitSet& other) const {
+        return Memory::compare(words_, other.words_, sizeof(words_)) == 0;
+    }
+
+    bool operator!=(const BitSet& other) const {
+        return !(*this == other);
+    }
+
+    inline constexpr size_t size() const {
+        return BitCount;
+    }
+
+    inline const uint64* words() const {
+        return words_;
+    }
+
+public:
+    constexpr BitSet() = default;
+
+private:
+    uint64 words_[word_count] = {};
+};
+
+/**
+ * @brief Set of bits whose size is chosen at runtime.
+ *
+ * Bitwise operations between two sets require them to have the same size.
+ */
+class DynamicBitSet {
+public:
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+public:
+    inline void set(size_t index) {
+        LCHECK_MSG(index < size_, "Bit index out of bounds.");
+        words_.data()[index / internal::bit_set_word_bits] |= uint64(1) << (index % internal::bit_set_word_bits);
+    }
+
+    inline void set(size_t index, bool value) {
+        value ? set(index) : reset(index);
+    }
+
+    inline void reset(size_t index) {
+        LCHECK_MSG(index < size_, "Bit index out of bounds.");
+        words_.data()[index / internal::bit_set_word_bits] &= ~(uint64(1) << (index % internal::bit_set_word_bits));
+    }
+
+    inline void flip(size_t index) {
+        LCHECK_MSG(index < size_, "Bit index out of bounds.");
+        words_.data()[index / internal::bit_set_word_bits] ^= uint64(1) << (index % internal::bit_set_word_bits);
+    }
+
+    inline bool test(size_t index) const {
+        LCHECK_MSG(index < size_, "Bit index out of bounds.");
+        return (words_.data()[index / internal::bit_set_word_bits] >> (index % internal::bit_set_word_bits)) & 1;
+    }
+
+    inline bool operator[](size_t index) const {
+        return test(index);
+    }
+
+    void set_all() {
+        for (uint64& word : words_) {
+            word = ~uint64(0);
+        }
+        clear_unused_bits();
+    }
+
+    void reset_all() {
+        for (uint64& word : words_) {
+            word = 0;
+        }
+    }
+
+    size_t count() const {
+        return internal::bit_set_popcount(words_.data(), words_.size());
+    }
+
+    bool any() const {
+        return internal::bit_set_find_word(words_.data(), 0, words_.size()) != words_.size();
+    }
+
+    bool none() const {
+        return !any();
+    }
+
+    bool all() const {
+        return count() == size_;
+    }
+
+    /**
+     * @brief Index of the first set bit, `npos` if there is none.
+     */
+    size_t find_first() const {
+        return internal::bit_set_find_next(words_.data(), words_.size(), 0);
+    }
+
+    /**
+     * @brief Index of the first set bit at or after `index`, `npos` if there is none.
+     */
+    size_t find_next(size_t index) const {
+        return internal::bit_set_find_next(words_.data(), words_.size(), index);
+    }
+
+    SetBitRange set_bits() const {
+        return SetBitRange(words_.data(), words_.size());
+    }
+
+    /**
+     * @brief Calls `func(index)` for each set bit, in increasing order.
+     */
+    template <typename Func>
+    void for_each_set(Func&& func) const {
+        const uint64* words = words_.data();
+        const size_t word_count = words_.size();
+
+        for (size_t i = internal::bit_set_find_word(words, 0, word_count);
+             i < word_count;
+             i = internal::bit_set_find_word(words, i + 1, word_count)) {
+            for (uint64 word = words[i]; word != 0; word &= word - 1) {
+                func(i * internal::bit_set_word_bits + static_cast<size_t>(std::countr_zero(word)));
+            }
+        }
+    }
+
+    DynamicBitSet& operator&=(const DynamicBitSet& other) {
+        LCHECK_MSG(size_ == other.size_, "Bit sets of different sizes.");
+        internal::bit_set_and(words_.data(), other.words_.data(), words_.size());
+        return *this;
+    }
+
+    DynamicBitSet& operator|=(const DynamicBitSet& other) {
+        LCHECK_MSG(size_ == other.size_, "Bit sets of different sizes.");
+        internal::bit_set_or(words_.data(), other.words_.data(), words_.size());
+        return *this;
+    }
+
+    /**
+     * @brief Clears the bits set in `other`.
+     */
+    DynamicBitSet& and_not(const DynamicBitSet& other) {
+        LCHECK_MSG(size_ == other.size_, "Bit sets of different sizes.");
+        internal::bit_set_and_not(words_.data(), other.words_.data(), words_.size());
+        return *this;
+    }
+
+    bool operator==(const DynamicBitSet& other) const {
+        return size_ == other.size_ &&
+               Memory::compare(words_.data(), other.words_.data(), words_.size() * sizeof(uint64)) == 0;
+    }
+
+    bool operator!=(const DynamicBitSet& other) const {
+        return !(*this == other);
+    }
+
+    /**
+     * @brief Changes the number of bits, the new ones being set to `value`.
+     */
+    void resize(size_t size, bool value = false) {
+        const size_t old_size = size_;
+        if (value && size > old_size && old_size % internal::bit_set_word_bits != 0) {
+            words_.back() |= ~internal::bit_set_last_word_mask(old_size);
+        }
+
+        words_.resize(internal::bit_set_word_count(size), value ? ~uint64(0) : 0);
+        size_ = size;
+        clear_unused_bits();
+    }
+
+    void reserve(size_t size) {
+        words_.reserve(internal::bit_set_word_count(size));
+    }
+
+    void clear() {
+        words_.clear();
+        size_ = 0;
+    }
+
+    inline size_t size() const {
+        return size_;
+    }
+
+    inline bool empty() const {
+        return size_ == 0;
+    }
+
+    inline const uint64* words() const {
+        return words_.data();
+    }
+
+    inline size_t word_count() const {
+        return words_.size();
+    }
+
+public:
+    DynamicBitSet() = default;
+
+    explicit DynamicBitSet(size_t size, bool value = false) {
+        resize(size, value);
+    }
+
+private:
+    /**
+     * @brief Keeps the bits past `size_` at zero, which `count` and the scans rely on.
+     */
+    void clear_unused_bits() {
+        if (!words_.empty()) {
+            words_.back() &= internal::bit_set_last_word_mask(size_);
+        }
+    }
+
+private:
+    Array<uint64> words_;
+    size_t size_ = 0;
+};
+
+}  //namespace licht
@@ -0,0 +1,187 @@
+#pragma once
+
+#include "licht/core/defines.hpp"
+#include "licht/core/memory/memory.hpp"
+
+#include <bit>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LICHT_HASH_CONTROL_SSE2 1
+#include <emmintrin.h>
+#else
+#define LICHT_HASH_CONTROL_SSE2 0
+#endif
+
+namespace licht::internal {
+
+/**
+ * @brief Control byte of an open-addressing slot.
+ *
+ * A full slot stores the 7 low bits of the key hash (H2), so its byte is always positive.
+ * Empty and deleted slots have the sign bit set, which lets a group detect them with a single mask.
+ */
+using HashControl = int8;
+
+inline constexpr HashControl hash_control_empty = static_cast<HashControl>(-128);  // 0b10000000
+inline constexpr HashControl hash_control_deleted = static_cast<HashControl>(-2);  // 0b11111110
+
+inline constexpr bool hash_control_is_full(HashControl control) {
+    return control >= 0;
+}
+
+/**
+ * @brief Splits a mixed 64-bit hash into the probe start (H1) and the control tag (H2).
+ */
+inline constexpr size_t hash_h1(uint64 hash) {
+    return static_cast<size_t>(hash >> 7);
+}
+
+inline constexpr HashControl hash_h2(uint64 hash) {
+    return static_cast<HashControl>(hash & 0x7F);
+}
+
+/**
+ * @brief Bitmask over the slots of a group, iterated from the lowest matching slot.
+ *
+ * @tparam Shift log2 of the number of bits used per slot (0 for SSE2 movemask, 3 for SWAR bytes).
+ */
+template <typename MaskType, uint32 Shift>
+class HashControlMask {
+public:
+    constexpr explicit HashControlMask(MaskType mask)
+        : mask_(mask) {}
+
+    constexpr explicit operator bool() const {
+        return mask_ != 0;
+    }
+
+    constexpr uint32 lowest() const {
+        return static_cast<uint32>(std::countr_zero(mask_)) >> Shift;
+    }
+
+    constexpr HashControlMask& operator++() {
+        mask_ &= mask_ - 1;
+        return *this;
+    }
+
+    constexpr uint32 operator*() const {
+        return lowest();
+    }
+
+    constexpr HashControlMask begin() const {
+        return *this;
+    }
+
+    constexpr HashControlMask end() const {
+        return HashControlMask(0);
+    }
+
+    constexpr bool operator!=(const HashControlMask& other) const {
+        return mask_ != other.mask_;
+    }
+
+private:
+    MaskType mask_;
+};
+
+#if LICHT_HASH_CONTROL_SSE2
+
+/**
+ * @brief Scans 16 control bytes at once with SSE2 compares.
+ */
+class HashControlGroup {
+public:
+    static constexpr size_t width = 16;
+
+    using MaskType = HashControlMask<uint32, 0>;
+
+    explicit HashControlGroup(const HashControl* controls)
+        : controls_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(controls))) {}
+
+    MaskType match(HashControl h2) const {
+        const __m128i pattern = _mm_set1_epi8(h2);
+        return MaskType(static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(pattern, controls_))));
+    }
+
+    MaskType match_empty() const {
+        return match(hash_control_empty);
+    }
+
+    MaskType match_empty_or_deleted() const {
+        return MaskType(static_cast<uint32>(_mm_movemask_epi8(controls_)));
+    }
+
+private:
+    __m128i controls_;
+};
+
+#else
+
+/**
+ * @brief Portable fallback scanning 8 control bytes at once inside a 64-bit word.
+ * `match` may report false positives, which are filtered by the key comparison.
+ */
+class HashControlGroup {
+public:
+    static constexpr size_t width = 8;
+
+    using MaskType = HashControlMask<uint64, 3>;
+
+    explicit HashControlGroup(const HashControl* controls) {
+        Memory::copy(&controls_, controls, sizeof(controls_));
+    }
+
+    MaskType match(HashControl h2) const {
+        constexpr uint64 lsbs = 0x0101010101010101ULL;
+        constexpr uint64 msbs = 0x8080808080808080ULL;
+        const uint64 x = controls_ ^ (lsbs * static_cast<uint8>(h2));
+        return MaskType((x - lsbs) & ~x & msbs);
+    }
+
+    MaskType match_empty() const {
+        constexpr uint64 msbs = 0x8080808080808080ULL;
+        return MaskType((controls_ & ~(controls_ << 6)) & msbs);
+    }
+
+    MaskType match_empty_or_deleted() const {
+        constexpr uint64 msbs = 0x8080808080808080ULL;
+        return MaskType(controls_ & msbs);
+    }
+
+private:
+    uint64 controls_;
+};
+
+#endif
+
+/**
+ * @brief Triangular probe sequence over groups.
+ * With a power-of-two capacity it visits every group exactly once before wrapping.
+ */
+class HashProbeSequence {
+public:
+    HashProbeSequence(size_t hash, size_t mask)
+        : mask_(mask)
+        , offset_(hash & mask)
+        , index_(0) {}
+
+    size_t offset() const {
+        return offset_;
+    }
+
+    size_t offset(size_t i) const {
+        return (offset_ + i) & mask_;
+    }
+
+    void next() {
+        index_ += HashControlGroup::width;
+        offset_ = (offset_ + index_) & mask_;
+    }
+
+private:
+    size_t mask_;
+    size_t offset_;
+    size_t index_;
+};
+
+}  // namespace licht::internal
@@ -1,11 +1,13 @@
 #pragma once
 
+#include "licht/core/containers/hash_control_group.hpp"
 #include "licht/core/defines.hpp"
 #include "licht/core/hash/hasher.hpp"
 #include "licht/core/memory/default_allocator.hpp"
 #include "licht/core/memory/memory.hpp"
 
 #include <initializer_list>
+#include <type_traits>
 #include <utility>
 
 namespace licht {
@@ -26,69 +28,37 @@ struct HashMapEntry {
         , value(std::move(p_value)) {}
 };
 
-template <typename KeyType, typename ValueType>
-struct HashMapElement {
-    HashMapEntry<KeyType, ValueType> entry;
-    HashMapElement<KeyType, ValueType>* next = nullptr;
-    size_t hash = 0;
-
-    HashMapElement() = default;
-
-    HashMapElement(const KeyType& p_key, const ValueType& p_value, size_t p_hash)
-        : entry(p_key, p_value)
-        , next(nullptr)
-        , hash(p_hash) {}
-
-    HashMapElement(KeyType&& p_key, ValueType&& p_value, size_t p_hash)
-        : entry(std::move(p_key), std::move(p_value))
-        , next(nullptr)
-        , hash(p_hash) {}
-};
-
+/**
+ * @brief Open-addressing hash map storing its entries inline in a single slot array.
+ *
+ * Every slot has a one byte control tag holding 7 bits of the key hash.
+ * Lookups scan a whole group of control bytes with SIMD and only compare keys on tag matches,
+ * so a hit usually costs one control load and one slot load, with no per-entry allocation.
+ *
+ * Iterators and entry references are invalidated by any insertion that grows the table.
+ */
 template <typename KeyType,
           typename ValueType,
-          CTypedAllocator<HashMapElement<KeyType, ValueType>> AllocatorType = TypedDefaultAllocator<HashMapElement<KeyType, ValueType>>,
+          CTypedAllocator<HashMapEntry<KeyType, ValueType>> AllocatorType = TypedDefaultAllocator<HashMapEntry<KeyType, ValueType>>,
           typename HasherType = Hasher>
 class HashMap {
 public:
-    using ElementType = HashMapElement<KeyType, ValueType>;
     using EntryType = HashMapEntry<KeyType, ValueType>;
+    using GroupType = internal::HashControlGroup;
+    using ControlAllocatorType = typename AllocatorType::template rebind<internal::HashControl>::other;
 
 private:
     class _Iterator {
     public:
-        _Iterator(HashMap* map = nullptr, size_t bucket_index = 0, ElementType* elem = nullptr)
-            : map_(map), bucket_index_(bucket_index), elem_(elem) {}
+        _Iterator(HashMap* map = nullptr, size_t index = 0)
+            : map_(map), index_(index) {}
 
-        EntryType& operator*() const { return elem_->entry; }
+        EntryType& operator*() const { return map_->slots_[index_]; }
 
-        EntryType* operator->() const { return &elem_->entry; }
+        EntryType* operator->() const { return &map_->slots_[index_]; }
 
         _Iterator& operator++() {
-            if (!map_ || !elem_) {
-                // become end
-                bucket_index_ = map_ ? map_->capacity_ : 0;
-                elem_ = nullptr;
-                return *this;
-            }
-
-            if (elem_->next) {
-                elem_ = elem_->next;
-                return *this;
-            }
-
-            // find next non-empty bucket
-            ++bucket_index_;
-            while (bucket_index_ < map_->capacity_) {
-                if (map_->buckets_[bucket_index_]) {
-                    elem_ = map_->buckets_[bucket_index_];
-                    return *this;
-                }
-                ++bucket_index_;
-            }
-
-            // end
-            elem_ = nullptr;
+            index_ = map_->next_full_index(index_ + 1);
             return *this;
         }
 
@@ -99,48 +69,27 @@ private:
         }
 
         bool operator==(const _Iterator& other) const {
-            return map_ == other.map_ && bucket_index_ == other.bucket_index_ && elem_ == other.elem_;
+            return map_ == other.map_ && index_ == other.index_;
         }
 
         bool operator!=(const _Iterator& other) const { return !(*this == other); }
 
     private:
         HashMap* map_;
-        size_t bucket_index_;
-        ElementType* elem_;
+        size_t index_;
     };
 
     class _ConstIterator {
     public:
-        _ConstIterator(const HashMap* map = nullptr, size_t bucket_index = 0, const ElementType* elem = nullptr)
-            : map_(map), bucket_index_(bucket_index), elem_(elem) {}
+        _ConstIterator(const HashMap* map = nullptr, size_t index = 0)
+            : map_(map), index_(index) {}
 
-        const EntryType& operator*() const { return elem_->entry; }
+        const EntryType& operator*() const { return map_->slots_[index_]; }
 
-        const EntryType* operator->() const { return &elem_->entry; }
+        const EntryType* operator->() const { return &map_->slots_[index_]; }
 
         _ConstIterator& operator++() {
-            if (!map_ || !elem_) {
-                bucket_index_ = map_ ? map_->capacity_ : 0;
-                elem_ = nullptr;
-                return *this;
-            }
-
-            if (elem_->next) {
-                elem_ = elem_->next;
-                return *this;
-            }
-
-            ++bucket_index_;
-            while (bucket_index_ < map_->capacity_) {
-                if (map_->buckets_[bucket_index_]) {
-                    elem_ = map_->buckets_[bucket_index_];
-                    return *this;
-                }
-                ++bucket_index_;
-            }
-
-            elem_ = nullptr;
+            index_ = map_->next_full_index(index_ + 1);
             return *this;
         }
 
@@ -151,15 +100,14 @@ private:
         }
 
         bool operator==(const _ConstIterator& other) const {
-            return map_ == other.map_ && bucket_index_ == other.bucket_index_ && elem_ == other.elem_;
+            return map_ == other.map_ && index_ == other.index_;
         }
 
         bool operator!=(const _ConstIterator& other) const { return !(*this == other); }
 
     private:
         const HashMap* map_;
-        size_t bucket_index_;
-        const ElementType* elem_;
+        size_t index_;
     };
 
 public:
@@ -168,61 +116,59 @@ public:
 
 public:
     HashMap(size_t capacity = 8)
-        : size_(0)
-        , capacity_(capacity)
-        , buckets_(nullptr)
-        , allocator_() {
-        initialize_buckets();
+        : controls_(nullptr)
+        , slots_(nullptr)
+        , size_(0)
+        , capacity_(0)
+        , growth_left_(0)
+        , allocator_()
+        , control_allocator_() {
+        reserve(capacity);
     }
 
     HashMap(std::initializer_list<EntryType> init)
-        : size_(0)
-        , capacity_(8)
-        , buckets_(nullptr)
-        , allocator_() {
-        initialize_buckets();
+        : HashMap(init.size()) {
         for (const auto& e : init) {
             put(e.key, e.value);
         }
     }
 
     HashMap(const HashMap& other)
-        : size_(0)
-        , capacity_(other.capacity_)
-        , buckets_(nullptr)
-        , allocator_() {
-        initialize_buckets();
-
-        for (size_t i = 0; i < other.capacity_; ++i) {
-            ElementType* cur = other.buckets_[i];
-            ElementType** tail = &buckets_[i];
-            while (cur) {
-                ElementType* copy = allocator_.allocate(1);
-                copy->entry.key = cur->entry.key;
-                copy->entry.value = cur->entry.value;
-                copy->hash = cur->hash;
-                *tail = copy;
-                tail = &((*tail)->next);
-                cur = cur->next;
-                ++size_;
+        : HashMap(0) {
+        if (other.size_ == 0) {
+            return;
+        }
+
+        allocate_table(other.capacity_);
+        Memory::copy(controls_, other.controls_, control_count(capacity_));
+
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (internal::hash_control_is_full(controls_[i])) {
+                lplacement_new(slots_ + i) EntryType(other.slots_[i]);
             }
         }
+
+        size_ = other.size_;
+        growth_left_ = other.growth_left_;
     }
 
     HashMap(HashMap&& other) noexcept
-        : size_(other.size_)
+        : controls_(other.controls_)
+        , slots_(other.slots_)
+        , size_(other.size_)
         , capacity_(other.capacity_)
-        , buckets_(other.buckets_)
-        , allocator_(std::move(other.allocator_)) {
+        , growth_left_(other.growth_left_)
+        , allocator_(std::move(other.allocator_))
+        , control_allocator_(std::move(other.control_allocator_)) {
+        other.controls_ = nullptr;
+        other.slots_ = nullptr;
         other.size_ = 0;
         other.capacity_ = 0;
-        other.buckets_ = nullptr;
+        other.growth_left_ = 0;
     }
 
     ~HashMap() {
-        clear();
-        delete[] buckets_;
-        buckets_ = nullptr;
+        destroy_table();
     }
 
     HashMap& operator=(const HashMap& other) {
@@ -239,151 +185,150 @@ public:
         if (this == &other) {
             return *this;
         }
-        clear();
-        delete[] buckets_;
+
+        destroy_table();
+
         allocator_ = std::move(other.allocator_);
+        control_allocator_ = std::move(other.control_allocator_);
+        controls_ = other.controls_;
+        slots_ = other.slots_;
         size_ = other.size_;
         capacity_ = other.capacity_;
-        buckets_ = other.buckets_;
+        growth_left_ = other.growth_left_;
+
+        other.controls_ = nullptr;
+        other.slots_ = nullptr;
         other.size_ = 0;
         other.capacity_ = 0;
-        other.buckets_ = nullptr;
+        other.growth_left_ = 0;
         return *this;
     }
 
     void remove(const KeyType& key) {
-        if (!buckets_) {
-            return;
-        }
-        size_t h = hash(key);
-        size_t idx = static_cast<size_t>(h % capacity_);
-
-        ElementType* cur = buckets_[idx];
-        ElementType* prev = nullptr;
-        while (cur) {
-            if (cur->entry.key == key) {
-                if (prev) {
-                    prev->next = cur->next;
-                } else {
-                    buckets_[idx] = cur->next;
-                }
-                allocator_.deallocate(cur, 1);
-                --size_;
-                return;
-            }
-            prev = cur;
-            cur = cur->next;
-        }
+        remove_at(find_index(key));
     }
 
     EntryType& put(const KeyType& key, const ValueType& value) {
-        if (!buckets_) {
-            initialize_buckets();
+        auto [index, inserted] = find_or_prepare_insert(key);
+        if (inserted) {
+            lplacement_new(slots_ + index) EntryType(key, value);
+        } else {
+            slots_[index].value = value;
         }
+        return slots_[index];
+    }
 
-        if (static_cast<float64>(size_ + 1) > static_cast<float64>(capacity_) * load_factor_) {
-            resize_rehash(capacity_ * 2);
+    EntryType& put(KeyType&& key, ValueType&& value) {
+        auto [index, inserted] = find_or_prepare_insert(key);
+        if (inserted) {
+            lplacement_new(slots_ + index) EntryType(std::move(key), std::move(value));
+        } else {
+            slots_[index].value = std::move(value);
         }
-
-        size_t h = hash(key);
-        size_t idx = static_cast<size_t>(h % capacity_);
-
-        ElementType* cur = buckets_[idx];
-        while (cur) {
-            if (cur->entry.key == key) {
-                cur->entry.value = value;
-                return cur->entry;
-            }
-            cur = cur->next;
-        }
-
-        ElementType* ne = create_element(key, value, h);
-        ne->next = buckets_[idx];
-        buckets_[idx] = ne;
-        ++size_;
-        return ne->entry;
+        return slots_[index];
     }
 
     _Iterator find(const KeyType& key) {
-        if (!buckets_) {
-            return end();
-        }
-        size_t h = hash(key);
-        size_t idx = static_cast<size_t>(h % capacity_);
-        ElementType* cur = buckets_[idx];
-        while (cur) {
-            if (cur->entry.key == key) {
-                return _Iterator(this, idx, cur);
-            }
-            cur = cur->next;
-        }
-        return end();
+        return _Iterator(this, find_index(key));
     }
 
     _ConstIterator find(const KeyType& key) const {
-        if (!buckets_) {
-            return end();
-        }
-        size_t h = hash(key);
-        size_t idx = static_cast<size_t>(h % capacity_);
-        ElementType* cur = buckets_[idx];
-        while (cur) {
-            if (cur->entry.key == key) {
-                return _ConstIterator(this, idx, cur);
-            }
-            cur = cur->next;
-        }
-        return end();
+        return _ConstIterator(this, find_index(key));
     }
 
     bool contains(const KeyType& key) const {
-        return find_element(key) != nullptr;
+        return find_index(key) != capacity_;
+    }
+
+    /**
+     * Heterogeneous lookups: query with a key type declared compatible through `HashTransparentKey`
+     * (e.g. a `StringRef` on a `String` keyed map) without constructing a `KeyType`.
+     */
+    template <CHashTransparentKey<KeyType> LookupKeyType>
+    _Iterator find(const LookupKeyType& key) {
+        return _Iterator(this, find_index(key));
+    }
+
+    template <CHashTransparentKey<KeyType> LookupKeyType>
+    _ConstIterator find(const LookupKeyType& key) const {
+        return _ConstIterator(this, find_index(key));
+    }
+
+    template <CHashTransparentKey<KeyType> LookupKeyType>
+    bool contains(const LookupKeyType& key) const {
+        return find_index(key) != capacity_;
+    }
+
+    template <CHashTransparentKey<KeyType> LookupKeyType>
+    ValueType& get(const LookupKeyType& key) {
+        size_t index = find_index(key);
+        LCHECK_MSG(index != capacity_, "HashMap: key not found");
+        return slots_[index].value;
+    }
+
+    template <CHashTransparentKey<KeyType> LookupKeyType>
+    const ValueType& get(const LookupKeyType& key) const {
+        size_t index = find_index(key);
+        LCHECK_MSG(index != capacity_, "HashMap: key not found");
+        return slots_[index].value;
+    }
+
+    template <CHashTransparentKey<KeyType> LookupKeyType>
+    ValueType* get_ptr(const LookupKeyType& key) {
+        size_t index = find_index(key);
+        return index != capacity_ ? &slots_[index].value : nullptr;
+    }
+
+    template <CHashTransparentKey<KeyType> LookupKeyType>
+    const ValueType* get_ptr(const LookupKeyType& key) const {
+        size_t index = find_index(key);
+        return index != capacity_ ? &slots_[index].value : nullptr;
+    }
+
+    template <CHashTransparentKey<KeyType> LookupKeyType>
+    void remove(const LookupKeyType& key) {
+        remove_at(find_index(key));
     }
 
     ValueType& get(const KeyType& key) {
-        ElementType* e = find_element(key);
-        LCHECK_MSG(e, "HashMap: key not found");
-        return e->entry.value;
+        size_t index = find_index(key);
+        LCHECK_MSG(index != capacity_, "HashMap: key not found");
+        return slots_[index].value;
     }
 
     ValueType* get_ptr(const KeyType& key) {
-        ElementType* e = find_element(key);
-        return e ? &e->entry.value : nullptr;
+        size_t index = find_index(key);
+        return index != capacity_ ? &slots_[index].value : nullptr;
     }
 
     ValueType& get_or_add(const KeyType& key, const ValueType& value) {
-        auto* cvalue = get_ptr(key);
-        if (cvalue) {
-            return *cvalue;
+        auto [index, inserted] = find_or_prepare_insert(key);
+        if (inserted) {
+            lplacement_new(slots_ + index) EntryType(key, value);
         }
-        return put(key, value).value;
+        return slots_[index].value;
     }
 
     const ValueType& get(const KeyType& key) const {
-        const ElementType* e = find_element(key);
-        LCHECK_MSG(e, "HashMap: key not found");
-        return e->entry.value;
+        size_t index = find_index(key);
+        LCHECK_MSG(index != capacity_, "HashMap: key not found");
+        return slots_[index].value;
     }
 
     const ValueType* get_ptr(const KeyType& key) const {
-        const ElementType* e = find_element(key);
-        return e ? &e->entry.value : nullptr;
+        size_t index = find_index(key);
+        return index != capacity_ ? &slots_[index].value : nullptr;
     }
 
     void clear() {
-        if (!buckets_) {
+        if (!controls_) {
             return;
         }
-        for (size_t i = 0; i < size_; ++i) {
-            ElementType* cur = buckets_[i];
-            while (cur) {
-                ElementType* next = cur->next;
-                allocator_.deallocate(cur, 1);
-                cur = next;
-            }
-            buckets_[i] = nullptr;
-        }
+
+        destroy_entries();
+        Memory::write(controls_, static_cast<uint8>(internal::hash_control_empty), control_count(capacity_));
         size_ = 0;
+        growth_left_ = max_load(capacity_);
     }
 
     bool empty() const {
@@ -403,44 +348,27 @@ public:
     }
 
     ValueType& operator[](const KeyType& key) {
-        ElementType* e = find_element(key);
-        if (e) {
-            return e->entry.value;
+        auto [index, inserted] = find_or_prepare_insert(key);
+        if (inserted) {
+            lplacement_new(slots_ + index) EntryType(key, ValueType{});
         }
-        EntryType& ent = put(key, ValueType{});
-        return ent.value;
+        return slots_[index].value;
     }
 
     _Iterator begin() {
-        if (!buckets_) {
-            return end();
-        }
-        for (size_t i = 0; i < capacity_; ++i) {
-            if (buckets_[i]) {
-                return _Iterator(this, i, buckets_[i]);
-            }
-        }
-        return end();
+        return _Iterator(this, next_full_index(0));
     }
 
     _Iterator end() {
-        return _Iterator(this, capacity_, nullptr);
+        return _Iterator(this, capacity_);
     }
 
     _ConstIterator begin() const {
-        if (!buckets_) {
-            return end();
-        }
-        for (size_t i = 0; i < capacity_; ++i) {
-            if (buckets_[i]) {
-                return _ConstIterator(this, i, buckets_[i]);
-            }
-        }
-        return end();
+        return _ConstIterator(this, next_full_index(0));
     }
 
     _ConstIterator end() const {
-        return _ConstIterator(this, capacity_, nullptr);
+        return _ConstIterator(this, capacity_);
     }
 
     _ConstIterator cbegin() const {
@@ -451,79 +379,251 @@ public:
         return end();
     }
 
+    /**
+     * @brief Makes room for at least `count` entries without further rehashing.
+     */
+    void reserve(size_t count) {
+        if (count == 0) {
+            return;
+        }
+
+        size_t new_capacity = capacity_for(count);
+        if (new_capacity > capacity_) {
+            resize_rehash(new_capacity);
+        }
+    }
+
+    /**
+     * @brief Rebuilds the table at the same capacity, dropping every tombstone left by `remove`.
+     */
     void rehash() {
+        if (!controls_) {
+            return;
+        }
         resize_rehash(capacity_);
     }
 
     void resize_rehash(size_t new_capacity) {
-        if (new_capacity == 0) {
-            return;
+        new_capacity = capacity_round_up(new_capacity);
+        if (new_capacity == 0 || max_load(new_capacity) < size_) {
+            new_capacity = capacity_for(size_);
         }
 
-        ElementType** new_buckets = new ElementType*[new_capacity];
-        Memory::write(new_buckets, 0, sizeof(ElementType*) * new_capacity);
+        internal::HashControl* old_controls = controls_;
+        EntryType* old_slots = slots_;
+        size_t old_capacity = capacity_;
 
-        for (size_t i = 0; i < capacity_; ++i) {
-            ElementType* cur = buckets_[i];
-            while (cur) {
-                ElementType* next = cur->next;
-                size_t idx = static_cast<size_t>(cur->hash % new_capacity);
-                cur->next = new_buckets[idx];
-                new_buckets[idx] = cur;
-                cur = next;
+        allocate_table(new_capacity);
+        growth_left_ = max_load(capacity_) - size_;
+
+        for (size_t i = 0; i < old_capacity; ++i) {
+            if (!internal::hash_control_is_full(old_controls[i])) {
+                continue;
             }
+
+            uint64 h = hash(old_slots[i].key);
+            size_t index = find_first_non_full(h);
+            set_control(index, internal::hash_h2(h));
+            lplacement_new(slots_ + index) EntryType(std::move(old_slots[i]));
+            old_slots[i].~EntryType();
         }
 
-        delete[] buckets_;
-        buckets_ = new_buckets;
-        capacity_ = new_capacity;
+        if (old_controls) {
+            control_allocator_.deallocate(old_controls, control_count(old_capacity));
+            allocator_.deallocate(old_slots, old_capacity);
+        }
     }
 
 private:
-    ElementType* find_element(const KeyType& key) const {
-        if (!buckets_) {
-            return nullptr;
-        }
-        size_t h = hash(key);
-        size_t idx = static_cast<size_t>(h % capacity_);
-        ElementType* cur = buckets_[idx];
-        while (cur) {
-            if (cur->entry.key == key) {
-                return cur;
+    static constexpr size_t control_count(size_t capacity) {
+        return capacity + GroupType::width;
+    }
+
+    /**
+     * Keeps one slot out of eight empty so that every probe sequence terminates on an empty control byte.
+     */
+    static constexpr size_t max_load(size_t capacity) {
+        return capacity - capacity / 8;
+    }
+
+    static constexpr size_t capacity_round_up(size_t capacity) {
+        if (capacity == 0) {
+            return 0;
+        }
+
+        size_t rounded = GroupType::width;
+        while (rounded < capacity) {
+            rounded *= 2;
+        }
+        return rounded;
+    }
+
+    static constexpr size_t capacity_for(size_t count) {
+        size_t capacity = GroupType::width;
+        while (max_load(capacity) < count) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    template <typename LookupKeyType>
+    uint64 hash(const LookupKeyType& key) const {
+        return Hasher::mix(static_cast<uint64>(HasherType::hash(key)));
+    }
+
+    template <typename LookupKeyType>
+    size_t find_index(const LookupKeyType& key) const {
+        if (size_ == 0) {
+            return capacity_;
+        }
+
+        uint64 h = hash(key);
+        internal::HashControl h2 = internal::hash_h2(h);
+        internal::HashProbeSequence sequence(internal::hash_h1(h), capacity_ - 1);
+
+        while (true) {
+            GroupType group(controls_ + sequence.offset());
+            for (uint32 i : group.match(h2)) {
+                size_t index = sequence.offset(i);
+                if (slots_[index].key == key) {
+                    return index;
+                }
             }
-            cur = cur->next;
+
+            if (group.match_empty()) {
+                return capacity_;
+            }
+
+            sequence.next();
         }
-        return nullptr;
     }
 
-    ElementType* create_element(const KeyType& key, const ValueType& value, size_t h) {
-        ElementType* raw = allocator_.allocate(1);
-        ElementType* element = new (raw) ElementType(key, value, h);
-        return element;
+    size_t find_first_non_full(uint64 h) const {
+        internal::HashProbeSequence sequence(internal::hash_h1(h), capacity_ - 1);
+
+        while (true) {
+            GroupType group(controls_ + sequence.offset());
+            auto mask = group.match_empty_or_deleted();
+            if (mask) {
+                return sequence.offset(mask.lowest());
+            }
+
+            sequence.next();
+        }
+    }
+
+    /**
+     * Returns the slot holding `key`, or claims a free slot for it and marks it full.
+     * The caller must construct the entry in a claimed slot.
+     */
+    std::pair<size_t, bool> find_or_prepare_insert(const KeyType& key) {
+        size_t found = find_index(key);
+        if (found != capacity_) {
+            return {found, false};
+        }
+
+        if (capacity_ == 0) {
+            resize_rehash(GroupType::width);
+        }
+
+        uint64 h = hash(key);
+        size_t index = find_first_non_full(h);
+
+        if (growth_left_ == 0 && controls_[index] != internal::hash_control_deleted) {
+            // Mostly tombstones: rebuild in place, otherwise double.
+            resize_rehash(size_ * 2 <= max_load(capacity_) ? capacity_ : capacity_ * 2);
+            index = find_first_non_full(h);
+        }
+
+        if (controls_[index] == internal::hash_control_empty) {
+            --growth_left_;
+        }
+
+        set_control(index, internal::hash_h2(h));
+        ++size_;
+        return {index, true};
+    }
+
+    void remove_at(size_t index) {
+        if (index == capacity_) {
+            return;
+        }
+
+        slots_[index].~EntryType();
+        set_control(index, internal::hash_control_deleted);
+        --size_;
+    }
+
+    size_t next_full_index(size_t index) const {
+        while (index < capacity_ && !internal::hash_control_is_full(controls_[index])) {
+            ++index;
+        }
+        return index;
+    }
+
+    /**
+     * The first group width control bytes are mirrored after the last slot,
+     * so a group load starting near the end of the table wraps around without a branch.
+     */
+    void set_control(size_t index, internal::HashControl control) {
+        controls_[index] = control;
+        if (index < GroupType::width) {
+            controls_[capacity_ + index] = control;
+        }
+    }
+
+    void allocate_table(size_t capacity) {
+        capacity_ = capacity;
+        controls_ = control_allocator_.allocate(control_count(capacity_));
+        slots_ = allocator_.allocate(capacity_);
+        LCHECK(controls_ && slots_);
+        Memory::write(controls_, static_cast<uint8>(internal::hash_control_empty), control_count(capacity_));
     }
 
-    size_t hash(const KeyType& key) const {
-        return std::hash<KeyType>{}(key);
+    void destroy_entries() {
+        if constexpr (!std::is_trivially_destructible_v<EntryType>) {
+            for (size_t i = 0; i < capacity_; ++i) {
+                if (internal::hash_control_is_full(controls_[i])) {
+                    slots_[i].~EntryType();
+                }
+            }
+        }
     }
 
-    void initialize_buckets() {
-        buckets_ = new ElementType*[capacity_];
-        Memory::write(buckets_, 0, sizeof(ElementType*) * capacity_);
+    void destroy_table() {
+        if (!controls_) {
+            return;
+        }
+
+        destroy_entries();
+        control_allocator_.deallocate(controls_, control_count(capacity_));
+        allocator_.deallocate(slots_, capacity_);
+
+        controls_ = nullptr;
+        slots_ = nullptr;
+        size_ = 0;
+        capacity_ = 0;
+        growth_left_ = 0;
     }
 
     void swap(HashMap& other) noexcept {
-        std::swap(buckets_, other.buckets_);
+        std::swap(controls_, other.controls_);
+        std::swap(slots_, other.slots_);
         std::swap(size_, other.size_);
         std::swap(capacity_, other.capacity_);
+        std::swap(growth_left_, other.growth_left_);
         std::swap(allocator_, other.allocator_);
+        std::swap(control_allocator_, other.control_allocator_);
     }
 
 private:
-    ElementType** buckets_;
+    internal::HashControl* controls_;
+    EntryType* slots_;
+    size_t size_;
+    size_t capacity_;
+    size_t growth_left_;
     AllocatorType allocator_;
-    size_t size_ = 0;
-    size_t capacity_ = 1;
-    static constexpr float64 load_factor_ = 0.75;
+    ControlAllocatorType control_allocator_;
 };
 
 }  // namespace licht
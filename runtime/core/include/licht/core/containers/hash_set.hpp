@@ -296,30 +296,7 @@ public:
     }
 
     size_t remove(const KeyType& key) {
-        if (!buckets_) {
-            return 0;
-        }
-        size_t h = hash(key);
-        size_t idx = static_cast<size_t>(h % capacity_);
-
-        ElementType* cur = buckets_[idx];
-        ElementType* prev = nullptr;
-        while (cur) {
-            if (cur->key == key) {
-                if (prev) {
-                    prev->next = cur->next;
-                } else {
-                    buckets_[idx] = cur->next;
-                }
-                cur->~ElementType();
-                allocator_.deallocate(cur, 1);
-                --size_;
-                return 1;
-            }
-            prev = cur;
-            cur = cur->next;
-        }
-        return 0;
+        return remove_element(key);
     }
 
     Iterator find(const KeyType& key) {
@@ -358,6 +335,35 @@ public:
         return find_element(key) != nullptr;
     }
 
+    /**
+     * Heterogeneous lookups: query with a key type declared compatible through `HashTransparentKey`
+     * without constructing a `KeyType`.
+     */
+    template <CHashTransparentKey<KeyType> LookupKeyType>
+    Iterator find(const LookupKeyType& key) {
+        size_t index = 0;
+        ElementType* element = find_element(key, index);
+        return element ? Iterator(this, index, element) : end();
+    }
+
+    template <CHashTransparentKey<KeyType> LookupKeyType>
+    ConstIterator find(const LookupKeyType& key) const {
+        size_t index = 0;
+        const ElementType* element = find_element(key, index);
+        return element ? ConstIterator(this, index, element) : end();
+    }
+
+    template <CHashTransparentKey<KeyType> LookupKeyType>
+    bool contains(const LookupKeyType& key) const {
+        size_t index = 0;
+        return find_element(key, index) != nullptr;
+    }
+
+    template <CHashTransparentKey<KeyType> LookupKeyType>
+    size_t remove(const LookupKeyType& key) {
+        return remove_element(key);
+    }
+
     void clear() {
         if (!buckets_) {
             return;
@@ -459,12 +465,18 @@ public:
 
 private:
     ElementType* find_element(const KeyType& key) const {
+        size_t index = 0;
+        return find_element(key, index);
+    }
+
+    template <typename LookupKeyType>
+    ElementType* find_element(const LookupKeyType& key, size_t& index) const {
         if (!buckets_) {
             return nullptr;
         }
         size_t h = hash(key);
-        size_t idx = static_cast<size_t>(h % capacity_);
-        ElementType* cur = buckets_[idx];
+        index = static_cast<size_t>(h % capacity_);
+        ElementType* cur = buckets_[index];
         while (cur) {
             if (cur->key == key) {
                 return cur;
@@ -474,6 +486,34 @@ private:
         return nullptr;
     }
 
+    template <typename LookupKeyType>
+    size_t remove_element(const LookupKeyType& key) {
+        if (!buckets_) {
+            return 0;
+        }
+        size_t h = hash(key);
+        size_t idx = static_cast<size_t>(h % capacity_);
+
+        ElementType* cur = buckets_[idx];
+        ElementType* prev = nullptr;
+        while (cur) {
+            if (cur->key == key) {
+                if (prev) {
+                    prev->next = cur->next;
+                } else {
+                    buckets_[idx] = cur->next;
+                }
+                cur->~ElementType();
+                allocator_.deallocate(cur, 1);
+                --size_;
+                return 1;
+            }
+            prev = cur;
+            cur = cur->next;
+        }
+        return 0;
+    }
+
     ElementType* create_element(const KeyType& key, size_t h) {
         ElementType* raw = allocator_.allocate(1);
         ElementType* element = lplacement_new(raw) ElementType(key, h);
@@ -486,8 +526,9 @@ private:
         return element;
     }
 
-    size_t hash(const KeyType& key) const {
-        return std::hash<KeyType>{}(key);
+    template <typename LookupKeyType>
+    size_t hash(const LookupKeyType& key) const {
+        return static_cast<size_t>(HasherType::hash(key));
     }
 
     void initialize_buckets() {
@@ -0,0 +1,487 @@
+#pragma once
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/defines.hpp"
+#include "licht/core/memory/concepts.hpp"
+#include "licht/core/memory/default_allocator.hpp"
+#include "licht/core/memory/memory.hpp"
+
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace licht {
+
+/**
+ * @brief Array storing up to `InlineCapacity` elements inside the object itself.
+ *
+ * Nothing is allocated until the array grows past `InlineCapacity`, at which point the elements
+ * are moved to the heap like an `Array`. Meant for short-lived arrays on hot paths that almost
+ * always hold a handful of elements, e.g. the handles gathered to record a command.
+ *
+ * Unlike `Array`, moving an inline array moves each element, and its data pointer changes when it is moved.
+ */
+template <typename ElementType,
+          size_t InlineCapacity,
+          CTypedAllocator<ElementType> AllocatorType = TypedDefaultAllocator<ElementType>>
+class InlineArray {
+    static_assert(InlineCapacity > 0, "InlineArray needs an inline capacity, use Array otherwise.");
+
+public:
+    using IteratorType = ElementType*;
+
+    template <typename NewElement>
+    using ReboundAllocator = typename AllocatorType::template rebind<NewElement>::other;
+
+    using value_type = ElementType;
+    using size_type = size_t;
+    using reference = ElementType&;
+    using pointer = ElementType*;
+    using const_pointer = const ElementType*;
+    using const_reference = const ElementType&;
+    using iterator = ElementType*;
+    using const_iterator = const ElementType*;
+
+    static constexpr size_type inline_capacity = InlineCapacity;
+
+public:
+    template <typename OtherElementType = ElementType,
+              typename OtherAllocatorType = ReboundAllocator<OtherElementType>>
+    Array<OtherElementType, OtherAllocatorType> map(auto&& mapper,
+                                                    const OtherAllocatorType& other_allocator = OtherAllocatorType()) const {
+        Array<OtherElementType, OtherAllocatorType> other(size_, other_allocator);
+
+        for (size_type i = 0; i < size_; i++) {
+            other.append(mapper(data_[i]));
+        }
+
+        return other;
+    }
+
+    constexpr const_reference front() const {
+        LCHECK_MSG(!empty(), "Call front with an empty array.");
+        return data_[0];
+    }
+
+    constexpr reference front() {
+        LCHECK_MSG(!empty(), "Call front with an empty array.");
+        return data_[0];
+    }
+
+    constexpr const_reference back() const {
+        LCHECK_MSG(!empty(), "Call back with an empty array.");
+        return data_[size_ - 1];
+    }
+
+    constexpr reference back() {
+        LCHECK_MSG(!empty(), "Call back with an empty array.");
+        return data_[size_ - 1];
+    }
+
+    void append(const ElementType& element) {
+        emplace_back(element);
+    }
+
+    void append(ElementType&& element) {
+        emplace_back(std::move(element));
+    }
+
+    template <typename Container>
+    void append_all(const Container& container) {
+        for (const ElementType& element : container) {
+            append(element);
+        }
+    }
+
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        emplace_back(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Constructs an element in place at the end of the array.
+     * The arguments may refer to elements of the array itself, even when it has to grow.
+     *
+     * @return The new element.
+     */
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        if (size_ < capacity_) {
+            lplacement_new(data_ + size_) ElementType(std::forward<Args>(args)...);
+        } else {
+            // Built in the new storage before the old elements move out of the storage the arguments may live in.
+            const size_type new_capacity = capacity_ * 2;
+            ElementType* new_data = allocator_allocate(new_capacity);
+            lplacement_new(new_data + size_) ElementType(std::forward<Args>(args)...);
+            relocate(new_data, new_capacity);
+        }
+
+        return data_[size_++];
+    }
+
+    void pop() {
+        if (size_ > 0) {
+            --size_;
+            data_[size_].~ElementType();
+        }
+    }
+
+    inline constexpr ElementType& operator[](size_type index) {
+        LCHECK_MSG(index < size_, "Index out of bounds.");
+        return data_[index];
+    }
+
+    inline constexpr const ElementType& operator[](size_type index) const {
+        LCHECK_MSG(index < size_, "Index out of bounds.");
+        return data_[index];
+    }
+
+    inline constexpr size_type size() const {
+        return size_;
+    }
+
+    inline constexpr size_type capacity() const {
+        return capacity_;
+    }
+
+    inline constexpr bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @brief Whether the elements are still stored inside the array, i.e. it never needed the heap.
+     */
+    inline bool is_inline() const {
+        return data_ == inline_data();
+    }
+
+    constexpr void clear() {
+        for (size_type i = 0; i < size_; i++) {
+            data_[i].~ElementType();
+        }
+
+        size_ = 0;
+    }
+
+    void remove_if(auto&& predicate) {
+        size_type new_size = 0;
+
+        for (size_type i = 0; i < size_; ++i) {
+            if (!predicate(data_[i])) {
+                if (new_size != i) {
+                    data_[new_size] = std::move(data_[i]);
+                }
+                ++new_size;
+            }
+        }
+
+        for (size_type i = new_size; i < size_; ++i) {
+            data_[i].~ElementType();
+        }
+
+        size_ = new_size;
+    }
+
+    void remove(const ElementType& value) {
+        remove_if([&value](const ElementType& elem) -> bool { return (elem == value); });
+    }
+
+    void resize(size_type size, const ElementType& default_element = ElementType()) {
+        if (size > capacity_) {
+            reserve(size);
+        }
+
+        if (size > size_) {
+            for (size_type i = size_; i < size; i++) {
+                lplacement_new(data_ + i) ElementType(default_element);
+            }
+        } else {
+            for (size_type i = size; i < size_; i++) {
+                data_[i].~ElementType();
+            }
+        }
+
+        size_ = size;
+    }
+
+    void reserve(size_type capacity) {
+        if (capacity > capacity_) {
+            relocate(allocator_allocate(capacity), capacity);
+        }
+    }
+
+    /**
+     * @brief Releases the unused heap capacity, going back to the inline storage when the elements fit in it.
+     */
+    void shrink() {
+        if (is_inline() || size_ == capacity_) {
+            return;
+        }
+
+        if (size_ <= InlineCapacity) {
+            relocate(inline_data(), InlineCapacity);
+        } else {
+            relocate(allocator_allocate(size_), size_);
+        }
+    }
+
+    constexpr const ElementType* data() const {
+        return data_;
+    }
+
+    constexpr ElementType* data() {
+        return data_;
+    }
+
+    void push_back(const ElementType& element) {
+        emplace_back(element);
+    }
+
+    void push_back(ElementType&& element) {
+        emplace_back(std::move(element));
+    }
+
+    /**
+     * @brief Swaps the contents of both arrays. Heap blocks are exchanged, inline elements are moved.
+     */
+    void swap(InlineArray& other) noexcept {
+        if (this == &other) {
+            return;
+        }
+
+        if (!is_inline() && !other.is_inline()) {
+            std::swap(data_, other.data_);
+            std::swap(size_, other.size_);
+            std::swap(capacity_, other.capacity_);
+            std::swap(allocator_, other.allocator_);
+            return;
+        }
+
+        InlineArray temporary(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temporary);
+    }
+
+    template <typename Predicate>
+    ElementType* get_if(Predicate&& p_predicate) const {
+        for (size_type i = 0; i < size_; ++i) {
+            if (p_predicate(data_[i])) {
+                return &data_[i];
+            }
+        }
+        return nullptr;
+    }
+
+    bool contains(const ElementType& element) const {
+        for (size_type i = 0; i < size_; ++i) {
+            if (data_[i] == element) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool contains(const ElementType& element, auto&& predicate) const {
+        for (size_type i = 0; i < size_; ++i) {
+            if (predicate(data_[i], element)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+public:
+    InlineArray(const AllocatorType& allocator = AllocatorType()) noexcept
+        : data_(inline_data())
+        , size_(0)
+        , capacity_(InlineCapacity)
+        , allocator_(allocator) {
+    }
+
+    InlineArray(size_t capacity,
+                const AllocatorType& allocator = AllocatorType())
+        : InlineArray(allocator) {
+        reserve(capacity);
+    }
+
+    InlineArray(std::initializer_list<ElementType> init,
+                const AllocatorType& allocator = AllocatorType())
+        : InlineArray(allocator) {
+        reserve(init.size());
+        for (const ElementType& item : init) {
+            lplacement_new(data_ + size_++) ElementType(item);
+        }
+    }
+
+    InlineArray(const ElementType* elements,
+                size_type size,
+                const AllocatorType& allocator = AllocatorType())
+        : InlineArray(allocator) {
+        reserve(size);
+        for (size_type i = 0; i < size; i++) {
+            lplacement_new(data_ + size_++) ElementType(elements[i]);
+        }
+    }
+
+    InlineArray(const InlineArray& other)
+        : InlineArray(other.data_, other.size_, other.allocator_) {
+    }
+
+    InlineArray(InlineArray&& other) noexcept
+        : InlineArray(other.allocator_) {
+        steal(other);
+    }
+
+    ~InlineArray() {
+        clear();
+        if (!is_inline()) {
+            allocator_deallocate(data_, capacity_);
+        }
+    }
+
+    InlineArray& operator=(const InlineArray& other) {
+        if (this != &other) {
+            clear();
+            reserve(other.size_);
+            for (size_type i = 0; i < other.size_; i++) {
+                lplacement_new(data_ + size_++) ElementType(other.data_[i]);
+            }
+        }
+        return *this;
+    }
+
+    InlineArray& operator=(InlineArray&& other) noexcept {
+        if (this != &other) {
+            clear();
+            if (!is_inline()) {
+                allocator_deallocate(data_, capacity_);
+                data_ = inline_data();
+                capacity_ = InlineCapacity;
+            }
+
+            allocator_ = other.allocator_;
+            steal(other);
+        }
+        return *this;
+    }
+
+public:
+    IteratorType begin() {
+        return data_;
+    }
+
+    const_iterator begin() const {
+        return data_;
+    }
+
+    const_iterator cbegin() const {
+        return data_;
+    }
+
+    IteratorType end() {
+        return data_ + size_;
+    }
+
+    const_iterator end() const {
+        return data_ + size_;
+    }
+
+    const_iterator cend() const {
+        return data_ + size_;
+    }
+
+private:
+    ElementType* inline_data() {
+        return reinterpret_cast<ElementType*>(inline_storage_);
+    }
+
+    const ElementType* inline_data() const {
+        return reinterpret_cast<const ElementType*>(inline_storage_);
+    }
+
+    /**
+     * @brief Takes the elements of `other` into this empty, inline array.
+     * A heap block is taken over as is, inline elements are moved one by one.
+     */
+    void steal(InlineArray& other) {
+        if (other.is_inline()) {
+            for (size_type i = 0; i < other.size_; i++) {
+                lplacement_new(data_ + i) ElementType(std::move(other.data_[i]));
+            }
+            size_ = other.size_;
+            other.clear();
+            return;
+        }
+
+        data_ = other.data_;
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+
+        other.data_ = other.inline_data();
+        other.size_ = 0;
+        other.capacity_ = InlineCapacity;
+    }
+
+    void relocate(ElementType* new_data, size_type new_capacity) {
+        for (size_type i = 0; i < size_; i++) {
+            lplacement_new(new_data + i) ElementType(std::move(data_[i]));
+            data_[i].~ElementType();
+        }
+
+        if (!is_inline()) {
+            allocator_deallocate(data_, capacity_);
+        }
+
+        data_ = new_data;
+        capacity_ = new_capacity;
+    }
+
+    ElementType* allocator_allocate(size_type n) {
+        ElementType* elements = allocator_.allocate(n);
+        LCHECK(elements);
+        return elements;
+    }
+
+    void allocator_deallocate(ElementType* p, size_type n) {
+        if (p) {
+            allocator_.deallocate(p, n);
+        }
+    }
+
+private:
+    ElementType* data_;
+    size_type size_;
+    size_type capacity_;
+    AllocatorType allocator_;
+    alignas(ElementType) uint8 inline_storage_[sizeof(ElementType) * InlineCapacity];
+};
+
+template <typename ElementType, size_t InlineCapacity, typename AllocatorType>
+inline constexpr bool operator==(const InlineArray<ElementType, InlineCapacity, AllocatorType>& lhs,
+                                 const InlineArray<ElementType, InlineCapacity, AllocatorType>& rhs) {
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+
+    for (size_t i = 0; i < lhs.size(); i++) {
+        if (lhs[i] != rhs[i]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename ElementType, size_t InlineCapacity, typename AllocatorType>
+inline constexpr bool operator!=(const InlineArray<ElementType, InlineCapacity, AllocatorType>& lhs,
+                                 const InlineArray<ElementType, InlineCapacity, AllocatorType>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename ElementType, size_t InlineCapacity, typename AllocatorType>
+inline constexpr void swap(InlineArray<ElementType, InlineCapacity, AllocatorType>& lhs,
+                           InlineArray<ElementType, InlineCapacity, AllocatorType>& rhs) noexcept(noexcept(lhs.swap(rhs))) {
+    lhs.swap(rhs);
+}
+
+}  // namespace licht
@@ -0,0 +1,198 @@
+#pragma once
+
+#include "licht/core/defines.hpp"
+#include "licht/core/memory/memory.hpp"
+#include "licht/core/platform/cpu.hpp"
+
+#include <atomic>
+#include <bit>
+#include <utility>
+
+namespace licht {
+
+/**
+ * @brief Bounded lock-free queue for any number of producer and consumer threads.
+ *
+ * Each cell carries a sequence number telling whether it is ready to be written or read for a given lap
+ * of the ring (D. Vyukov's bounded MPMC queue). Producers and consumers claim positions with a CAS on
+ * their own cache-line-padded counter and never touch the other side's counter.
+ *
+ * The capacity is rounded up to a power of two. `try_*` functions never block,
+ * `push`/`pop` spin with backoff until they succeed.
+ */
+template <typename ElementType>
+class MpmcQueue {
+public:
+    using value_type = ElementType;
+    using size_type = size_t;
+
+public:
+    bool try_push(const ElementType& element) {
+        return try_emplace(element);
+    }
+
+    bool try_push(ElementType&& element) {
+        return try_emplace(std::move(element));
+    }
+
+    template <typename... Args>
+    bool try_emplace(Args&&... args) {
+        size_type position = enqueue_position_.value.load(std::memory_order_relaxed);
+
+        for (;;) {
+            Cell& cell = cells_[position & mask_];
+            const size_type sequence = cell.sequence.load(std::memory_order_acquire);
+            const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+            if (difference == 0) {
+                if (enqueue_position_.value.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    lplacement_new(cell.storage) ElementType(std::forward<Args>(args)...);
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                // The cell still holds the element of the previous lap: the queue is full.
+                return false;
+            } else {
+                position = enqueue_position_.value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool try_pop(ElementType& out) {
+        size_type position = dequeue_position_.value.load(std::memory_order_relaxed);
+
+        for (;;) {
+            Cell& cell = cells_[position & mask_];
+            const size_type sequence = cell.sequence.load(std::memory_order_acquire);
+            const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+            if (difference == 0) {
+                if (dequeue_position_.value.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    ElementType* element = cell.element();
+                    out = std::move(*element);
+                    element->~ElementType();
+                    cell.sequence.store(position + mask_ + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) {
+                // Nothing was written to the cell for this lap yet: the queue is empty.
+                return false;
+            } else {
+                position = dequeue_position_.value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Pushes the `count` elements in order until the queue is full.
+     * Elements of concurrent producers may be interleaved with the batch.
+     * @return The number of elements pushed.
+     */
+    size_type try_push_batch(const ElementType* elements, size_type count) {
+        size_type pushed = 0;
+        while (pushed < count && try_push(elements[pushed])) {
+            pushed++;
+        }
+        return pushed;
+    }
+
+    /**
+     * @brief Pops up to `max_count` elements into `out`, stopping at the first failure.
+     * @return The number of elements popped.
+     */
+    size_type try_pop_batch(ElementType* out, size_type max_count) {
+        size_type popped = 0;
+        while (popped < max_count && try_pop(out[popped])) {
+            popped++;
+        }
+        return popped;
+    }
+
+    void push(const ElementType& element) {
+        SpinWait spin;
+        while (!try_push(element)) {
+            spin.wait();
+        }
+    }
+
+    void push(ElementType&& element) {
+        SpinWait spin;
+        while (!try_push(std::move(element))) {
+            spin.wait();
+        }
+    }
+
+    ElementType pop() {
+        ElementType element;
+        SpinWait spin;
+        while (!try_pop(element)) {
+            spin.wait();
+        }
+        return element;
+    }
+
+    /**
+     * @brief Number of claimed positions not yet consumed. Exact only when no thread is running.
+     */
+    size_type size_approx() const {
+        const size_type head = dequeue_position_.value.load(std::memory_order_acquire);
+        const size_type tail = enqueue_position_.value.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    bool empty_approx() const {
+        return size_approx() == 0;
+    }
+
+    inline size_type capacity() const {
+        return mask_ + 1;
+    }
+
+public:
+    explicit MpmcQueue(size_type capacity)
+        : mask_(std::bit_ceil(capacity < 2 ? size_type(2) : capacity) - 1) {
+        cells_ = reinterpret_cast<Cell*>(Memory::allocate(sizeof(Cell) * (mask_ + 1), alignof(Cell)));
+        for (size_type i = 0; i <= mask_; i++) {
+            lplacement_new(cells_ + i) Cell();
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~MpmcQueue() {
+        const size_type tail = enqueue_position_.value.load(std::memory_order_relaxed);
+        for (size_type i = dequeue_position_.value.load(std::memory_order_relaxed); i != tail; i++) {
+            cells_[i & mask_].element()->~ElementType();
+        }
+
+        for (size_type i = 0; i <= mask_; i++) {
+            cells_[i].~Cell();
+        }
+        Memory::free(cells_, sizeof(Cell) * (mask_ + 1), alignof(Cell));
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+private:
+    struct Cell {
+        std::atomic<size_type> sequence;
+        alignas(ElementType) uint8 storage[sizeof(ElementType)];
+
+        ElementType* element() {
+            return reinterpret_cast<ElementType*>(storage);
+        }
+    };
+
+    struct alignas(cache_line_size) PaddedPosition {
+        std::atomic<size_type> value = 0;
+    };
+
+    PaddedPosition enqueue_position_;
+    PaddedPosition dequeue_position_;
+
+    Cell* cells_;
+    size_type mask_;
+};
+
+}  //namespace licht
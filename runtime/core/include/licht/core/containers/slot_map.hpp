@@ -0,0 +1,261 @@
+#pragma once
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/defines.hpp"
+
+#include <functional>
+#include <limits>
+#include <utility>
+
+namespace licht {
+
+/**
+ * @brief Stable reference to an element of a `SlotMap`: a slot index and the generation the slot had
+ * when the element was inserted. Stays safe to use after the element is removed, lookups then fail.
+ *
+ * The default handle is null and never refers to an element.
+ */
+struct SlotHandle {
+    uint32 index = 0;
+    uint32 generation = 0;
+
+    inline constexpr bool is_null() const {
+        return generation == 0;
+    }
+
+    /**
+     * @brief Packs the handle in 64 bits, e.g. to store it where an opaque id is expected.
+     */
+    inline constexpr uint64 to_bits() const {
+        return (static_cast<uint64>(generation) << 32) | index;
+    }
+
+    static inline constexpr SlotHandle from_bits(uint64 bits) {
+        return SlotHandle{static_cast<uint32>(bits), static_cast<uint32>(bits >> 32)};
+    }
+
+    inline constexpr bool operator==(const SlotHandle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+
+    inline constexpr bool operator!=(const SlotHandle& other) const {
+        return !(*this == other);
+    }
+};
+
+/**
+ * @brief Container handing out generation-checked handles to its elements.
+ *
+ * Elements are kept contiguous in insertion order until removed: a removal moves the last element
+ * into the hole. Handles go through a slot table, so they stay valid across those moves, and a slot
+ * gets a new generation each time its element is removed, so stale handles are detected.
+ * Insertion, removal and lookup are O(1); iteration only walks the live elements.
+ */
+template <typename ElementType>
+class SlotMap {
+public:
+    using value_type = ElementType;
+    using size_type = size_t;
+    using reference = ElementType&;
+    using const_reference = const ElementType&;
+    using iterator = ElementType*;
+    using const_iterator = const ElementType*;
+
+public:
+    SlotHandle insert(const ElementType& element) {
+        return emplace(element);
+    }
+
+    SlotHandle insert(ElementType&& element) {
+        return emplace(std::move(element));
+    }
+
+    template <typename... Args>
+    SlotHandle emplace(Args&&... args) {
+        LCHECK_MSG(values_.size() < max_size, "SlotMap is full.");
+
+        const uint32 slot_index = acquire_slot();
+        Slot& slot = slots_[slot_index];
+        slot.dense_index = static_cast<uint32>(values_.size());
+
+        values_.emplace_back(std::forward<Args>(args)...);
+        dense_to_slot_.append(slot_index);
+
+        return SlotHandle{slot_index, slot.generation};
+    }
+
+    /**
+     * @brief Removes the element the handle refers to.
+     * @return False if the handle was null, stale or from another map.
+     */
+    bool remove(SlotHandle handle) {
+        if (!contains(handle)) {
+            return false;
+        }
+
+        Slot& slot = slots_[handle.index];
+        const uint32 dense_index = slot.dense_index;
+        const uint32 last_index = static_cast<uint32>(values_.size() - 1);
+
+        if (dense_index != last_index) {
+            const uint32 moved_slot = dense_to_slot_[last_index];
+            values_[dense_index] = std::move(values_[last_index]);
+            dense_to_slot_[dense_index] = moved_slot;
+            slots_[moved_slot].dense_index = dense_index;
+        }
+
+        values_.pop();
+        dense_to_slot_.pop();
+        release_slot(handle.index);
+        return true;
+    }
+
+    inline bool contains(SlotHandle handle) const {
+        return handle.index < slots_.size() && slots_.data()[handle.index].generation == handle.generation;
+    }
+
+    inline ElementType* get(SlotHandle handle) {
+        return contains(handle) ? &values_.data()[slots_.data()[handle.index].dense_index] : nullptr;
+    }
+
+    inline const ElementType* get(SlotHandle handle) const {
+        return contains(handle) ? &values_.data()[slots_.data()[handle.index].dense_index] : nullptr;
+    }
+
+    inline reference operator[](SlotHandle handle) {
+        LCHECK_MSG(contains(handle), "Invalid SlotMap handle.");
+        return values_[slots_[handle.index].dense_index];
+    }
+
+    inline const_reference operator[](SlotHandle handle) const {
+        LCHECK_MSG(contains(handle), "Invalid SlotMap handle.");
+        return values_[slots_[handle.index].dense_index];
+    }
+
+    /**
+     * @brief Handle of the element at `dense_index` in iteration order.
+     */
+    SlotHandle handle_at(size_type dense_index) const {
+        const uint32 slot_index = dense_to_slot_[dense_index];
+        return SlotHandle{slot_index, slots_[slot_index].generation};
+    }
+
+    /**
+     * @brief Calls `func(handle, element)` for each live element.
+     */
+    template <typename Func>
+    void for_each(Func&& func) {
+        for (size_type i = 0; i < values_.size(); i++) {
+            func(handle_at(i), values_[i]);
+        }
+    }
+
+    inline const Array<ElementType>& elements() const {
+        return values_;
+    }
+
+    inline size_type size() const {
+        return values_.size();
+    }
+
+    inline bool empty() const {
+        return values_.empty();
+    }
+
+    void reserve(size_type capacity) {
+        values_.reserve(capacity);
+        dense_to_slot_.reserve(capacity);
+        slots_.reserve(capacity);
+    }
+
+    /**
+     * @brief Removes every element. Handles given out before stay invalid.
+     */
+    void clear() {
+        for (uint32 slot_index : dense_to_slot_) {
+            release_slot(slot_index);
+        }
+        values_.clear();
+        dense_to_slot_.clear();
+    }
+
+public:
+    iterator begin() {
+        return values_.begin();
+    }
+
+    const_iterator begin() const {
+        return values_.begin();
+    }
+
+    iterator end() {
+        return values_.end();
+    }
+
+    const_iterator end() const {
+        return values_.end();
+    }
+
+public:
+    SlotMap() = default;
+
+    explicit SlotMap(size_type capacity) {
+        reserve(capacity);
+    }
+
+    ~SlotMap() = default;
+
+private:
+    /**
+     * @brief A live slot stores the index of its element, a free one the next free slot.
+     * Generations are odd while the slot is live and even while it is free, so a free slot never
+     * matches a handle and the null handle (generation 0) never matches anything.
+     */
+    struct Slot {
+        union {
+            uint32 dense_index;
+            uint32 next_free;
+        };
+        uint32 generation;
+    };
+
+    static constexpr uint32 invalid_slot = std::numeric_limits<uint32>::max();
+    static constexpr size_type max_size = std::numeric_limits<uint32>::max() - 1;
+
+    uint32 acquire_slot() {
+        uint32 slot_index = free_head_;
+        if (slot_index == invalid_slot) {
+            slot_index = static_cast<uint32>(slots_.size());
+            slots_.append(Slot{{0}, 0});
+        } else {
+            free_head_ = slots_[slot_index].next_free;
+        }
+
+        Slot& slot = slots_[slot_index];
+        slot.generation++;
+        return slot_index;
+    }
+
+    void release_slot(uint32 slot_index) {
+        Slot& slot = slots_[slot_index];
+        // Skips 0 on wrap-around so the null handle stays null.
+        slot.generation = slot.generation == std::numeric_limits<uint32>::max() ? 2 : slot.generation + 1;
+        slot.next_free = free_head_;
+        free_head_ = slot_index;
+    }
+
+private:
+    Array<ElementType> values_;
+    Array<uint32> dense_to_slot_;
+    Array<Slot> slots_;
+    uint32 free_head_ = invalid_slot;
+};
+
+}  //namespace licht
+
+template <>
+struct std::hash<::licht::SlotHandle> {
+    size_t operator()(const licht::SlotHandle& handle) const noexcept {
+        return static_cast<size_t>(handle.to_bits());
+    }
+};
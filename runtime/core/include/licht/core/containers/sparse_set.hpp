@@ -1,12 +1,35 @@
 #pragma once
 
+#include <bit>
 #include <limits>
+#include <utility>
+
 #include "licht/core/containers/array.hpp"
+#include "licht/core/memory/default_allocator.hpp"
+#include "licht/core/memory/memory.hpp"
 
 namespace licht {
 
-template <typename ElementType, typename KeyIndexType = size_t>
+/**
+ * @brief Maps sparse keys (e.g. entities) to densely packed elements.
+ *
+ * The sparse side is split into pages of `PageSize` dense indices, addressed with a shift and a mask.
+ * A page is allocated whole the first time one of its keys is set; until then it is null and all its keys
+ * read as `invalid_index`, so a lookup is two checks and two loads. No sentinel page is shared,
+ * which would not be the same object in every module the set is used from.
+ *
+ * @tparam KeyIndexType Type of the keys, as stored next to the elements.
+ * @tparam DenseIndexType Type of the indices stored in the pages, e.g. `uint32` to halve their size
+ * when the set never holds more than 2^32 - 1 elements.
+ * @tparam PageSize Number of keys per page, a power of two.
+ */
+template <typename ElementType,
+          typename KeyIndexType = size_t,
+          typename DenseIndexType = KeyIndexType,
+          size_t PageSize = 1024>
 class SparseSet {
+    static_assert(std::has_single_bit(PageSize), "SparseSet pages must be a power of two.");
+
 public:
     using size_type = size_t;
     using value_type = ElementType;
@@ -14,13 +37,17 @@ public:
     using const_reference = const ElementType&;
 
     using key_index_type = KeyIndexType;
-    using sparse_type = Array<key_index_type>;
+    using dense_index_type = DenseIndexType;
 
-    static constexpr const key_index_type invalid_index = std::numeric_limits<key_index_type>::max();
+    static constexpr const dense_index_type invalid_index = std::numeric_limits<dense_index_type>::max();
+
+    static constexpr size_type page_size = PageSize;
+    static constexpr size_type page_shift = std::countr_zero(PageSize);
+    static constexpr size_type page_mask = PageSize - 1;
 
 public:
-    ElementType* put(size_t i, const_reference element) {
-        key_index_type index = get_dense_index(i);
+    ElementType* put(size_type i, const_reference element) {
+        dense_index_type index = get_dense_index(i);
         if (index != invalid_index) {
             dense_value_[index] = element;
             dense_identification_[index] = i;
@@ -28,7 +55,8 @@ public:
             return &dense_value_[index];
         }
 
-        key_index_type new_index = dense_value_.size();
+        LCHECK_MSG(dense_value_.size() < invalid_index, "SparseSet dense index type overflow.");
+        dense_index_type new_index = static_cast<dense_index_type>(dense_value_.size());
         set_dense_index(i, new_index);
 
         dense_value_.push_back(element);
@@ -38,30 +66,30 @@ public:
     }
 
     reference operator[](size_type i) {
-        key_index_type index = get_dense_index(i);
+        dense_index_type index = get_dense_index(i);
         return dense_value_[index];
     }
 
     const_reference operator[](size_type i) const {
-        key_index_type index = get_dense_index(i);
+        dense_index_type index = get_dense_index(i);
         return dense_value_[index];
     }
 
     ElementType* get(size_type i) {
-        key_index_type index = get_dense_index(i);
+        dense_index_type index = get_dense_index(i);
         return (index != invalid_index) ? &dense_value_[index] : nullptr;
     }
 
     const ElementType* get(size_type i) const {
-        key_index_type index = get_dense_index(i);
+        dense_index_type index = get_dense_index(i);
         return (index != invalid_index) ? &dense_value_[index] : nullptr;
     }
 
     void remove(size_type i) {
-        key_index_type deleted_index = get_dense_index(i);
+        dense_index_type deleted_index = get_dense_index(i);
         LCHECK(deleted_index != invalid_index && !dense_value_.empty());
 
-        key_index_type last_index = dense_value_.size() - 1;
+        const size_type last_index = dense_value_.size() - 1;
         key_index_type last_id = dense_identification_.back();
 
         if (deleted_index != last_index) {
@@ -76,7 +104,7 @@ public:
         dense_identification_.pop();
     }
 
-    sparse_type& dense() {
+    Array<key_index_type>& dense() {
         return dense_identification_;
     }
 
@@ -88,7 +116,7 @@ public:
         return dense_value_;
     }
 
-    inline bool contains(size_type i) {
+    inline bool contains(size_type i) const {
         return get_dense_index(i) != invalid_index;
     }
 
@@ -101,72 +129,129 @@ public:
     }
 
     void reserve(size_type dense_capacity) {
-        if (capacity_page_ < dense_capacity) {
-            capacity_page_ = dense_capacity;
-        }
         dense_value_.reserve(dense_capacity);
         dense_identification_.reserve(dense_capacity);
     }
 
     void resize(size_type new_size, const_reference default_value = ElementType{}) {
-        if (capacity_page_ < new_size) {
-            capacity_page_ = new_size;
-        }
         dense_value_.resize(new_size, default_value);
-        dense_identification_.resize(new_size, invalid_index);
+        dense_identification_.resize(new_size, std::numeric_limits<key_index_type>::max());
     }
 
     void clear() {
         dense_value_.clear();
         dense_identification_.clear();
-        sparses_.clear();
+        release_pages();
     }
 
 public:
-    SparseSet(size_t capacity_page = 100)
-        : capacity_page_(capacity_page)
-        , dense_value_(capacity_page)
-        , sparses_(capacity_page) {
+    explicit SparseSet(size_type dense_capacity = 0)
+        : dense_value_(dense_capacity)
+        , dense_identification_(dense_capacity) {
+    }
+
+    SparseSet(const SparseSet& other)
+        : dense_value_(other.dense_value_)
+        , dense_identification_(other.dense_identification_) {
+        copy_pages(other);
     }
 
-    ~SparseSet() = default;
+    SparseSet(SparseSet&& other) noexcept
+        : pages_(std::move(other.pages_))
+        , dense_value_(std::move(other.dense_value_))
+        , dense_identification_(std::move(other.dense_identification_)) {
+    }
+
+    SparseSet& operator=(const SparseSet& other) {
+        if (this != &other) {
+            release_pages();
+            dense_value_ = other.dense_value_;
+            dense_identification_ = other.dense_identification_;
+            copy_pages(other);
+        }
+        return *this;
+    }
+
+    SparseSet& operator=(SparseSet&& other) noexcept {
+        if (this != &other) {
+            release_pages();
+            pages_ = std::move(other.pages_);
+            dense_value_ = std::move(other.dense_value_);
+            dense_identification_ = std::move(other.dense_identification_);
+        }
+        return *this;
+    }
+
+    ~SparseSet() {
+        release_pages();
+    }
 
 private:
-    void set_dense_index(size_type i, key_index_type index) {
-        size_type page = i / capacity_page_;
-        size_type sparse_index = i % capacity_page_;
+    void set_dense_index(size_type i, dense_index_type index) {
+        const size_type page = i >> page_shift;
 
-        if (page >= sparses_.size()) {
-            sparses_.resize(page + 1);
+        if (page >= pages_.size()) {
+            if (index == invalid_index) {
+                return;
+            }
+            pages_.resize(page + 1, nullptr);
         }
 
-        sparse_type& sparse = sparses_[page];
-        if (sparse_index >= sparse.size()) {
-            sparse.resize(sparse_index + 1, invalid_index);
+        dense_index_type* sparse = pages_[page];
+        if (!sparse) {
+            if (index == invalid_index) {
+                return;
+            }
+            sparse = allocate_page();
+            pages_[page] = sparse;
         }
 
-        sparse[sparse_index] = index;
+        sparse[i & page_mask] = index;
     }
 
-    key_index_type get_dense_index(size_type i) const {
-        size_type page = i / capacity_page_;
-        size_type sparse_index = i % capacity_page_;
+    inline dense_index_type get_dense_index(size_type i) const {
+        const size_type page = i >> page_shift;
+        if (page >= pages_.size()) {
+            return invalid_index;
+        }
+
+        const dense_index_type* sparse = pages_.data()[page];
+        return sparse ? sparse[i & page_mask] : invalid_index;
+    }
 
-        if (page < sparses_.size()) {
-            const sparse_type& sparse = sparses_[page];
-            if (sparse_index < sparse.size()) {
-                return sparse[sparse_index];
+    dense_index_type* allocate_page() {
+        dense_index_type* page = page_allocator_.allocate(PageSize);
+        LCHECK(page);
+        for (size_type i = 0; i < PageSize; i++) {
+            page[i] = invalid_index;
+        }
+        return page;
+    }
+
+    void copy_pages(const SparseSet& other) {
+        pages_.resize(other.pages_.size(), nullptr);
+        for (size_type page = 0; page < other.pages_.size(); page++) {
+            if (other.pages_[page]) {
+                pages_[page] = page_allocator_.allocate(PageSize);
+                Memory::copy(pages_[page], other.pages_[page], sizeof(dense_index_type) * PageSize);
             }
         }
+    }
 
-        return invalid_index;
+    void release_pages() {
+        for (dense_index_type* page : pages_) {
+            if (page) {
+                page_allocator_.deallocate(page, PageSize);
+            }
+        }
+        pages_.clear();
     }
 
 private:
-    Array<sparse_type> sparses_;
+    Array<dense_index_type*> pages_;
     Array<ElementType> dense_value_;
-    sparse_type dense_identification_;
-    size_type capacity_page_;
+    Array<key_index_type> dense_identification_;
+    TypedDefaultAllocator<dense_index_type> page_allocator_;
 };
 
-}  //namespace licht
\ No newline at end of file
+}  //namespace licht
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "licht/core/defines.hpp"
+#include "licht/core/memory/memory.hpp"
+#include "licht/core/platform/cpu.hpp"
+
+#include <atomic>
+#include <bit>
+#include <utility>
+
+namespace licht {
+
+/**
+ * @brief Bounded lock-free queue between exactly one producer thread and one consumer thread.
+ *
+ * The capacity is rounded up to a power of two. The producer and consumer indices live on separate
+ * cache lines, and each side keeps a cached copy of the other's index so that it only reads the
+ * shared one when the queue looks full (producer) or empty (consumer).
+ *
+ * `try_*` functions never block, `push`/`pop` spin with backoff until they succeed.
+ */
+template <typename ElementType>
+class SpscQueue {
+public:
+    using value_type = ElementType;
+    using size_type = size_t;
+
+public:
+    bool try_push(const ElementType& element) {
+        return try_emplace(element);
+    }
+
+    bool try_push(ElementType&& element) {
+        return try_emplace(std::move(element));
+    }
+
+    template <typename... Args>
+    bool try_emplace(Args&&... args) {
+        const size_type tail = producer_.index.load(std::memory_order_relaxed);
+        if (tail - producer_.cached_other == capacity_) {
+            producer_.cached_other = consumer_.index.load(std::memory_order_acquire);
+            if (tail - producer_.cached_other == capacity_) {
+                return false;
+            }
+        }
+
+        lplacement_new(slots_ + (tail & mask_)) ElementType(std::forward<Args>(args)...);
+        producer_.index.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pushes as many of the `count` elements as fit, in order.
+     * @return The number of elements pushed.
+     */
+    size_type try_push_batch(const ElementType* elements, size_type count) {
+        const size_type tail = producer_.index.load(std::memory_order_relaxed);
+        size_type free = capacity_ - (tail - producer_.cached_other);
+        if (free < count) {
+            producer_.cached_other = consumer_.index.load(std::memory_order_acquire);
+            free = capacity_ - (tail - producer_.cached_other);
+        }
+
+        const size_type pushed = count < free ? count : free;
+        for (size_type i = 0; i < pushed; i++) {
+            lplacement_new(slots_ + ((tail + i) & mask_)) ElementType(elements[i]);
+        }
+
+        // A single release publishes the whole batch.
+        producer_.index.store(tail + pushed, std::memory_order_release);
+        return pushed;
+    }
+
+    bool try_pop(ElementType& out) {
+        const size_type head = consumer_.index.load(std::memory_order_relaxed);
+        if (head == consumer_.cached_other) {
+            consumer_.cached_other = producer_.index.load(std::memory_order_acquire);
+            if (head == consumer_.cached_other) {
+                return false;
+            }
+        }
+
+        ElementType* slot = slots_ + (head & mask_);
+        out = std::move(*slot);
+        slot->~ElementType();
+        consumer_.index.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pops up to `max_count` elements into `out`, in order.
+     * @return The number of elements popped.
+     */
+    size_type try_pop_batch(ElementType* out, size_type max_count) {
+        const size_type head = consumer_.index.load(std::memory_order_relaxed);
+        size_type available = consumer_.cached_other - head;
+        if (available < max_count) {
+            consumer_.cached_other = producer_.index.load(std::memory_order_acquire);
+            available = consumer_.cached_other - head;
+        }
+
+        const size_type popped = max_count < available ? max_count : available;
+        for (size_type i = 0; i < popped; i++) {
+            ElementType* slot = slots_ + ((head + i) & mask_);
+            out[i] = std::move(*slot);
+            slot->~ElementType();
+        }
+
+        consumer_.index.store(head + popped, std::memory_order_release);
+        return popped;
+    }
+
+    void push(const ElementType& element) {
+        SpinWait spin;
+        while (!try_push(element)) {
+            spin.wait();
+        }
+    }
+
+    void push(ElementType&& element) {
+        SpinWait spin;
+        while (!try_push(std::move(element))) {
+            spin.wait();
+        }
+    }
+
+    ElementType pop() {
+        ElementType element;
+        SpinWait spin;
+        while (!try_pop(element)) {
+            spin.wait();
+        }
+        return element;
+    }
+
+    /**
+     * @brief Number of queued elements. Exact only when neither side is running.
+     */
+    size_type size_approx() const {
+        const size_type head = consumer_.index.load(std::memory_order_acquire);
+        const size_type tail = producer_.index.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    bool empty_approx() const {
+        return size_approx() == 0;
+    }
+
+    inline size_type capacity() const {
+        return capacity_;
+    }
+
+public:
+    explicit SpscQueue(size_type capacity)
+        : capacity_(std::bit_ceil(capacity < 2 ? size_type(2) : capacity))
+        , mask_(capacity_ - 1) {
+        slots_ = reinterpret_cast<ElementType*>(Memory::allocate(sizeof(ElementType) * capacity_, slot_alignment));
+    }
+
+    ~SpscQueue() {
+        const size_type tail = producer_.index.load(std::memory_order_relaxed);
+        for (size_type i = consumer_.index.load(std::memory_order_relaxed); i != tail; i++) {
+            slots_[i & mask_].~ElementType();
+        }
+        Memory::free(slots_, sizeof(ElementType) * capacity_, slot_alignment);
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+private:
+    static constexpr size_type slot_alignment = alignof(ElementType) > cache_line_size ? alignof(ElementType) : cache_line_size;
+
+    /**
+     * @brief Index written by one side, next to its cached copy of the other side's index.
+     */
+    struct alignas(cache_line_size) Side {
+        std::atomic<size_type> index = 0;
+        size_type cached_other = 0;
+    };
+
+    Side producer_;
+    Side consumer_;
+
+    ElementType* slots_;
+    size_type capacity_;
+    size_type mask_;
+};
+
+}  //namespace licht
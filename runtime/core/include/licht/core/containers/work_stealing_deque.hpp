@@ -0,0 +1,170 @@
+#pragma once
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/defines.hpp"
+#include "licht/core/memory/default_allocator.hpp"
+#include "licht/core/memory/memory.hpp"
+#include "licht/core/platform/cpu.hpp"
+
+#include <atomic>
+#include <bit>
+#include <type_traits>
+
+namespace licht {
+
+/**
+ * @brief Chase-Lev work-stealing deque.
+ *
+ * The owner thread pushes and pops at the bottom, like a stack, while any other thread steals from the top.
+ * The owner only synchronizes with thieves when the deque is down to its last element.
+ * The ring grows when full; replaced rings are kept until destruction since a thief may still be reading one.
+ *
+ * Elements are copied in and out of atomic slots, so they must be trivially copyable (e.g. pointers).
+ */
+template <typename ElementType>
+class WorkStealingDeque {
+    static_assert(std::is_trivially_copyable_v<ElementType>, "WorkStealingDeque elements must be trivially copyable.");
+
+public:
+    using size_type = size_t;
+
+    /**
+     * @brief Owner only. Pushes an element at the bottom, growing the ring if it is full.
+     */
+    void push(ElementType element) {
+        const int64 bottom = bottom_.load(std::memory_order_relaxed);
+        const int64 top = top_.load(std::memory_order_acquire);
+        Ring* ring = ring_.load(std::memory_order_relaxed);
+
+        if (bottom - top > static_cast<int64>(ring->mask)) {
+            ring = grow(ring, top, bottom);
+        }
+
+        ring->store(bottom, element);
+        bottom_.store(bottom + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Owner only. Pops the most recently pushed element.
+     * @return false if the deque is empty or a thief took the last element.
+     */
+    bool try_pop(ElementType& out) {
+        const int64 bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        Ring* ring = ring_.load(std::memory_order_relaxed);
+        bottom_.store(bottom, std::memory_order_seq_cst);
+        int64 top = top_.load(std::memory_order_seq_cst);
+
+        if (top > bottom) {
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        out = ring->load(bottom);
+        if (top == bottom) {
+            // Last element: race the thieves for it.
+            const bool won = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Any thread. Takes the oldest element.
+     * @return false if the deque is empty or another thread took the element first.
+     */
+    bool try_steal(ElementType& out) {
+        int64 top = top_.load(std::memory_order_seq_cst);
+        const int64 bottom = bottom_.load(std::memory_order_seq_cst);
+
+        if (top >= bottom) {
+            return false;
+        }
+
+        Ring* ring = ring_.load(std::memory_order_acquire);
+        out = ring->load(top);
+        return top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+    inline size_type size_approx() const {
+        const int64 bottom = bottom_.load(std::memory_order_relaxed);
+        const int64 top = top_.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+    }
+
+    inline bool empty_approx() const {
+        return size_approx() == 0;
+    }
+
+    inline size_type capacity() const {
+        return ring_.load(std::memory_order_relaxed)->mask + 1;
+    }
+
+public:
+    explicit WorkStealingDeque(size_type capacity = 256)
+        : top_(0)
+        , bottom_(0)
+        , ring_(create_ring(std::bit_ceil(capacity < 2 ? size_type(2) : capacity))) {
+    }
+
+    ~WorkStealingDeque() {
+        destroy_ring(ring_.load(std::memory_order_relaxed));
+        for (Ring* ring : retired_rings_) {
+            destroy_ring(ring);
+        }
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque(WorkStealingDeque&&) = delete;
+
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+private:
+    struct Ring {
+        size_type mask;
+        std::atomic<ElementType>* slots;
+
+        inline void store(int64 index, ElementType element) {
+            slots[static_cast<size_type>(index) & mask].store(element, std::memory_order_relaxed);
+        }
+
+        inline ElementType load(int64 index) const {
+            return slots[static_cast<size_type>(index) & mask].load(std::memory_order_relaxed);
+        }
+    };
+
+    static Ring* create_ring(size_type capacity) {
+        Ring* ring = TypedDefaultAllocator<Ring>().allocate(1);
+        ring->mask = capacity - 1;
+        ring->slots = TypedDefaultAllocator<std::atomic<ElementType>>().allocate(capacity);
+        for (size_type i = 0; i < capacity; i++) {
+            lplacement_new(ring->slots + i) std::atomic<ElementType>();
+        }
+        return ring;
+    }
+
+    static void destroy_ring(Ring* ring) {
+        TypedDefaultAllocator<std::atomic<ElementType>>().deallocate(ring->slots, ring->mask + 1);
+        TypedDefaultAllocator<Ring>().deallocate(ring, 1);
+    }
+
+    Ring* grow(Ring* ring, int64 top, int64 bottom) {
+        Ring* grown = create_ring((ring->mask + 1) * 2);
+        for (int64 i = top; i < bottom; i++) {
+            grown->store(i, ring->load(i));
+        }
+
+        retired_rings_.append(ring);
+        ring_.store(grown, std::memory_order_release);
+        return grown;
+    }
+
+private:
+    alignas(cache_line_size) std::atomic<int64> top_;
+    alignas(cache_line_size) std::atomic<int64> bottom_;
+    std::atomic<Ring*> ring_;
+    Array<Ring*> retired_rings_;
+};
+
+}  //namespace licht
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include "licht/core/defines.hpp"
+#include "licht/core/memory/default_allocator.hpp"
+#include "licht/core/memory/memory.hpp"
+
+namespace licht {
+
+/**
+ * @brief Inline room of a function object, enough for a lambda capturing four pointers.
+ */
+constexpr size_t default_function_capacity = 4 * sizeof(void*);
+
+constexpr size_t function_alignment = alignof(std::max_align_t);
+
+template <typename Signature, size_t Capacity, bool allow_heap>
+class BasicFunction;
+
+/**
+ * @brief Move-only type-erased callable stored in an inline buffer.
+ *
+ * The callable is called through a single function pointer. Callables that can be moved with a memory copy
+ * need no other indirection to be moved or destroyed. Callables outgrowing `Capacity` go to the heap when
+ * `allow_heap` is set, and do not compile otherwise. Use it through `InplaceFunction` or `UniqueFunction`.
+ */
+template <typename ReturnType, typename... ArgumentTypes, size_t Capacity, bool allow_heap>
+class BasicFunction<ReturnType(ArgumentTypes...), Capacity, allow_heap> {
+public:
+    ReturnType operator()(ArgumentTypes... args) const {
+        LCHECK_MSG(invoke_, "Calling an empty function.");
+        return invoke_(&storage_, std::forward<ArgumentTypes>(args)...);
+    }
+
+    bool is_valid() const { return invoke_ != nullptr; }
+
+    explicit operator bool() const { return is_valid(); }
+
+    void reset() {
+        if (manage_) {
+            manage_(&storage_, nullptr);
+        }
+        invoke_ = nullptr;
+        manage_ = nullptr;
+    }
+
+    /**
+     * @brief Whether a callable of type `CallableType` is stored in the inline buffer.
+     */
+    template <typename CallableType>
+    static constexpr bool is_stored_inline() {
+        return sizeof(CallableType) <= Capacity && alignof(CallableType) <= function_alignment &&
+               std::is_nothrow_move_constructible_v<CallableType>;
+    }
+
+public:
+    BasicFunction() noexcept = default;
+
+    BasicFunction(std::nullptr_t) noexcept {}
+
+    template <typename CallableType>
+        requires(!std::is_same_v<std::decay_t<CallableType>, BasicFunction> &&
+                 std::is_invocable_r_v<ReturnType, std::decay_t<CallableType>&, ArgumentTypes...>)
+    BasicFunction(CallableType&& callable) {
+        using StoredType = std::decay_t<CallableType>;
+
+        if constexpr (std::is_pointer_v<StoredType> || std::is_member_pointer_v<StoredType>) {
+            if (!callable) {
+                return;
+            }
+        }
+
+        if constexpr (is_stored_inline<StoredType>()) {
+            lplacement_new(&storage_) StoredType(std::forward<CallableType>(callable));
+            invoke_ = &invoke_inline<StoredType>;
+            manage_ = std::is_trivially_copyable_v<StoredType> ? nullptr : &manage_inline<StoredType>;
+        } else {
+            static_assert(allow_heap, "The callable does not fit the inline buffer of the InplaceFunction, raise its capacity.");
+
+            StoredType* callable_ptr = lnew_args<StoredType>(DefaultAllocator::get_instance(), std::forward<CallableType>(callable));
+            lplacement_new(&storage_) StoredType*(callable_ptr);
+            invoke_ = &invoke_heap<StoredType>;
+            manage_ = &manage_heap<StoredType>;
+        }
+    }
+
+    BasicFunction(BasicFunction&& other) noexcept
+        : invoke_(other.invoke_)
+        , manage_(other.manage_) {
+        move_storage(other);
+    }
+
+    BasicFunction& operator=(BasicFunction&& other) noexcept {
+        if (this != &other) {
+            reset();
+            invoke_ = other.invoke_;
+            manage_ = other.manage_;
+            move_storage(other);
+        }
+        return *this;
+    }
+
+    BasicFunction& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    BasicFunction(const BasicFunction&) = delete;
+    BasicFunction& operator=(const BasicFunction&) = delete;
+
+    ~BasicFunction() {
+        reset();
+    }
+
+private:
+    using InvokeFunction = ReturnType (*)(void* storage, ArgumentTypes&&... args);
+
+    /**
+     * @brief Moves the callable of `source` into `destination` and destroys the source,
+     * or destroys the callable of `destination` when `source` is null.
+     */
+    using ManageFunction = void (*)(void* destination, void* source);
+
+    void move_storage(BasicFunction& other) {
+        if (manage_) {
+            manage_(&storage_, &other.storage_);
+        } else if (invoke_) {
+            // Fixed size copy the compiler inlines, moves stay a few register stores.
+            std::memcpy(storage_, other.storage_, Capacity);
+        }
+        other.invoke_ = nullptr;
+        other.manage_ = nullptr;
+    }
+
+    template <typename StoredType>
+    static ReturnType invoke_inline(void* storage, ArgumentTypes&&... args) {
+        StoredType& callable = *static_cast<StoredType*>(storage);
+        if constexpr (std::is_void_v<ReturnType>) {
+            std::invoke(callable, std::forward<ArgumentTypes>(args)...);
+        } else {
+            return std::invoke(callable, std::forward<ArgumentTypes>(args)...);
+        }
+    }
+
+    template <typename StoredType>
+    static void manage_inline(void* destination, void* source) {
+        if (source) {
+            StoredType* source_callable = static_cast<StoredType*>(source);
+            lplacement_new(destination) StoredType(std::move(*source_callable));
+            source_callable->~StoredType();
+        } else {
+            static_cast<StoredType*>(destination)->~StoredType();
+        }
+    }
+
+    template <typename StoredType>
+    static ReturnType invoke_heap(void* storage, ArgumentTypes&&... args) {
+        StoredType& callable = **static_cast<StoredType**>(storage);
+        if constexpr (std::is_void_v<ReturnType>) {
+            std::invoke(callable, std::forward<ArgumentTypes>(args)...);
+        } else {
+            return std::invoke(callable, std::forward<ArgumentTypes>(args)...);
+        }
+    }
+
+    template <typename StoredType>
+    static void manage_heap(void* destination, void* source) {
+        if (source) {
+            lplacement_new(destination) StoredType*(*static_cast<StoredType**>(source));
+        } else {
+            ldelete(DefaultAllocator::get_instance(), *static_cast<StoredType**>(destination));
+        }
+    }
+
+private:
+    alignas(function_alignment) mutable uint8 storage_[Capacity];
+    InvokeFunction invoke_ = nullptr;
+    ManageFunction manage_ = nullptr;
+};
+
+/**
+ * @brief Move-only callable with a fixed inline buffer of `Capacity` bytes and no heap fallback.
+ */
+template <typename Signature, size_t Capacity = default_function_capacity>
+using InplaceFunction = BasicFunction<Signature, Capacity, false>;
+
+}  //namespace licht
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "licht/core/function/inplace_function.hpp"
+
+namespace licht {
+
+/**
+ * @brief Move-only callable accepting move-only captures. Small callables are stored inline as in
+ * `InplaceFunction`, larger ones in a block of the default allocator.
+ */
+template <typename Signature>
+using UniqueFunction = BasicFunction<Signature, default_function_capacity, true>;
+
+}  //namespace licht
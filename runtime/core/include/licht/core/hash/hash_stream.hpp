@@ -0,0 +1,102 @@
+#pragma once
+
+#include "licht/core/defines.hpp"
+#include "licht/core/hash/wyhash.hpp"
+
+#include <cstring>
+
+namespace licht {
+
+/**
+ * @brief Incremental 64-bit hash of a byte stream, e.g. an asset read chunk by chunk.
+ *
+ * Feeding the same bytes in any number of `update` calls gives the same value as
+ * `Hasher::hash_bytes` over the concatenated input with the same seed.
+ */
+class HashStream {
+public:
+    explicit HashStream(uint64 seed = 0) {
+        reset(seed);
+    }
+
+    void reset(uint64 seed = 0) {
+        seed_ = internal::wyhash_seed(seed);
+        lane1_ = seed_;
+        lane2_ = seed_;
+        total_size_ = 0;
+        pending_size_ = 0;
+    }
+
+    void update(const void* data, size_t size) {
+        const uint8* bytes = static_cast<const uint8*>(data);
+        total_size_ += size;
+
+        if (pending_size_ > 0) {
+            const size_t count = size < block_size - pending_size_ ? size : block_size - pending_size_;
+            ::memcpy(pending() + pending_size_, bytes, count);
+            pending_size_ += count;
+            bytes += count;
+            size -= count;
+
+            if (pending_size_ < block_size) {
+                return;
+            }
+
+            consume_pending();
+        }
+
+        if (size >= block_size) {
+            do {
+                internal::wyhash_block(bytes, seed_, lane1_, lane2_);
+                bytes += block_size;
+                size -= block_size;
+            } while (size >= block_size);
+
+            ::memcpy(buffer_, bytes - tail_size, tail_size);
+        }
+
+        ::memcpy(pending(), bytes, size);
+        pending_size_ = size;
+    }
+
+    /**
+     * @brief Hash of everything fed so far. The stream can keep being updated afterwards.
+     */
+    uint64 finalize() const {
+        uint64 seed = seed_;
+        if (total_size_ >= block_size) {
+            seed ^= lane1_ ^ lane2_;
+        }
+        return internal::wyhash_finish(pending(), pending_size_, total_size_, seed);
+    }
+
+private:
+    static constexpr size_t block_size = internal::wyhash_block_size;
+    static constexpr size_t tail_size = 16;
+
+    uint8* pending() {
+        return buffer_ + tail_size;
+    }
+
+    const uint8* pending() const {
+        return buffer_ + tail_size;
+    }
+
+    void consume_pending() {
+        internal::wyhash_block(pending(), seed_, lane1_, lane2_);
+        ::memcpy(buffer_, pending() + block_size - tail_size, tail_size);
+        pending_size_ = 0;
+    }
+
+private:
+    uint64 seed_;
+    uint64 lane1_;
+    uint64 lane2_;
+    size_t total_size_;
+    size_t pending_size_;
+
+    // The 16 bytes preceding the pending ones are kept for the overlapping read of `wyhash_finish`.
+    uint8 buffer_[tail_size + block_size];
+};
+
+}  // namespace licht
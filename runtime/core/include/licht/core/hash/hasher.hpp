@@ -2,17 +2,83 @@
 
 #include "licht/core/core_exports.hpp"
 #include "licht/core/defines.hpp"
+#include "licht/core/hash/wyhash.hpp"
 
+#include <cstring>
 #include <functional>
+#include <type_traits>
 
 namespace licht {
 
+/**
+ * @brief Opt-in marker letting a container keyed on `KeyType` be queried with a `LookupKeyType`
+ * without building a `KeyType` first (e.g. a `HashMap<String, V>` queried with a `StringRef`).
+ *
+ * A specialization must guarantee that `Hasher::hash` gives the same value for equal keys of both types
+ * and that `KeyType == LookupKeyType` is well-formed.
+ */
+template <typename KeyType, typename LookupKeyType>
+struct HashTransparentKey : std::false_type {};
+
+template <typename LookupKeyType, typename KeyType>
+concept CHashTransparentKey = HashTransparentKey<KeyType, std::remove_cvref_t<LookupKeyType>>::value;
+
 class LICHT_CORE_API Hasher {
 public:
     template <typename T>
-    static uint32 hash(const T& value) {
-        return std::hash<T>{}(value);
+    static uint64 hash(const T& value) {
+        return static_cast<uint64>(std::hash<T>{}(value));
+    }
+
+    /**
+     * @brief Hashes the characters of a null-terminated string, consistently with `String` and `StringRef`.
+     */
+    static uint64 hash(const char* value) {
+        return hash_bytes(value, ::strlen(value));
+    }
+
+    /**
+     * @brief 64-bit wyhash over a byte range.
+     * Use a `HashStream` to hash data that is not available in one contiguous range.
+     */
+    static uint64 hash_bytes(const void* data, size_t size, uint64 seed = 0) {
+        return internal::wyhash(data, size, seed);
+    }
+
+    /**
+     * @brief Folds `value` into `seed`, for keys built from several fields.
+     * The result depends on the order in which the values are combined.
+     */
+    static uint64 combine(uint64 seed, uint64 value) {
+        return internal::wyhash_mix(seed ^ internal::wyhash_secret[0], value ^ internal::wyhash_secret[1]);
+    }
+
+    /**
+     * @brief Hashes each value with `hash` and combines the results in order.
+     *
+     * ```
+     * uint64 key = Hasher::hash_values(description.vertex_shader, description.topology, description.cull_mode);
+     * ```
+     */
+    template <typename... ValueTypes>
+    static uint64 hash_values(const ValueTypes&... values) {
+        uint64 seed = 0;
+        ((seed = combine(seed, hash(values))), ...);
+        return seed;
+    }
+
+    /**
+     * @brief Spreads the entropy of a hash over all 64 bits.
+     * `std::hash` is the identity for integers, which would leave the high bits used by open-addressing tables empty.
+     */
+    static constexpr uint64 mix(uint64 value) {
+        value ^= value >> 33;
+        value *= 0xFF51AFD7ED558CCDULL;
+        value ^= value >> 33;
+        value *= 0xC4CEB9FE1A85EC53ULL;
+        value ^= value >> 33;
+        return value;
     }
 };
 
-}  //namespace licht
\ No newline at end of file
+}  //namespace licht
@@ -0,0 +1,145 @@
+#pragma once
+
+#include "licht/core/defines.hpp"
+
+#include <cstring>
+
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(__SIZEOF_INT128__)
+#include <intrin.h>
+#pragma intrinsic(_umul128)
+#endif
+
+namespace licht::internal {
+
+/**
+ * @brief Building blocks of wyhash (final version 4), a 64-bit non-cryptographic hash
+ * that consumes 48 bytes per iteration with three independent 64x64->128 multiplications.
+ *
+ * Reads are little-endian: the hash values are only stable across little-endian platforms.
+ */
+inline constexpr uint64 wyhash_secret[4] = {
+    0x2D358DCCAA6C78A5ULL,
+    0x8BB84B93962EACC9ULL,
+    0x4B33A62ED433D4A3ULL,
+    0x4D5A2DA51DE1AA47ULL,
+};
+
+inline constexpr size_t wyhash_block_size = 48;
+
+/**
+ * @brief Full 64x64 multiplication, low half written to `a` and high half to `b`.
+ */
+inline void wyhash_multiply(uint64& a, uint64& b) {
+#if defined(__SIZEOF_INT128__)
+    __uint128_t product = static_cast<__uint128_t>(a) * b;
+    a = static_cast<uint64>(product);
+    b = static_cast<uint64>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    a = _umul128(a, b, &b);
+#else
+    const uint64 ha = a >> 32, hb = b >> 32, la = static_cast<uint32>(a), lb = static_cast<uint32>(b);
+    const uint64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    const uint64 t = rl + (rm0 << 32);
+    uint64 carry = t < rl;
+    const uint64 lo = t + (rm1 << 32);
+    carry += lo < t;
+    const uint64 hi = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+    a = lo;
+    b = hi;
+#endif
+}
+
+inline uint64 wyhash_mix(uint64 a, uint64 b) {
+    wyhash_multiply(a, b);
+    return a ^ b;
+}
+
+inline uint64 wyhash_read64(const uint8* bytes) {
+    uint64 value;
+    ::memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+inline uint64 wyhash_read32(const uint8* bytes) {
+    uint32 value;
+    ::memcpy(&value, bytes, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief Reads 1 to 3 bytes into a single word.
+ */
+inline uint64 wyhash_read_small(const uint8* bytes, size_t size) {
+    return (static_cast<uint64>(bytes[0]) << 16) | (static_cast<uint64>(bytes[size >> 1]) << 8) | bytes[size - 1];
+}
+
+inline uint64 wyhash_seed(uint64 seed) {
+    return seed ^ wyhash_mix(seed ^ wyhash_secret[0], wyhash_secret[1]);
+}
+
+/**
+ * @brief Consumes one 48-byte block into the three lanes.
+ */
+inline void wyhash_block(const uint8* bytes, uint64& seed, uint64& lane1, uint64& lane2) {
+    seed = wyhash_mix(wyhash_read64(bytes) ^ wyhash_secret[1], wyhash_read64(bytes + 8) ^ seed);
+    lane1 = wyhash_mix(wyhash_read64(bytes + 16) ^ wyhash_secret[2], wyhash_read64(bytes + 24) ^ lane1);
+    lane2 = wyhash_mix(wyhash_read64(bytes + 32) ^ wyhash_secret[3], wyhash_read64(bytes + 40) ^ lane2);
+}
+
+/**
+ * @brief Hashes the tail left once every 48-byte block has been consumed.
+ *
+ * @param bytes Start of the remaining bytes. When `total_size > 16`, the 16 bytes before `bytes` must be readable
+ * and hold the end of the previously consumed input, since the last read may overlap it.
+ * @param size Number of remaining bytes, lower than 48.
+ * @param total_size Size of the whole input.
+ */
+inline uint64 wyhash_finish(const uint8* bytes, size_t size, size_t total_size, uint64 seed) {
+    uint64 a = 0;
+    uint64 b = 0;
+
+    if (total_size <= 16) {
+        if (size >= 4) {
+            const size_t offset = (size >> 3) << 2;
+            a = (wyhash_read32(bytes) << 32) | wyhash_read32(bytes + offset);
+            b = (wyhash_read32(bytes + size - 4) << 32) | wyhash_read32(bytes + size - 4 - offset);
+        } else if (size > 0) {
+            a = wyhash_read_small(bytes, size);
+        }
+    } else {
+        while (size > 16) {
+            seed = wyhash_mix(wyhash_read64(bytes) ^ wyhash_secret[1], wyhash_read64(bytes + 8) ^ seed);
+            bytes += 16;
+            size -= 16;
+        }
+        a = wyhash_read64(bytes + size - 16);
+        b = wyhash_read64(bytes + size - 8);
+    }
+
+    a ^= wyhash_secret[1];
+    b ^= seed;
+    wyhash_multiply(a, b);
+    return wyhash_mix(a ^ wyhash_secret[0] ^ total_size, b ^ wyhash_secret[1]);
+}
+
+inline uint64 wyhash(const void* data, size_t size, uint64 seed) {
+    const uint8* bytes = static_cast<const uint8*>(data);
+    const size_t total_size = size;
+
+    seed = wyhash_seed(seed);
+
+    if (size >= wyhash_block_size) {
+        uint64 lane1 = seed;
+        uint64 lane2 = seed;
+        do {
+            wyhash_block(bytes, seed, lane1, lane2);
+            bytes += wyhash_block_size;
+            size -= wyhash_block_size;
+        } while (size >= wyhash_block_size);
+        seed ^= lane1 ^ lane2;
+    }
+
+    return wyhash_finish(bytes, size, total_size, seed);
+}
+
+}  // namespace licht::internal
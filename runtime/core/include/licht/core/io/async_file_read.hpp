@@ -0,0 +1,31 @@
+#pragma once
+
+#include "licht/core/async/awaiters.hpp"
+#include "licht/core/async/task.hpp"
+#include "licht/core/containers/array.hpp"
+#include "licht/core/io/file_handle.hpp"
+#include "licht/core/io/file_system.hpp"
+#include "licht/core/string/string.hpp"
+
+namespace licht {
+
+/**
+ * @brief Reads a whole file on a worker of `job_system`. The awaiting coroutine resumes on that worker.
+ * @param filepath Taken by value, the caller's string may be gone by the time the read starts.
+ */
+inline Task<FileOpenError<Array<uint8>>> read_file_async(String filepath,
+                                                         FileSystem& file_system = FileSystem::get_platform(),
+                                                         JobSystem& job_system = JobSystem::get_instance()) {
+    using ReadResultType = FileOpenError<Array<uint8>>;
+
+    co_await resume_on_worker(job_system);
+
+    FileHandleResult file_open_result = file_system.open_read(filepath);
+    if (!file_open_result.has_value()) {
+        co_return ReadResultType::Failure(file_open_result.error());
+    }
+
+    co_return ReadResultType::Success(file_open_result.value()->read_all_bytes());
+}
+
+}  //namespace licht
@@ -12,6 +12,9 @@ public:
     static DefaultAllocator& get_instance();
 };
 
+template <>
+struct TriviallyRelocatable<DefaultAllocator> : std::true_type {};
+
 template <typename Type, MemoryOwnership ownership = MemoryOwnership::Owner>
 using TypedDefaultAllocator = TypedAllocator<Type, DefaultAllocator, ownership>;
 
@@ -0,0 +1,175 @@
+#pragma once
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/containers/array_view.hpp"
+#include "licht/core/core_exports.hpp"
+#include "licht/core/defines.hpp"
+#include "licht/core/memory/allocator.hpp"
+#include "licht/core/memory/linear_allocator.hpp"
+#include "licht/core/memory/memory.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace licht {
+
+/**
+ * @brief Memory for data that lives until the GPU is done with a frame: draw lists, command contexts,
+ * temporary arrays of the submit path. There is one `LinearAllocator` per frame in flight,
+ * reset once the frame comes around again, i.e. when `RenderContext::begin_frame` has waited on its fence.
+ *
+ * Each thread bumps through a sub-arena of its own, taken from the current frame under a lock,
+ * so that workers allocate without contention. Nothing is freed individually and no destructor runs,
+ * which is why the typed helpers only accept trivially destructible types.
+ * When a frame runs out of space, allocations fall back to the heap until the frame is reset.
+ *
+ * With `set_poison_on_reset`, on by default in debug builds, the memory of a frame is overwritten on reset,
+ * so that data used past its frame reads as garbage instead of silently reading stale values.
+ */
+class LICHT_CORE_API FrameAllocator : public AlignedAllocator {
+public:
+    static constexpr size_t default_thread_arena_size = 64 * 1024;
+    static constexpr uint8 poison_byte = 0xDD;
+
+    void initialize(uint32 frame_count, size_t frame_size, size_t thread_arena_size = default_thread_arena_size);
+
+    void destroy();
+
+    /**
+     * @brief Makes `frame` the frame allocations go to, releasing what it held.
+     * No thread may allocate from the allocator meanwhile.
+     */
+    void begin_frame(uint32 frame);
+
+    virtual void* allocate(size_t size, size_t alignment) override;
+
+    /**
+     * @brief Blocks are released with their frame.
+     */
+    virtual void deallocate(void* block, size_t size, size_t alignment) override;
+
+    template <typename ElementType>
+    ArrayView<ElementType> allocate_array(size_t count) {
+        static_assert(std::is_trivially_destructible_v<ElementType>, "Frame memory is released without running destructors.");
+
+        if (count == 0) {
+            return ArrayView<ElementType>(nullptr, 0);
+        }
+
+        ElementType* elements = static_cast<ElementType*>(allocate(sizeof(ElementType) * count, alignof(ElementType)));
+        for (size_t i = 0; i < count; i++) {
+            lplacement_new(elements + i) ElementType();
+        }
+        return ArrayView<ElementType>(elements, count);
+    }
+
+    template <typename ElementType>
+    ArrayView<ElementType> copy_array(const ElementType* source, size_t count) {
+        static_assert(std::is_trivially_destructible_v<ElementType>, "Frame memory is released without running destructors.");
+
+        if (count == 0) {
+            return ArrayView<ElementType>(nullptr, 0);
+        }
+
+        ElementType* elements = static_cast<ElementType*>(allocate(sizeof(ElementType) * count, alignof(ElementType)));
+        for (size_t i = 0; i < count; i++) {
+            lplacement_new(elements + i) ElementType(source[i]);
+        }
+        return ArrayView<ElementType>(elements, count);
+    }
+
+    template <typename ElementType, CTypedAllocator<ElementType> AllocatorType>
+    ArrayView<ElementType> copy_array(const Array<ElementType, AllocatorType>& source) {
+        return copy_array(source.data(), source.size());
+    }
+
+    template <typename Type, typename... Args>
+    Type* create(Args&&... args) {
+        static_assert(std::is_trivially_destructible_v<Type>, "Frame memory is released without running destructors.");
+
+        Type* object = static_cast<Type*>(allocate(sizeof(Type), alignof(Type)));
+        lplacement_new(object) Type(std::forward<Args>(args)...);
+        return object;
+    }
+
+    inline void set_poison_on_reset(bool poison_on_reset) {
+        poison_on_reset_ = poison_on_reset;
+    }
+
+    inline bool is_poisoning_on_reset() const {
+        return poison_on_reset_;
+    }
+
+    inline bool is_valid() const {
+        return frames_ != nullptr;
+    }
+
+    inline uint32 get_frame_count() const {
+        return frame_count_;
+    }
+
+    inline uint32 get_current_frame() const {
+        return current_frame_;
+    }
+
+    /**
+     * @brief Bytes taken from the frame's arena so far, thread sub-arenas included.
+     */
+    size_t get_used_size(uint32 frame) const;
+
+    /**
+     * @brief Bytes the frame had to take from the heap for lack of space in its arena.
+     */
+    size_t get_overflow_size(uint32 frame) const;
+
+public:
+    FrameAllocator();
+    FrameAllocator(uint32 frame_count, size_t frame_size, size_t thread_arena_size = default_thread_arena_size);
+    ~FrameAllocator();
+
+    FrameAllocator(const FrameAllocator&) = delete;
+    FrameAllocator(FrameAllocator&&) = delete;
+
+    FrameAllocator& operator=(const FrameAllocator&) = delete;
+    FrameAllocator& operator=(FrameAllocator&&) = delete;
+
+private:
+    struct OverflowBlock {
+        void* block;
+        size_t size;
+        size_t alignment;
+    };
+
+    struct Frame {
+        LinearAllocator arena;
+        Array<OverflowBlock> overflow_blocks = Array<OverflowBlock>(NoAllocationOnConstructionPolicy());
+        size_t overflow_size = 0;
+    };
+
+    void* allocate_slow(size_t size, size_t alignment);
+
+    /**
+     * @brief Takes `size` bytes from the current frame's arena, or from the heap once it is full.
+     * Must be called with the lock held.
+     */
+    void* allocate_from_frame(size_t size, size_t alignment);
+
+private:
+    Frame* frames_;
+    uint32 frame_count_;
+    uint32 current_frame_;
+    size_t thread_arena_size_;
+
+    /**
+     * @brief Identifies the current frame of this allocator across all allocators,
+     * a thread's sub-arena is only used while it matches.
+     */
+    std::atomic<uint64> generation_;
+
+    std::mutex mutex_;
+    bool poison_on_reset_;
+};
+
+}  //namespace licht
@@ -2,6 +2,7 @@
 
 #include "licht/core/memory/allocator.hpp"
 #include "licht/core/memory/memory.hpp"
+#include "licht/core/memory/trivially_relocatable.hpp"
 #include "licht/core/memory/typed_allocator.hpp"
 
 namespace licht {
@@ -29,6 +30,9 @@ public:
     ~HeapAllocator() = default;
 };
 
+template <>
+struct TriviallyRelocatable<HeapAllocator> : std::true_type {};
+
 template <typename Type, MemoryOwnership ownership = MemoryOwnership::Owner>
 using TypedHeapAllocator = TypedAllocator<Type, HeapAllocator, ownership>;
 
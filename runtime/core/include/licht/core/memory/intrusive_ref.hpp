@@ -0,0 +1,225 @@
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <utility>
+
+#include "licht/core/defines.hpp"
+#include "licht/core/memory/default_allocator.hpp"
+#include "licht/core/memory/memory.hpp"
+#include "licht/core/memory/trivially_relocatable.hpp"
+
+namespace licht {
+
+/**
+ * @brief Base of the types counting their own references, held through `IntrusiveRef`.
+ *
+ * The count lives in the object: no separate counter to allocate, and a raw pointer to the object
+ * can be turned back into a reference at any time.
+ */
+class IntrusiveRefCounted {
+public:
+    int32 get_reference_count() const {
+        return reference_count_.load(std::memory_order_relaxed);
+    }
+
+    void add_reference() const {
+        reference_count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @return True when the last reference was released and the object must be destroyed.
+     */
+    bool release_reference() const {
+        // The sole owner is the only one able to add a reference, so it can skip the read-modify-write.
+        if (reference_count_.load(std::memory_order_acquire) == 1) {
+            return true;
+        }
+        if (reference_count_.fetch_sub(1, std::memory_order_release) == 1) {
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return true;
+        }
+        return false;
+    }
+
+protected:
+    IntrusiveRefCounted() = default;
+
+    // References belong to an object, copying it does not copy them.
+    IntrusiveRefCounted(const IntrusiveRefCounted&)
+        : reference_count_(0) {}
+
+    IntrusiveRefCounted& operator=(const IntrusiveRefCounted&) {
+        return *this;
+    }
+
+    ~IntrusiveRefCounted() = default;
+
+private:
+    mutable std::atomic_int32_t reference_count_ = 0;
+};
+
+template <typename ResourceType>
+concept CIntrusiveRefCounted = std::derived_from<ResourceType, IntrusiveRefCounted>;
+
+/**
+ * @brief Types held through a base class `IntrusiveRef` free themselves with a `destroy_self` member,
+ * typically virtual, so that the sized free matches the allocation of the concrete type.
+ */
+template <typename ResourceType>
+concept CIntrusiveSelfDestroyed = requires(ResourceType* resource) {
+    { resource->destroy_self() };
+};
+
+/**
+ * @brief `IntrusiveRef<DerivedType>` converts to `IntrusiveRef<ResourceType>` only when the base frees
+ * objects through `destroy_self`. Otherwise the release would free `sizeof(ResourceType)` of a larger block
+ * and skip the destructor of the derived type.
+ */
+template <typename DerivedType, typename ResourceType>
+concept CIntrusiveConvertible = std::derived_from<DerivedType, ResourceType> &&
+                                (std::same_as<DerivedType, ResourceType> || CIntrusiveSelfDestroyed<ResourceType>);
+
+/**
+ * @brief Reference to an object counting its own references, see `IntrusiveRefCounted`.
+ *
+ * Same ownership as `SharedRef`, without the counter allocation and with the count on the object cache lines.
+ * Objects are freed with `ldelete` through the default allocator, or their `destroy_self` member when they have one.
+ */
+template <CIntrusiveRefCounted ResourceType>
+class IntrusiveRef {
+public:
+    ResourceType& operator*() const {
+        return *resource_;
+    }
+
+    ResourceType* operator->() const { return resource_; }
+
+    ResourceType* get_resource() const { return resource_; }
+
+    int32 get_reference_count() const {
+        return resource_->get_reference_count();
+    }
+
+    bool is_unique() const {
+        return get_reference_count() == 1;
+    }
+
+    void reset(ResourceType* resource = nullptr) {
+        if (resource) {
+            resource->add_reference();
+        }
+        release_reference();
+        resource_ = resource;
+    }
+
+    template <typename DerivedType>
+        requires(!CIntrusiveConvertible<DerivedType, ResourceType> && std::derived_from<DerivedType, ResourceType>)
+    void reset(DerivedType* resource) = delete;
+
+    bool is_valid() const { return resource_ != nullptr; }
+
+    explicit operator bool() const { return is_valid(); }
+
+public:
+    IntrusiveRef() noexcept = default;
+
+    IntrusiveRef(ResourceType* resource) noexcept
+        : resource_(resource) {
+        if (resource_) {
+            resource_->add_reference();
+        }
+    }
+
+    template <typename DerivedType>
+        requires(!CIntrusiveConvertible<DerivedType, ResourceType> && std::derived_from<DerivedType, ResourceType>)
+    IntrusiveRef(DerivedType* resource) = delete;
+
+    IntrusiveRef(const IntrusiveRef& other) noexcept
+        : IntrusiveRef(other.resource_) {}
+
+    template <typename DerivedType>
+        requires CIntrusiveConvertible<DerivedType, ResourceType>
+    IntrusiveRef(const IntrusiveRef<DerivedType>& other) noexcept
+        : IntrusiveRef(static_cast<ResourceType*>(other.resource_)) {}
+
+    IntrusiveRef(IntrusiveRef&& other) noexcept
+        : resource_(std::exchange(other.resource_, nullptr)) {}
+
+    template <typename DerivedType>
+        requires CIntrusiveConvertible<DerivedType, ResourceType>
+    IntrusiveRef(IntrusiveRef<DerivedType>&& other) noexcept
+        : resource_(std::exchange(other.resource_, nullptr)) {}
+
+    IntrusiveRef& operator=(const IntrusiveRef& other) noexcept {
+        reset(other.resource_);
+        return *this;
+    }
+
+    template <typename DerivedType>
+        requires CIntrusiveConvertible<DerivedType, ResourceType>
+    IntrusiveRef& operator=(const IntrusiveRef<DerivedType>& other) noexcept {
+        reset(other.resource_);
+        return *this;
+    }
+
+    IntrusiveRef& operator=(IntrusiveRef&& other) noexcept {
+        if (this != &other) {
+            release_reference();
+            resource_ = std::exchange(other.resource_, nullptr);
+        }
+        return *this;
+    }
+
+    template <typename DerivedType>
+        requires CIntrusiveConvertible<DerivedType, ResourceType>
+    IntrusiveRef& operator=(IntrusiveRef<DerivedType>&& other) noexcept {
+        release_reference();
+        resource_ = std::exchange(other.resource_, nullptr);
+        return *this;
+    }
+
+    ~IntrusiveRef() noexcept {
+        release_reference();
+    }
+
+public:
+    void release_reference() {
+        if (resource_ && resource_->release_reference()) {
+            if constexpr (CIntrusiveSelfDestroyed<ResourceType>) {
+                resource_->destroy_self();
+            } else {
+                ldelete(DefaultAllocator::get_instance(), resource_);
+            }
+        }
+        resource_ = nullptr;
+    }
+
+    template <CIntrusiveRefCounted OtherResourceType>
+    friend class IntrusiveRef;
+
+private:
+    ResourceType* resource_ = nullptr;
+};
+
+template <typename ResourceType>
+struct TriviallyRelocatable<IntrusiveRef<ResourceType>> : std::true_type {};
+
+template <CIntrusiveRefCounted ResourceType, typename... Args>
+inline IntrusiveRef<ResourceType> new_intrusive_ref(Args&&... args) noexcept {
+    return IntrusiveRef<ResourceType>(lnew_args<ResourceType>(DefaultAllocator::get_instance(), std::forward<Args>(args)...));
+}
+
+template <typename ResourceType>
+bool operator==(const IntrusiveRef<ResourceType>& lhs, const IntrusiveRef<ResourceType>& rhs) {
+    return lhs.get_resource() == rhs.get_resource();
+}
+
+}  // namespace licht
+
+template <typename ResourceType>
+struct std::hash<licht::IntrusiveRef<ResourceType>> {
+    size_t operator()(const licht::IntrusiveRef<ResourceType>& ref) const {
+        return std::hash<ResourceType*>()(ref.get_resource());
+    }
+};
@@ -29,6 +29,10 @@ public:
         return offset_;
     }
 
+    inline uint8* get_buffer() const {
+        return buffer_;
+    }
+
     inline bool is_valid() const {
         return buffer_ != nullptr;
     }
@@ -36,6 +40,16 @@ public:
 public:
     LinearAllocator(size_t size);
     LinearAllocator();
+
+    /**
+     * @brief Copies get an empty buffer of their own with the same size, blocks are never shared.
+     */
+    LinearAllocator(const LinearAllocator& other);
+    LinearAllocator(LinearAllocator&& other) noexcept;
+
+    LinearAllocator& operator=(const LinearAllocator& other);
+    LinearAllocator& operator=(LinearAllocator&& other) noexcept;
+
     ~LinearAllocator();
 
 private:
@@ -0,0 +1,310 @@
+#pragma once
+
+#include <concepts>
+#include <utility>
+
+#include "licht/core/defines.hpp"
+#include "licht/core/memory/default_allocator.hpp"
+#include "licht/core/memory/reference_counter.hpp"
+#include "licht/core/memory/shared_ref.hpp"
+#include "licht/core/memory/trivially_relocatable.hpp"
+
+#ifdef LDEBUG
+#include <thread>
+#endif
+
+namespace licht {
+
+/**
+ * @brief Counts the `LocalRef` of one thread with a plain integer. The whole group holds a single reference
+ * on the shared counter of the resource, released with the last local reference.
+ *
+ * Allocated on its own by `LocalRef(const SharedRef&)`, or embedded next to the resource by `new_local_ref`.
+ */
+class LocalReferenceCounter {
+public:
+    ReferenceCounter* get_shared_reference_counter() const {
+        return shared_reference_counter_;
+    }
+
+    int32 get_local_reference_count() const {
+        check_owner_thread();
+        return local_reference_count_;
+    }
+
+    void add_local_reference() {
+        check_owner_thread();
+        local_reference_count_++;
+    }
+
+    void release_local_reference() {
+        check_owner_thread();
+        if (--local_reference_count_ == 0) {
+            ReferenceCounter* shared_reference_counter = shared_reference_counter_;
+            if (!is_embedded_) {
+                ldelete(DefaultAllocator::get_instance(), this);
+            }
+            // Last, an embedded counter is freed along with the shared one.
+            shared_reference_counter->release_shared_reference();
+        }
+    }
+
+    /**
+     * @brief Takes a new shared reference on `shared_reference_counter`.
+     */
+    explicit LocalReferenceCounter(ReferenceCounter* shared_reference_counter)
+        : LocalReferenceCounter(shared_reference_counter, AdoptReferenceTag()) {
+        shared_reference_counter_->add_shared_reference();
+    }
+
+    /**
+     * @brief Takes over a shared reference already counted, e.g. the one a new counter starts with.
+     * An embedded counter lives in the block of the shared one and is not freed on its own.
+     */
+    LocalReferenceCounter(ReferenceCounter* shared_reference_counter, AdoptReferenceTag, bool is_embedded = false)
+        : shared_reference_counter_(shared_reference_counter)
+        , local_reference_count_(1)
+        , is_embedded_(is_embedded)
+#ifdef LDEBUG
+        , owner_thread_(std::this_thread::get_id())
+#endif
+    {
+        LCHECK(shared_reference_counter_);
+    }
+
+    LocalReferenceCounter(const LocalReferenceCounter&) = delete;
+    LocalReferenceCounter& operator=(const LocalReferenceCounter&) = delete;
+
+private:
+    void check_owner_thread() const {
+#ifdef LDEBUG
+        LCHECK_MSG(owner_thread_ == std::this_thread::get_id(), "LocalRef used outside of the thread that created it.");
+#endif
+    }
+
+private:
+    ReferenceCounter* shared_reference_counter_;
+    int32 local_reference_count_;
+    bool is_embedded_;
+#ifdef LDEBUG
+    std::thread::id owner_thread_;
+#endif
+};
+
+/**
+ * @brief Reference for resources that stay on one thread: copies and releases touch a plain count
+ * instead of the atomic one of `SharedRef`.
+ *
+ * A `LocalRef` may only be copied or destroyed by the thread that created it, which debug builds check.
+ * Crossing threads goes through `to_shared` on the sending side and `LocalRef(const SharedRef&)` on the receiving one.
+ */
+template <typename ResourceType>
+class LocalRef {
+public:
+    ResourceType& operator*() const {
+        return *resource_;
+    }
+
+    ResourceType* operator->() const { return resource_; }
+
+    ResourceType* get_resource() const { return resource_; }
+
+    int32 get_local_reference_count() const {
+        return reference_counter_->get_local_reference_count();
+    }
+
+    bool is_valid() const { return resource_ != nullptr; }
+
+    explicit operator bool() const { return is_valid(); }
+
+    /**
+     * @brief Shares the resource with other threads, one atomic increment.
+     */
+    SharedRef<ResourceType> to_shared() const {
+        if (!reference_counter_) {
+            return SharedRef<ResourceType>();
+        }
+        return SharedRef<ResourceType>(resource_, reference_counter_->get_shared_reference_counter());
+    }
+
+    void reset() {
+        release_local_reference();
+    }
+
+public:
+    LocalRef() noexcept = default;
+
+    /**
+     * @brief Starts a group of local references on the calling thread, holding one reference of `shared`.
+     * Allocates the counter of the group.
+     */
+    explicit LocalRef(const SharedRef<ResourceType>& shared) noexcept
+        : resource_(shared.get_resource()) {
+        if (resource_) {
+            reference_counter_ = lnew_args<LocalReferenceCounter>(DefaultAllocator::get_instance(), shared.get_reference_counter());
+        }
+    }
+
+    LocalRef(ResourceType* resource, LocalReferenceCounter* reference_counter, AdoptReferenceTag) noexcept
+        : resource_(resource)
+        , reference_counter_(reference_counter) {
+    }
+
+    LocalRef(const LocalRef& other) noexcept
+        : resource_(other.resource_)
+        , reference_counter_(other.reference_counter_) {
+        if (reference_counter_) {
+            reference_counter_->add_local_reference();
+        }
+    }
+
+    template <typename DerivedType>
+        requires std::derived_from<DerivedType, ResourceType>
+    LocalRef(const LocalRef<DerivedType>& other) noexcept
+        : resource_(other.resource_)
+        , reference_counter_(other.reference_counter_) {
+        if (reference_counter_) {
+            reference_counter_->add_local_reference();
+        }
+    }
+
+    LocalRef(LocalRef&& other) noexcept
+        : resource_(std::exchange(other.resource_, nullptr))
+        , reference_counter_(std::exchange(other.reference_counter_, nullptr)) {
+    }
+
+    template <typename DerivedType>
+        requires std::derived_from<DerivedType, ResourceType>
+    LocalRef(LocalRef<DerivedType>&& other) noexcept
+        : resource_(std::exchange(other.resource_, nullptr))
+        , reference_counter_(std::exchange(other.reference_counter_, nullptr)) {
+    }
+
+    LocalRef& operator=(const LocalRef& other) noexcept {
+        if (other.reference_counter_) {
+            other.reference_counter_->add_local_reference();
+        }
+        release_local_reference();
+
+        resource_ = other.resource_;
+        reference_counter_ = other.reference_counter_;
+        return *this;
+    }
+
+    template <typename DerivedType>
+        requires std::derived_from<DerivedType, ResourceType>
+    LocalRef& operator=(const LocalRef<DerivedType>& other) noexcept {
+        if (other.reference_counter_) {
+            other.reference_counter_->add_local_reference();
+        }
+        release_local_reference();
+
+        resource_ = other.resource_;
+        reference_counter_ = other.reference_counter_;
+        return *this;
+    }
+
+    LocalRef& operator=(LocalRef&& other) noexcept {
+        if (this != &other) {
+            release_local_reference();
+            resource_ = std::exchange(other.resource_, nullptr);
+            reference_counter_ = std::exchange(other.reference_counter_, nullptr);
+        }
+        return *this;
+    }
+
+    template <typename DerivedType>
+        requires std::derived_from<DerivedType, ResourceType>
+    LocalRef& operator=(LocalRef<DerivedType>&& other) noexcept {
+        release_local_reference();
+        resource_ = std::exchange(other.resource_, nullptr);
+        reference_counter_ = std::exchange(other.reference_counter_, nullptr);
+        return *this;
+    }
+
+    ~LocalRef() noexcept {
+        release_local_reference();
+    }
+
+public:
+    void release_local_reference() {
+        if (reference_counter_) {
+            reference_counter_->release_local_reference();
+        }
+        resource_ = nullptr;
+        reference_counter_ = nullptr;
+    }
+
+    template <typename OtherResourceType>
+    friend class LocalRef;
+
+private:
+    ResourceType* resource_ = nullptr;
+    LocalReferenceCounter* reference_counter_ = nullptr;
+};
+
+template <typename ResourceType>
+struct TriviallyRelocatable<LocalRef<ResourceType>> : std::true_type {};
+
+/**
+ * @brief Shared counter, first local group and resource in a single block, see `new_local_ref`.
+ * The local group starts with the reference the shared counter starts with.
+ */
+template <typename ResourceType>
+class LocalInlineReferenceCounter : public ReferenceCounter {
+public:
+    ResourceType* get_resource() {
+        return reinterpret_cast<ResourceType*>(&storage_);
+    }
+
+    LocalReferenceCounter* get_local_reference_counter() {
+        return &local_reference_counter_;
+    }
+
+    template <typename... Args>
+    explicit LocalInlineReferenceCounter(Args&&... args)
+        : ReferenceCounter(&destroy)
+        , local_reference_counter_(this, AdoptReferenceTag(), true) {
+        lplacement_new(&storage_) ResourceType(std::forward<Args>(args)...);
+    }
+
+private:
+    static void destroy(ReferenceCounter* counter) {
+        auto* self = static_cast<LocalInlineReferenceCounter*>(counter);
+        if constexpr (std::is_destructible_v<ResourceType>) {
+            self->get_resource()->~ResourceType();
+        }
+        ldelete(DefaultAllocator::get_instance(), self);
+    }
+
+private:
+    LocalReferenceCounter local_reference_counter_;
+    AlignedStorageType<ResourceType> storage_;
+};
+
+/**
+ * @brief Constructs the resource as `new_ref` does, in a single allocation holding the local count as well.
+ */
+template <typename ResourceType, typename... Args>
+inline LocalRef<ResourceType> new_local_ref(Args&&... args) noexcept {
+    using RefCounter = LocalInlineReferenceCounter<ResourceType>;
+    RefCounter* reference_counter = lnew_args<RefCounter>(DefaultAllocator::get_instance(), std::forward<Args>(args)...);
+    if (!reference_counter) {
+        return LocalRef<ResourceType>();
+    }
+    return LocalRef<ResourceType>(reference_counter->get_resource(), reference_counter->get_local_reference_counter(), AdoptReferenceTag());
+}
+
+template <typename ResourceType>
+bool operator==(const LocalRef<ResourceType>& lhs, const LocalRef<ResourceType>& rhs) {
+    return lhs.get_resource() == rhs.get_resource();
+}
+
+}  // namespace licht
+
+template <typename ResourceType>
+struct std::hash<licht::LocalRef<ResourceType>> {
+    size_t operator()(const licht::LocalRef<ResourceType>& ref) const {
+        return std::hash<ResourceType*>()(ref.get_resource());
+    }
+};
@@ -66,7 +66,7 @@ public:
     LICHT_CORE_API static bool is_aligned(const uintptr_t address, size_t alignment);
 
     /**
-     * @brief Allocates a block of memory of the specified size.
+     * @brief Allocates a block of memory of the specified size, see `SizeClassAllocator`.
      *
      * @param size The size of the memory block to allocate, in bytes.
      * @return A pointer to the allocated memory block.
@@ -78,7 +78,8 @@ public:
      * @brief Frees a previously allocated block of memory.
      *
      * @param block A pointer to the memory block to free.
-     * @param size The size of the memory block, in bytes.
+     * @param size The size of the memory block, in bytes. Must be the size, and alignment,
+     * the block was allocated with: they select the size class it belongs to.
      */
     LICHT_CORE_API static void free(void* block, size_t size) noexcept;
     LICHT_CORE_API static void free(void* block, size_t size, size_t alignment) noexcept;
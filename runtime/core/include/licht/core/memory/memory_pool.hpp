@@ -1,21 +1,49 @@
 #pragma once
 
+#include <atomic>
+#include <bit>
+#include <mutex>
 #include <type_traits>
+
 #include "allocator.hpp"
-#include "licht/core/containers/array.hpp"
+#include "licht/core/defines.hpp"
+#include "licht/core/memory/default_allocator.hpp"
 #include "licht/core/traits/aligned_storage.hpp"
 #include "memory.hpp"
 
 namespace licht {
 
-template <typename ResourceType>
+enum class MemoryPoolThreading {
+    /**
+     * @brief Only one thread at a time uses the pool.
+     */
+    Single,
+
+    /**
+     * @brief Any thread may allocate and deallocate resources, the free list is lock-free.
+     * The pool only locks to grow. `for_each` and `dispose` still require no concurrent use.
+     */
+    Concurrent
+};
+
+/**
+ * @brief Pool of fixed-size blocks for resources of one type, which never move once allocated.
+ *
+ * Blocks live in chunks, each twice as large as the previous one. Each chunk keeps one occupancy bit
+ * per block, so that `for_each` visits the live resources in O(capacity / 64 + live).
+ * Free blocks are chained by index through their own storage. In the concurrent mode,
+ * the head of that chain is tagged with a counter bumped by every change, against the ABA problem.
+ */
+template <typename ResourceType, MemoryPoolThreading threading = MemoryPoolThreading::Single>
 class MemoryPool {
 public:
     union Block {
         AlignedStorageType<ResourceType> storage;
-        Block* next;
+        uint32 next;
     };
 
+    static constexpr size_t max_chunk_count = 32;
+
 public:
     void initialize_pool(Allocator* allocator, size_t block_count = 64);
 
@@ -30,89 +58,182 @@ public:
 
     void dispose();
 
-    template<typename Functor>
+    /**
+     * @brief Calls `functor(resource)` for each allocated resource, in the order of the blocks.
+     */
+    template <typename Functor>
     void for_each(Functor&& functor);
 
     Allocator* get_allocator() {
         return allocator_;
     }
 
+    /**
+     * @brief Number of blocks of the first chunk.
+     */
     size_t get_block_count() {
         return block_count_;
     }
 
+    /**
+     * @brief Number of chunks allocated.
+     */
     size_t get_block_size() {
-        return blocks_.size();
+        return chunk_count_.load(std::memory_order_acquire);
     }
 
+    /**
+     * @brief Number of blocks of all the chunks allocated.
+     */
     size_t get_block_capacity() {
-        return blocks_.capacity();
+        return get_chunk_first_index(get_block_size());
     }
 
 public:
     MemoryPool();
     ~MemoryPool();
 
+    MemoryPool(const MemoryPool&) = delete;
+    MemoryPool& operator=(const MemoryPool&) = delete;
+
 private:
+    static constexpr uint32 invalid_index = ~uint32(0);
+    static constexpr size_t word_bits = 64;
+
+    static constexpr uint64 make_head(uint32 index, uint32 tag) {
+        return (static_cast<uint64>(tag) << 32) | index;
+    }
+
+    static constexpr uint32 get_head_index(uint64 head) {
+        return static_cast<uint32>(head);
+    }
+
+    static constexpr uint32 get_head_tag(uint64 head) {
+        return static_cast<uint32>(head >> 32);
+    }
+
+    size_t get_chunk_size(size_t chunk) const {
+        return block_count_ << chunk;
+    }
+
+    size_t get_chunk_first_index(size_t chunk) const {
+        return block_count_ * ((size_t(1) << chunk) - 1);
+    }
+
+    size_t get_chunk_of_index(uint32 index) const {
+        return std::bit_width(index / block_count_ + 1) - 1;
+    }
+
+    Block* get_block(uint32 index) const;
+
+    uint32 get_index(const Block* block) const;
+
+    /**
+     * @brief Word holding the occupancy bit of the block, and the mask of that bit.
+     */
+    std::atomic<uint64>* get_occupancy_word(uint32 index, uint64& out_bit) const;
+
+    uint32 pop_free_block();
+
+    void push_free_blocks(uint32 first, Block* last);
+
+    /**
+     * @brief Allocates the next chunk and chains its blocks in front of the free list.
+     */
     void grow();
 
 private:
     Allocator* allocator_;
-    Block* free_block_;
-    Array<Block*> blocks_;
     size_t block_count_;
-    size_t grow_factor_;
-};
 
-template <typename ResourceType>
-MemoryPool<ResourceType>::MemoryPool()
-    : allocator_(&DefaultAllocator::get_instance()), free_block_(nullptr), block_count_(64), blocks_(NoAllocationOnConstructionPolicy()), grow_factor_(2) {}
+    std::atomic<uint64> free_head_;
+
+    std::atomic<Block*> chunks_[max_chunk_count];
+    std::atomic<uint64>* occupancy_[max_chunk_count];
+    std::atomic<size_t> chunk_count_;
+
+    std::mutex grow_mutex_;
+};
 
 template <typename ResourceType>
-MemoryPool<ResourceType>::~MemoryPool() {
+using ConcurrentMemoryPool = MemoryPool<ResourceType, MemoryPoolThreading::Concurrent>;
+
+template <typename ResourceType, MemoryPoolThreading threading>
+MemoryPool<ResourceType, threading>::MemoryPool()
+    : allocator_(&DefaultAllocator::get_instance())
+    , block_count_(64)
+    , free_head_(make_head(invalid_index, 0))
+    , chunks_{}
+    , occupancy_{}
+    , chunk_count_(0) {}
+
+template <typename ResourceType, MemoryPoolThreading threading>
+MemoryPool<ResourceType, threading>::~MemoryPool() {
     dispose();
 }
 
-template <typename ResourceType>
-void MemoryPool<ResourceType>::initialize_pool(Allocator* allocator, size_t block_count) {
+template <typename ResourceType, MemoryPoolThreading threading>
+void MemoryPool<ResourceType, threading>::initialize_pool(Allocator* allocator, size_t block_count) {
+    LCHECK_MSG(block_count > 0, "A pool needs at least one block per chunk.");
+
+    dispose();
     allocator_ = allocator;
     block_count_ = block_count;
-    blocks_ = Array<Block*>();
     grow();
 }
 
-template <typename ResourceType>
-ResourceType* MemoryPool<ResourceType>::allocate_resource() {
-    if (!free_block_) {
+template <typename ResourceType, MemoryPoolThreading threading>
+ResourceType* MemoryPool<ResourceType, threading>::allocate_resource() {
+    uint32 index = pop_free_block();
+    while (index == invalid_index) {
         grow();
+        index = pop_free_block();
     }
 
-    Block* block = free_block_;
-    free_block_ = block->next;
-    return reinterpret_cast<ResourceType*>(&block->storage);
+    uint64 bit;
+    std::atomic<uint64>* word = get_occupancy_word(index, bit);
+    if constexpr (threading == MemoryPoolThreading::Concurrent) {
+        word->fetch_or(bit, std::memory_order_relaxed);
+    } else {
+        word->store(word->load(std::memory_order_relaxed) | bit, std::memory_order_relaxed);
+    }
+
+    return reinterpret_cast<ResourceType*>(&get_block(index)->storage);
 }
 
-template <typename ResourceType>
-void MemoryPool<ResourceType>::deallocate_resource(ResourceType* resource) {
+template <typename ResourceType, MemoryPoolThreading threading>
+void MemoryPool<ResourceType, threading>::deallocate_resource(ResourceType* resource) {
     if (!resource) {
         return;
     }
 
     Block* block = reinterpret_cast<Block*>(resource);
-    block->next = free_block_;
-    free_block_ = block;
+    const uint32 index = get_index(block);
+
+    uint64 bit;
+    std::atomic<uint64>* word = get_occupancy_word(index, bit);
+    [[maybe_unused]] uint64 previous;
+    if constexpr (threading == MemoryPoolThreading::Concurrent) {
+        previous = word->fetch_and(~bit, std::memory_order_relaxed);
+    } else {
+        previous = word->load(std::memory_order_relaxed);
+        word->store(previous & ~bit, std::memory_order_relaxed);
+    }
+    LCHECK_MSG(previous & bit, "Resource deallocated twice.");
+
+    push_free_blocks(index, block);
 }
 
-template <typename ResourceType>
+template <typename ResourceType, MemoryPoolThreading threading>
 template <typename... Args>
-ResourceType* MemoryPool<ResourceType>::new_resource(Args&&... args) {
+ResourceType* MemoryPool<ResourceType, threading>::new_resource(Args&&... args) {
     ResourceType* resource = allocate_resource();
     lplacement_new(resource) ResourceType(std::forward<Args>(args)...);
     return resource;
 }
 
-template <typename ResourceType>
-void MemoryPool<ResourceType>::destroy_resource(ResourceType* resource) {
+template <typename ResourceType, MemoryPoolThreading threading>
+void MemoryPool<ResourceType, threading>::destroy_resource(ResourceType* resource) {
     if (!resource) {
         return;
     }
@@ -124,54 +245,140 @@ void MemoryPool<ResourceType>::destroy_resource(ResourceType* resource) {
     deallocate_resource(resource);
 }
 
-template <typename ResourceType>
-void MemoryPool<ResourceType>::dispose() {
-    for (Block* block : blocks_) {
-        allocator_->deallocate(block, block_count_ * sizeof(Block));
-    }
-    blocks_.clear();
-    free_block_ = nullptr;
-}
+template <typename ResourceType, MemoryPoolThreading threading>
+void MemoryPool<ResourceType, threading>::dispose() {
+    const size_t chunk_count = chunk_count_.load(std::memory_order_acquire);
+    for (size_t chunk = 0; chunk < chunk_count; chunk++) {
+        const size_t chunk_size = get_chunk_size(chunk);
+        const size_t word_count = (chunk_size + word_bits - 1) / word_bits;
 
-template <typename ResourceType>
-void MemoryPool<ResourceType>::grow() {
-    Block* new_block = static_cast<Block*>(allocator_->allocate(block_count_ * sizeof(Block)));
-    blocks_.append(new_block);
+        allocator_->deallocate(chunks_[chunk].load(std::memory_order_relaxed), chunk_size * sizeof(Block));
+        allocator_->deallocate(occupancy_[chunk], word_count * sizeof(uint64));
 
-    for (size_t i = 0; i < block_count_ - 1; i++) {
-        new_block[i].next = &new_block[i + 1];
+        chunks_[chunk].store(nullptr, std::memory_order_relaxed);
+        occupancy_[chunk] = nullptr;
     }
 
-    new_block[block_count_ - 1].next = free_block_;
-    free_block_ = new_block;
+    chunk_count_.store(0, std::memory_order_release);
+    free_head_.store(make_head(invalid_index, 0), std::memory_order_relaxed);
 }
 
-template <typename ResourceType>
+template <typename ResourceType, MemoryPoolThreading threading>
 template <typename Functor>
-void MemoryPool<ResourceType>::for_each(Functor&& functor) {
-    Array<Block*> free_blocks(64);
-    for (Block* b = free_block_; b != nullptr; b = b->next) {
-        free_blocks.append(b);
-    }
-
-    for (Block* chunk : blocks_) {
-        for (size_t i = 0; i < block_count_; ++i) {
-            Block* current = &chunk[i];
-
-            bool is_free = false;
-            for (Block* fb : free_blocks) {
-                if (fb == current) {
-                    is_free = true;
-                    break;
-                }
+void MemoryPool<ResourceType, threading>::for_each(Functor&& functor) {
+    const size_t chunk_count = chunk_count_.load(std::memory_order_acquire);
+    for (size_t chunk = 0; chunk < chunk_count; chunk++) {
+        Block* blocks = chunks_[chunk].load(std::memory_order_relaxed);
+        const size_t word_count = (get_chunk_size(chunk) + word_bits - 1) / word_bits;
+
+        for (size_t i = 0; i < word_count; i++) {
+            // Snapshot of the word: the functor may destroy the resources it is given.
+            for (uint64 word = occupancy_[chunk][i].load(std::memory_order_relaxed); word != 0; word &= word - 1) {
+                const size_t block = i * word_bits + static_cast<size_t>(std::countr_zero(word));
+                functor(reinterpret_cast<ResourceType*>(&blocks[block].storage));
             }
+        }
+    }
+}
+
+template <typename ResourceType, MemoryPoolThreading threading>
+typename MemoryPool<ResourceType, threading>::Block* MemoryPool<ResourceType, threading>::get_block(uint32 index) const {
+    const size_t chunk = get_chunk_of_index(index);
+    return chunks_[chunk].load(std::memory_order_acquire) + (index - get_chunk_first_index(chunk));
+}
 
-            if (!is_free) {
-                ResourceType* resource = reinterpret_cast<ResourceType*>(&current->storage);
-                functor(resource);
+template <typename ResourceType, MemoryPoolThreading threading>
+uint32 MemoryPool<ResourceType, threading>::get_index(const Block* block) const {
+    const size_t chunk_count = chunk_count_.load(std::memory_order_acquire);
+    for (size_t chunk = 0; chunk < chunk_count; chunk++) {
+        const Block* blocks = chunks_[chunk].load(std::memory_order_relaxed);
+        if (block >= blocks && block < blocks + get_chunk_size(chunk)) {
+            return static_cast<uint32>(get_chunk_first_index(chunk) + (block - blocks));
+        }
+    }
+
+    LCHECK_MSG(false, "Resource does not belong to this pool.");
+    return invalid_index;
+}
+
+template <typename ResourceType, MemoryPoolThreading threading>
+std::atomic<uint64>* MemoryPool<ResourceType, threading>::get_occupancy_word(uint32 index, uint64& out_bit) const {
+    const size_t chunk = get_chunk_of_index(index);
+    const size_t block = index - get_chunk_first_index(chunk);
+    out_bit = uint64(1) << (block % word_bits);
+    return &occupancy_[chunk][block / word_bits];
+}
+
+template <typename ResourceType, MemoryPoolThreading threading>
+uint32 MemoryPool<ResourceType, threading>::pop_free_block() {
+    if constexpr (threading == MemoryPoolThreading::Concurrent) {
+        uint64 head = free_head_.load(std::memory_order_acquire);
+        while (get_head_index(head) != invalid_index) {
+            // The block may be popped and reused by another thread meanwhile, then the tag has changed
+            // and the exchange fails: the stale `next` read is never published.
+            const uint32 next = std::atomic_ref<uint32>(get_block(get_head_index(head))->next).load(std::memory_order_relaxed);
+            if (free_head_.compare_exchange_weak(head, make_head(next, get_head_tag(head) + 1),
+                                                 std::memory_order_acquire, std::memory_order_acquire)) {
+                return get_head_index(head);
             }
         }
+        return invalid_index;
+    } else {
+        const uint32 index = get_head_index(free_head_.load(std::memory_order_relaxed));
+        if (index != invalid_index) {
+            free_head_.store(make_head(get_block(index)->next, 0), std::memory_order_relaxed);
+        }
+        return index;
+    }
+}
+
+template <typename ResourceType, MemoryPoolThreading threading>
+void MemoryPool<ResourceType, threading>::push_free_blocks(uint32 first, Block* last) {
+    if constexpr (threading == MemoryPoolThreading::Concurrent) {
+        uint64 head = free_head_.load(std::memory_order_relaxed);
+        do {
+            std::atomic_ref<uint32>(last->next).store(get_head_index(head), std::memory_order_relaxed);
+        } while (!free_head_.compare_exchange_weak(head, make_head(first, get_head_tag(head) + 1),
+                                                   std::memory_order_release, std::memory_order_relaxed));
+    } else {
+        last->next = get_head_index(free_head_.load(std::memory_order_relaxed));
+        free_head_.store(make_head(first, 0), std::memory_order_relaxed);
+    }
+}
+
+template <typename ResourceType, MemoryPoolThreading threading>
+void MemoryPool<ResourceType, threading>::grow() {
+    std::unique_lock<std::mutex> lock;
+    if constexpr (threading == MemoryPoolThreading::Concurrent) {
+        lock = std::unique_lock<std::mutex>(grow_mutex_);
+
+        // Another thread may have grown the pool while this one waited.
+        if (get_head_index(free_head_.load(std::memory_order_acquire)) != invalid_index) {
+            return;
+        }
+    }
+
+    const size_t chunk = chunk_count_.load(std::memory_order_relaxed);
+    LCHECK_MSG(chunk < max_chunk_count && get_chunk_first_index(chunk + 1) <= invalid_index, "Memory pool is full.");
+
+    const size_t chunk_size = get_chunk_size(chunk);
+    const size_t word_count = (chunk_size + word_bits - 1) / word_bits;
+
+    Block* blocks = static_cast<Block*>(allocator_->allocate(chunk_size * sizeof(Block)));
+    occupancy_[chunk] = static_cast<std::atomic<uint64>*>(allocator_->allocate(word_count * sizeof(uint64)));
+    for (size_t i = 0; i < word_count; i++) {
+        lplacement_new(&occupancy_[chunk][i]) std::atomic<uint64>(0);
     }
+
+    const uint32 first = static_cast<uint32>(get_chunk_first_index(chunk));
+    for (size_t i = 0; i < chunk_size - 1; i++) {
+        blocks[i].next = first + static_cast<uint32>(i) + 1;
+    }
+
+    chunks_[chunk].store(blocks, std::memory_order_release);
+    chunk_count_.store(chunk + 1, std::memory_order_release);
+
+    push_free_blocks(first, &blocks[chunk_size - 1]);
 }
 
-}  //namespace licht
\ No newline at end of file
+}  //namespace licht
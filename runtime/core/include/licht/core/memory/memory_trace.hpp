@@ -2,28 +2,149 @@
 
 #include "licht/core/core_exports.hpp"
 #include "licht/core/defines.hpp"
+#include "licht/core/string/string_ref.hpp"
 
 namespace licht {
 
+/**
+ * @brief Subsystem an allocation is accounted to, the one of the innermost `MemoryTagScope` of the thread.
+ */
+enum class MemoryTag : uint8 {
+    General,
+    Containers,
+    Strings,
+    Jobs,
+    Messaging,
+    Assets,
+    RHI,
+    Renderer,
+    Engine,
+    Count
+};
+
+constexpr size_t memory_tag_count = static_cast<size_t>(MemoryTag::Count);
+
+LICHT_CORE_API StringRef memory_tag_to_string(MemoryTag tag);
+
+/**
+ * @brief Allocation sizes are counted in power of two buckets: up to 16 bytes, up to 32 bytes... and over 1 MiB.
+ */
+constexpr size_t memory_trace_histogram_size = 18;
+
+struct MemoryTagStatistics {
+    /**
+     * @brief Bytes allocated and not freed yet. Frees are accounted to the tag the block was allocated under,
+     * whichever tag the freeing thread is in.
+     */
+    int64 current_bytes = 0;
+
+    /**
+     * @brief Largest `current_bytes` reached since the start of the program, updated on every allocation.
+     */
+    int64 peak_bytes = 0;
+
+    uint64 allocated_bytes = 0;
+    uint64 freed_bytes = 0;
+    uint64 allocation_count = 0;
+    uint64 free_count = 0;
+
+    /**
+     * @brief Allocations during the last completed frame, see `MemoryTrace::global_mark_frame`.
+     */
+    uint64 frame_allocation_count = 0;
+
+    uint64 size_histogram[memory_trace_histogram_size] = {};
+};
+
+struct LICHT_CORE_API MemoryTraceSnapshot {
+    MemoryTagStatistics tags[memory_tag_count];
+
+    /**
+     * @brief Number of frames marked when the snapshot was captured.
+     */
+    uint64 frame_index = 0;
+
+    const MemoryTagStatistics& get(MemoryTag tag) const {
+        return tags[static_cast<size_t>(tag)];
+    }
+
+    /**
+     * @brief Sum of the statistics of every tag.
+     */
+    MemoryTagStatistics get_total() const;
+
+    /**
+     * @brief What happened between `before` and this snapshot: counters become differences,
+     * peaks and per-frame counts stay the ones of this snapshot.
+     */
+    MemoryTraceSnapshot diff(const MemoryTraceSnapshot& before) const;
+};
+
+/**
+ * @brief Process-wide allocation accounting fed by `Memory::allocate` and `Memory::free`.
+ *
+ * Each thread counts into a block of its own, written without atomic read-modify-writes,
+ * and readers sum the blocks of every thread. Blocks of exited threads are handed to new threads,
+ * so counters only ever grow and the sums stay exact.
+ */
 class LICHT_CORE_API MemoryTrace {
 public:
-    static void global_add_freed_bytes(uint64 size);
+    /**
+     * @param allocation_tag Tag the block was allocated under, recorded with it by `SizeClassAllocator`.
+     */
+    static void global_add_freed_bytes(uint64 size, MemoryTag allocation_tag);
 
-    static void global_add_allocate_bytes(uint64 size);
+    static void global_add_allocate_bytes(uint64 size, MemoryTag allocation_tag);
 
     static size_t global_get_memory_usage();
 
-private:
-    static MemoryTrace& get_default();
+    /**
+     * @brief Number of allocations made since the start of the program.
+     */
+    static size_t global_get_allocation_count();
 
-    void add_freed_bytes(uint64 size);
-    void add_allocate_bytes(uint64 size);
-    size_t get_memory_usage() const;
+    /**
+     * @brief Ends a frame: per-frame counts are taken against the previous mark.
+     * Called once per frame by the engine loop.
+     */
+    static void global_mark_frame();
 
-private:
-    uint64 memory_usage_;
+    /**
+     * @brief Number of allocations made during the last completed frame, by every thread.
+     */
+    static size_t global_get_frame_allocation_count();
+
+    static MemoryTraceSnapshot global_capture_snapshot();
+
+    /**
+     * @brief Logs the tags of `snapshot` with any allocation, one line each.
+     */
+    static void global_dump_snapshot(const MemoryTraceSnapshot& snapshot);
+
+    static MemoryTag get_current_tag();
+
+    static void set_current_tag(MemoryTag tag);
 };
 
+/**
+ * @brief Accounts the allocations and frees of the calling thread to `tag` until the end of the scope.
+ */
+class MemoryTagScope {
+public:
+    explicit MemoryTagScope(MemoryTag tag)
+        : previous_tag_(MemoryTrace::get_current_tag()) {
+        MemoryTrace::set_current_tag(tag);
+    }
+
+    ~MemoryTagScope() {
+        MemoryTrace::set_current_tag(previous_tag_);
+    }
 
+    MemoryTagScope(const MemoryTagScope&) = delete;
+    MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+private:
+    MemoryTag previous_tag_;
+};
 
-}  //namespace licht
\ No newline at end of file
+}  //namespace licht
@@ -7,19 +7,21 @@
 #include "licht/core/memory/default_allocator.hpp"
 #include "licht/core/memory/deleter.hpp"
 #include "licht/core/memory/memory.hpp"
+#include "licht/core/traits/aligned_storage.hpp"
 
 namespace licht {
 
+/**
+ * @brief Shared count of a `SharedRef`. Concrete counters pass the function freeing the resource and themselves,
+ * a single indirect call made when the last reference goes away.
+ */
 class LICHT_CORE_API ReferenceCounter {
 public:
     using RefCountType = std::atomic_int32_t;
 
-public:
-    ReferenceCounter() = default;
-    virtual ~ReferenceCounter() = default;
-
-    virtual void destroy_resource() = 0;
+    using DestroyFunction = void (*)(ReferenceCounter* counter);
 
+public:
     int32 get_shared_reference_count() const {
         return shared_reference_count_.load(std::memory_order_relaxed);
     }
@@ -33,57 +35,100 @@ public:
     }
 
     void release_shared_reference() {
-        int32 prev_count = shared_reference_count_.fetch_sub(1, std::memory_order_relaxed);
+        // The sole owner is the only one able to add a reference, so it can skip the read-modify-write.
+        if (shared_reference_count_.load(std::memory_order_acquire) == 1) {
+            destroy_function_(this);
+            return;
+        }
+
+        // Release so that every access through this reference happens before the destruction.
+        int32 prev_count = shared_reference_count_.fetch_sub(1, std::memory_order_release);
 
         if (prev_count == 1) {
             // Ensure destruction and deletion are synchronized.
             std::atomic_thread_fence(std::memory_order_acquire);
 
-            destroy_resource();
-            ldelete(DefaultAllocator::get_instance(), this);
+            destroy_function_(this);
         }
     }
 
+    ReferenceCounter(const ReferenceCounter&) = delete;
+    ReferenceCounter& operator=(const ReferenceCounter&) = delete;
+
+protected:
+    explicit ReferenceCounter(DestroyFunction destroy_function)
+        : shared_reference_count_(1)
+        , destroy_function_(destroy_function) {
+        LCHECK(destroy_function_);
+    }
+
+    ~ReferenceCounter() = default;
+
 protected:
-    RefCountType shared_reference_count_ = 1;
+    RefCountType shared_reference_count_;
+
+private:
+    DestroyFunction destroy_function_;
 };
 
 template <typename ResourceType, typename DeleterType>
 class ReferenceCounterWithDeleter : private DeleterDelegate<DeleterType>,
                                     public ReferenceCounter {
 public:
-    virtual void destroy_resource() override {
-        if (resource_) {
-            this->invoke(resource_);
-            resource_ = nullptr;
-        }
-    }
-
     ReferenceCounterWithDeleter(ResourceType* resource, const DeleterType& deleter)
         : DeleterDelegate<DeleterType>(deleter)
+        , ReferenceCounter(&destroy)
         , resource_(resource) {
         LCHECK(resource_);
     }
 
-    ReferenceCounterWithDeleter(const ReferenceCounterWithDeleter&) = delete;
-    ReferenceCounterWithDeleter& operator=(const ReferenceCounterWithDeleter&) = delete;
+private:
+    static void destroy(ReferenceCounter* counter) {
+        // Freed through its concrete type, so the sized free matches the allocation.
+        auto* self = static_cast<ReferenceCounterWithDeleter*>(counter);
+        self->invoke(self->resource_);
+        ldelete(DefaultAllocator::get_instance(), self);
+    }
 
-    ReferenceCounterWithDeleter(ReferenceCounterWithDeleter&& other) noexcept
-        : DeleterDelegate<DeleterType>(std::move(other))
-        , resource_(std::exchange(other.resource_, nullptr)) {}
+private:
+    ResourceType* resource_ = nullptr;
+};
 
-    ReferenceCounterWithDeleter& operator=(ReferenceCounterWithDeleter&& other) noexcept {
-        if (this != &other) {
-            destroy_resource();
+/**
+ * @brief Selects the constructors taking over a reference already counted, instead of adding one.
+ */
+struct AdoptReferenceTag {};
+
+/**
+ * @brief Counter holding its resource inline, so that `new_ref` makes one allocation instead of two
+ * and the count sits next to the object it guards.
+ *
+ * Starts with the reference adopted by the `SharedRef` returned from `new_ref`.
+ */
+template <typename ResourceType>
+class InlineReferenceCounter : public ReferenceCounter {
+public:
+    ResourceType* get_resource() {
+        return reinterpret_cast<ResourceType*>(&storage_);
+    }
+
+    template <typename... Args>
+    explicit InlineReferenceCounter(Args&&... args)
+        : ReferenceCounter(&destroy) {
+        lplacement_new(&storage_) ResourceType(std::forward<Args>(args)...);
+    }
 
-            DeleterDelegate<DeleterType>::operator=(std::move(other));
-            resource_ = std::exchange(other.resource_, nullptr);
+private:
+    static void destroy(ReferenceCounter* counter) {
+        auto* self = static_cast<InlineReferenceCounter*>(counter);
+        if constexpr (std::is_destructible_v<ResourceType>) {
+            self->get_resource()->~ResourceType();
         }
-        return *this;
+        ldelete(DefaultAllocator::get_instance(), self);
     }
 
 private:
-    ResourceType* resource_ = nullptr;
+    AlignedStorageType<ResourceType> storage_;
 };
 
 template <typename ResourceType, typename DeleterType>
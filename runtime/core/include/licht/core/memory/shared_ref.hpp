@@ -41,8 +41,14 @@ public:
         return reference_counter_->is_unique();
     }
 
+    void reset() {
+        release_shared_reference();
+        resource_ = nullptr;
+        reference_counter_ = nullptr;
+    }
+
     template <typename DeleterType = DefaultDeleter<ResourceType>>
-    void reset(ResourceType* resource = nullptr,
+    void reset(ResourceType* resource,
                DeleterType deleter = DeleterType()) {
         release_shared_reference();
 
@@ -75,12 +81,20 @@ public:
         }
     }
 
+    /**
+     * @brief Adopts the reference the counter starts with, see `new_ref`.
+     */
+    SharedRef(InlineReferenceCounter<ResourceType>* reference_counter, AdoptReferenceTag) noexcept
+        : resource_(reference_counter ? reference_counter->get_resource() : nullptr)
+        , reference_counter_(reference_counter) {
+    }
+
     template <typename DerivedType>
         requires std::derived_from<DerivedType, ResourceType>
     explicit SharedRef(DerivedType* resource) noexcept
         : resource_(resource) {
         if (resource_) {
-            reference_counter_ = new_default_reference_counter<DerivedType>(resource_);
+            reference_counter_ = new_default_reference_counter<DerivedType>(resource);
         }
     }
 
@@ -97,7 +111,7 @@ public:
     SharedRef(DerivedType* resource, DeleterType deleter) noexcept
         : resource_(resource) {
         if (resource_) {
-            reference_counter_ = new_reference_counter_with_deleter<DerivedType, DeleterType>(resource_, deleter);
+            reference_counter_ = new_reference_counter_with_deleter<DerivedType, DeleterType>(resource, deleter);
         }
     }
 
@@ -217,9 +231,16 @@ private:
     ReferenceCounter* reference_counter_ = nullptr;
 };
 
+template <typename ResourceType>
+struct TriviallyRelocatable<SharedRef<ResourceType>> : std::true_type {};
+
+/**
+ * @brief Constructs the resource and its counter in a single allocation.
+ */
 template <typename ResourceType, typename... Args>
-constexpr inline SharedRef<ResourceType> new_ref(Args&&... args) noexcept {
-    return SharedRef<ResourceType>(lnew_args<ResourceType>(DefaultAllocator::get_instance(), args...));
+inline SharedRef<ResourceType> new_ref(Args&&... args) noexcept {
+    using RefCounter = InlineReferenceCounter<ResourceType>;
+    return SharedRef<ResourceType>(lnew_args<RefCounter>(DefaultAllocator::get_instance(), std::forward<Args>(args)...), AdoptReferenceTag());
 }
 
 template <typename ResourceType>
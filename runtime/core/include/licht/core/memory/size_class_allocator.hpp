@@ -0,0 +1,81 @@
+#pragma once
+
+#include "licht/core/core_exports.hpp"
+#include "licht/core/defines.hpp"
+
+namespace licht {
+
+struct SizeClassAllocatorStatistics {
+    /**
+     * @brief Bytes of spans mapped from the OS, whether their blocks are in use or cached.
+     */
+    size_t span_bytes = 0;
+    size_t span_count = 0;
+
+    /**
+     * @brief Bytes of blocks too large for a size class, served by the system heap.
+     */
+    size_t large_bytes = 0;
+    size_t large_count = 0;
+};
+
+/**
+ * @brief General purpose allocator behind `Memory::allocate`, and so `DefaultAllocator`.
+ *
+ * Small blocks are rounded up to one of a few dozen size classes and carved from 64 KiB spans mapped from the OS,
+ * one size class per span. Every thread caches free blocks of each class in a list of its own, so that
+ * most allocations and frees touch no lock. The cache exchanges blocks with the span lists of the class in batches,
+ * whichever thread frees a block, and a span fully free is returned to the OS once a few are kept for reuse.
+ *
+ * Blocks are aligned by placement: each class lays its blocks out on the largest power of two dividing its size,
+ * so no header is stored next to a block. Frees are sized, the size and alignment given back must be
+ * the ones the block was allocated with. Larger blocks and alignments go to the system heap,
+ * behind a small header.
+ *
+ * Each block carries a one byte tag given at allocation, kept in its span or its header,
+ * e.g. the memory tag `Memory` accounts the block to until it is freed.
+ */
+class LICHT_CORE_API SizeClassAllocator {
+public:
+    static constexpr size_t span_size = 64 * 1024;
+    static constexpr size_t max_small_size = 8 * 1024;
+    static constexpr size_t max_small_alignment = 4 * 1024;
+    static constexpr size_t default_alignment = 16;
+
+    /**
+     * @brief Fully free spans kept mapped for reuse by any class before the next ones are unmapped.
+     */
+    static constexpr size_t max_retained_spans = 64;
+
+    static void* allocate(size_t size, size_t alignment = default_alignment, uint8 tag = 0);
+
+    /**
+     * @brief `size` and `alignment` must keep the block on the small or the large side it was allocated on.
+     * Small blocks go back to the class recorded in their span, whatever small size they are freed with.
+     * Debug builds check that a block freed small does live in a span.
+     */
+    static void free(void* block, size_t size, size_t alignment = default_alignment);
+
+    /**
+     * @brief Hands the blocks cached by the calling thread back to the spans, e.g. before a thread goes idle for long.
+     * Threads do it on their own when they exit.
+     */
+    static void flush_thread_cache();
+
+    /**
+     * @brief Tag `block` was allocated with, `size` and `alignment` being the ones it is freed with.
+     */
+    static uint8 get_tag(const void* block, size_t size, size_t alignment = default_alignment);
+
+    static SizeClassAllocatorStatistics get_statistics();
+
+    /**
+     * @brief Size actually reserved for a block of `size` bytes, the size of its class for small blocks.
+     */
+    static size_t get_allocation_size(size_t size, size_t alignment = default_alignment);
+
+public:
+    SizeClassAllocator() = delete;
+};
+
+}  //namespace licht
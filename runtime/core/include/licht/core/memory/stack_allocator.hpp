@@ -41,6 +41,16 @@ private:
 
 public:
     explicit StackAllocator(size_t size);
+
+    /**
+     * @brief Copies get an empty buffer of their own with the same size, blocks are never shared.
+     */
+    StackAllocator(const StackAllocator& other);
+    StackAllocator(StackAllocator&& other) noexcept;
+
+    StackAllocator& operator=(const StackAllocator& other);
+    StackAllocator& operator=(StackAllocator&& other) noexcept;
+
     ~StackAllocator();
 
 private:
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <type_traits>
+
+namespace licht {
+
+/**
+ * @brief Marks types whose objects can be moved to another address with a plain memory copy,
+ * the source then being released without running its destructor.
+ *
+ * Holds for every trivially copyable type. Types owning memory through pointers that never point
+ * inside the object itself (e.g. `Array`, `SharedRef`) can opt in with a specialization,
+ * which lets containers grow with a single `Memory::copy` instead of moving each element.
+ */
+template <typename Type>
+struct TriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<Type>> {};
+
+template <typename Type>
+concept CTriviallyRelocatable = TriviallyRelocatable<std::remove_cv_t<Type>>::value;
+
+}  //namespace licht
@@ -4,6 +4,7 @@
 
 #include "licht/core/memory/concepts.hpp"
 #include "licht/core/memory/memory.hpp"
+#include "licht/core/memory/trivially_relocatable.hpp"
 
 namespace licht {
 
@@ -191,4 +192,8 @@ protected:
     MemoryAllocatorType allocator_;
 };
 
+template <typename ElementType, typename AllocatorType, MemoryOwnership ownership>
+struct TriviallyRelocatable<TypedAllocator<ElementType, AllocatorType, ownership>>
+    : std::bool_constant<ownership == MemoryOwnership::NonOwner || TriviallyRelocatable<AllocatorType>::value> {};
+
 }  //namespace licht
\ No newline at end of file
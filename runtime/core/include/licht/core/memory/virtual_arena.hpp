@@ -0,0 +1,109 @@
+#pragma once
+
+#include "licht/core/core_exports.hpp"
+#include "licht/core/defines.hpp"
+#include "licht/core/memory/allocator.hpp"
+
+namespace licht {
+
+/**
+ * @brief Linear allocator over a range of address space reserved up front and committed as it fills.
+ *
+ * The arena grows without copying, so blocks keep their address until `reset` or `rewind`. The reservation
+ * only costs address space: an arena may reserve a few GiB and only ever commit a few MiB of it.
+ * `reset` gives the pages past the retained size back to the OS.
+ * Like `LinearAllocator`, it is not thread-safe and does not free blocks individually.
+ */
+class LICHT_CORE_API VirtualArena : public AlignedAllocator {
+public:
+    /**
+     * @brief Pages are committed by this many bytes at least, to keep system calls rare.
+     */
+    static constexpr size_t default_commit_size = 64 * 1024;
+
+    virtual void* allocate(size_t size, size_t alignment) override;
+
+    virtual void deallocate(void* block, size_t size, size_t alignment) override;
+
+public:
+    /**
+     * @param reserve_size Bytes of address space to reserve, the most the arena can hold.
+     * @param retained_size Bytes kept committed by `reset`, e.g. what the arena usually holds.
+     * @param use_huge_pages Asks for transparent huge pages where supported, committing by whole huge pages.
+     * @return false if the address space could not be reserved.
+     */
+    bool initialize(size_t reserve_size, size_t retained_size = 0, bool use_huge_pages = false);
+
+    void destroy();
+
+    /**
+     * @brief Frees every block and decommits the pages past the retained size.
+     */
+    void reset();
+
+    /**
+     * @brief Frees the blocks allocated since `get_offset` returned `offset`, keeping their pages committed.
+     */
+    void rewind(size_t offset);
+
+    /**
+     * @brief Resets the high-water mark to the current offset, e.g. to measure the next frame or level alone.
+     */
+    void reset_high_water_mark();
+
+    inline size_t get_offset() const {
+        return offset_;
+    }
+
+    /**
+     * @brief Largest offset reached since initialization or `reset_high_water_mark`.
+     */
+    inline size_t get_high_water_mark() const {
+        return high_water_mark_;
+    }
+
+    inline size_t get_committed_size() const {
+        return committed_size_;
+    }
+
+    inline size_t get_reserved_size() const {
+        return reserved_size_;
+    }
+
+    inline uint8* get_buffer() const {
+        return base_;
+    }
+
+    inline bool is_valid() const {
+        return base_ != nullptr;
+    }
+
+public:
+    VirtualArena();
+    VirtualArena(size_t reserve_size, size_t retained_size = 0, bool use_huge_pages = false);
+
+    VirtualArena(const VirtualArena&) = delete;
+    VirtualArena& operator=(const VirtualArena&) = delete;
+
+    VirtualArena(VirtualArena&& other) noexcept;
+    VirtualArena& operator=(VirtualArena&& other) noexcept;
+
+    ~VirtualArena();
+
+private:
+    /**
+     * @brief Commits pages up to `size` bytes from the base, rounded up to the commit size.
+     */
+    bool commit(size_t size);
+
+private:
+    uint8* base_;
+    size_t reserved_size_;
+    size_t committed_size_;
+    size_t retained_size_;
+    size_t commit_size_;
+    size_t offset_;
+    size_t high_water_mark_;
+};
+
+}  //namespace licht
@@ -1,53 +1,55 @@
 #pragma once
 
 #include "licht/core/containers/hash_map.hpp"
-#include "licht/core/function/function.hpp"
+#include "licht/core/function/inplace_function.hpp"
 #include "licht/core/memory/default_allocator.hpp"
 #include "licht/core/memory/memory.hpp"
 #include "licht/core/memory/shared_ref.hpp"
 #include "licht/core/modules/module.hpp"
 #include "licht/core/platform/dynamic_library.hpp"
+#include "licht/core/string/name.hpp"
+#include "licht/core/string/string.hpp"
 #include "licht/core/string/string_ref.hpp"
 
 namespace licht {
 
 class LICHT_CORE_API ModuleRegistry {
 public:
-    using ModuleInitializerFunc = Function<Module*()>;
+    using ModuleInitializerFunc = InplaceFunction<Module*()>;
 
     static ModuleRegistry& get_instance();
 
-    Module* load_module(StringRef name);
+    Module* load_module(Name name);
 
-    void unload_module(StringRef name);
+    void unload_module(Name name);
 
-    bool exists_module(StringRef name) const;
+    bool exists_module(Name name) const;
 
-    bool is_module_loaded(StringRef name) const;
+    bool is_module_loaded(Name name) const;
 
-    Module* get_module_interface(StringRef name);
+    Module* get_module_interface(Name name);
 
     template <typename ModuleType = Module>
-    ModuleType* get_module(const StringRef name) {
+    ModuleType* get_module(Name name) {
         return static_cast<ModuleType*>(get_module_interface(name));
     }
 
-    void register_module(StringRef name, const ModuleInitializerFunc& initializer);
+    void register_module(Name name, ModuleInitializerFunc&& initializer);
 
-    void unregister_module(StringRef name);
+    void unregister_module(Name name);
 
 private:
     struct LoadedModule {
-        StringRef name = "";
+        Name name;
         Module* module = nullptr;
         SharedRef<DynamicLibrary> library;
 
-        LoadedModule(const StringRef name, Module* module, const SharedRef<DynamicLibrary> library)
+        LoadedModule(Name name, Module* module, const SharedRef<DynamicLibrary> library)
             : name(name), module(module), library(library) {}
     };
 
-    HashMap<StringRef, LoadedModule> loaded_modules_;
-    HashMap<StringRef, ModuleInitializerFunc> pending_modules_;
+    HashMap<Name, LoadedModule> loaded_modules_;
+    HashMap<Name, ModuleInitializerFunc> pending_modules_;
 };
 
 template <typename ModuleType>
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "licht/core/defines.hpp"
+
+#include <thread>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace licht {
+
+/**
+ * @brief Size of the unit of coherence between cores. Data written by different threads is kept
+ * this far apart so that one thread's writes do not invalidate the line another one is reading.
+ */
+inline constexpr size_t cache_line_size = 64;
+
+/**
+ * @brief Hints the core that the thread is busy-waiting, to save power and leave the pipeline
+ * to a sibling hyper-thread.
+ */
+inline void cpu_pause() {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield");
+#endif
+}
+
+/**
+ * @brief Exponential backoff for spin loops: pauses a growing number of times,
+ * then yields the thread once spinning has gone on for too long.
+ */
+class SpinWait {
+public:
+    void wait() {
+        if (count_ < yield_threshold) {
+            for (uint32 i = 0; i < (1u << count_); i++) {
+                cpu_pause();
+            }
+            count_++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    void reset() {
+        count_ = 0;
+    }
+
+private:
+    static constexpr uint32 yield_threshold = 6;
+
+    uint32 count_ = 0;
+};
+
+}  //namespace licht
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/core_exports.hpp"
+#include "licht/core/defines.hpp"
+
+namespace licht {
+
+/**
+ * @brief Physical core and the logical processors (SMT siblings) it runs.
+ */
+struct CpuCore {
+    uint32 package = 0;
+    uint32 numa_node = 0;
+    Array<uint32> logical_processors;
+};
+
+/**
+ * @brief Cache shared by a group of logical processors, only L2 and beyond are listed.
+ */
+struct CpuCacheGroup {
+    uint32 level = 0;
+    size_t size = 0;
+    Array<uint32> logical_processors;
+};
+
+struct CpuNumaNode {
+    uint32 index = 0;
+    Array<uint32> logical_processors;
+};
+
+/**
+ * @brief Layout of the processors the process can run on. Logical processors are numbered as the OS does,
+ * and these numbers are what the affinity functions of `platform_thread.hpp` take.
+ */
+struct CpuTopology {
+    uint32 logical_processor_count = 0;
+    Array<CpuCore> cores;
+    Array<CpuCacheGroup> caches;
+    Array<CpuNumaNode> numa_nodes;
+
+    inline uint32 get_physical_core_count() const {
+        return static_cast<uint32>(cores.size());
+    }
+
+    /**
+     * @brief First logical processor of each core, i.e. one thread per core without SMT siblings.
+     */
+    Array<uint32> get_primary_logical_processors() const {
+        Array<uint32> processors(cores.size());
+        for (const CpuCore& core : cores) {
+            processors.append(core.logical_processors[0]);
+        }
+        return processors;
+    }
+
+    /**
+     * @brief Every cache group of the given level, one per cache, e.g. the L3 of each CCX to keep cooperating threads together.
+     */
+    Array<const CpuCacheGroup*> get_cache_groups(uint32 level) const {
+        Array<const CpuCacheGroup*> groups;
+        for (const CpuCacheGroup& cache : caches) {
+            if (cache.level == level) {
+                groups.append(&cache);
+            }
+        }
+        return groups;
+    }
+};
+
+/**
+ * @brief Topology of the machine, read from the OS once and cached.
+ * When the OS does not expose it, every logical processor is reported as its own core on a single node.
+ */
+LICHT_CORE_API const CpuTopology& platform_get_cpu_topology();
+
+}  //namespace licht
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "licht/core/core_exports.hpp"
+#include "licht/core/defines.hpp"
+
+namespace licht {
+
+/**
+ * @brief Size of a virtual memory page, the granularity of the page functions.
+ */
+LICHT_CORE_API size_t platform_get_page_size();
+
+/**
+ * @brief Maps `size` bytes of zeroed, read-write pages from the OS, bypassing the heap.
+ * @param alignment Power of two alignment of the returned address, at least the page size.
+ * @return nullptr if the OS is out of memory.
+ */
+LICHT_CORE_API void* platform_allocate_pages(size_t size, size_t alignment);
+
+/**
+ * @brief Returns pages mapped by `platform_allocate_pages` or reserved by `platform_reserve_pages` to the OS,
+ * `size` being the size they were mapped or reserved with.
+ */
+LICHT_CORE_API void platform_free_pages(void* block, size_t size);
+
+/**
+ * @brief Reserves `size` bytes of address space without backing them, any access faults until committed.
+ * @param alignment Power of two alignment of the returned address, at least the page size.
+ * @return nullptr if the address space is exhausted.
+ */
+LICHT_CORE_API void* platform_reserve_pages(size_t size, size_t alignment);
+
+/**
+ * @brief Makes reserved pages readable and writable. They read as zero until first written.
+ * @return false if the OS is out of memory.
+ */
+LICHT_CORE_API bool platform_commit_pages(void* block, size_t size);
+
+/**
+ * @brief Gives the physical memory of committed pages back to the OS, keeping their addresses reserved.
+ */
+LICHT_CORE_API void platform_decommit_pages(void* block, size_t size);
+
+/**
+ * @brief Asks the OS to back the range with huge pages when it can, e.g. transparent huge pages on Linux.
+ * @return false where the hint is not supported.
+ */
+LICHT_CORE_API bool platform_advise_huge_pages(void* block, size_t size);
+
+/**
+ * @brief Size of a huge page, 0 if the platform has none to offer without privileges.
+ */
+LICHT_CORE_API size_t platform_get_huge_page_size();
+
+}  //namespace licht
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/core_exports.hpp"
+#include "licht/core/defines.hpp"
+#include "licht/core/string/string_ref.hpp"
+
+#include <thread>
+
+namespace licht {
+
+enum class ThreadPriority : uint8 {
+    Lowest,
+    Low,
+    Normal,
+    High,
+    Highest,
+};
+
+/**
+ * @brief Restricts the calling thread to the given logical processors, see `CpuTopology`.
+ * @return false if the OS refused, e.g. none of the processors is available to the process.
+ */
+LICHT_CORE_API bool platform_set_current_thread_affinity(const Array<uint32>& logical_processors);
+
+LICHT_CORE_API bool platform_set_thread_affinity(std::thread& thread, const Array<uint32>& logical_processors);
+
+/**
+ * @brief Names the calling thread for debuggers and profilers. Linux keeps the first 15 characters.
+ */
+LICHT_CORE_API bool platform_set_current_thread_name(StringRef name);
+
+LICHT_CORE_API bool platform_set_thread_name(std::thread& thread, StringRef name);
+
+/**
+ * @brief Scheduling priority of the calling thread relative to the other threads of the process.
+ * Raising it above `Normal` may need privileges the process does not have, in which case it returns false.
+ */
+LICHT_CORE_API bool platform_set_current_thread_priority(ThreadPriority priority);
+
+}  //namespace licht
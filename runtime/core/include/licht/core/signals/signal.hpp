@@ -6,6 +6,7 @@
 #include "licht/core/containers/array.hpp"
 #include "licht/core/containers/hash_map.hpp"
 #include "licht/core/function/function_ref.hpp"
+#include "licht/core/function/unique_function.hpp"
 #include "licht/core/memory/shared_ref.hpp"
 
 namespace licht {
@@ -52,7 +53,7 @@ private:
 
 private:
     size_t next_id_ = 1;
-    HashMap<size_t, Function<void(ArgumentTypes...)>> handlers_;
+    HashMap<size_t, UniqueFunction<void(ArgumentTypes...)>> handlers_;
     Array<size_t> pending_removals_;
     bool emitting_ = false;
 };
@@ -61,9 +62,7 @@ template <typename... ArgumentTypes>
 template <typename Callable>
 auto Signal<ArgumentTypes...>::connect(Callable&& callable) -> connection_t {
     size_t id = next_id_++;
-    handlers_[id] = [callable = std::move(callable)](ArgumentTypes... args) mutable -> void {
-        callable(std::forward<ArgumentTypes>(args)...);
-    };
+    handlers_.put(size_t(id), UniqueFunction<void(ArgumentTypes...)>(std::forward<Callable>(callable)));
     return Connection<ArgumentTypes...>(id, this);
 }
 
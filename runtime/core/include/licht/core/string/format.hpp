@@ -17,7 +17,7 @@ inline String vformat(StringRef fmt, Args&&... args) {
     }
 
     String buffer;
-    buffer.resize(size + 1);
+    buffer.resize_uninitialized(size + 1);
     ::snprintf(buffer.data(), buffer.size(), fmt, std::forward<Args>(args)...);
 
     return buffer;
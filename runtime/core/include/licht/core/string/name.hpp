@@ -0,0 +1,87 @@
+#pragma once
+
+#include "licht/core/core_exports.hpp"
+#include "licht/core/defines.hpp"
+#include "licht/core/string/string_ref.hpp"
+
+#include <functional>
+#include <ostream>
+
+namespace licht {
+
+/**
+ * @brief Interned string identified by a 32-bit id.
+ *
+ * Every distinct string is stored once in a global append-only table, shared by all threads.
+ * Creating a `Name` from a string looks it up (and adds it the first time), after which
+ * copies, comparisons, hashing and `to_string` only touch the id.
+ *
+ * Meant for identifiers compared on hot paths: message addresses, module names, log channels, setting keys.
+ * The default `Name` is the none name, the one of the empty string.
+ */
+class LICHT_CORE_API Name {
+public:
+    /**
+     * @brief Name of an already interned string, the none name if it never was. Never adds to the table.
+     */
+    static Name find(StringRef str);
+
+    /**
+     * @brief Number of strings interned so far, the empty one included.
+     */
+    static uint32 get_interned_count();
+
+    /**
+     * @brief Interned characters, valid until the program ends.
+     */
+    StringRef to_string() const;
+
+    inline uint32 id() const {
+        return id_;
+    }
+
+    inline bool is_none() const {
+        return id_ == 0;
+    }
+
+    inline bool operator==(const Name& other) const {
+        return id_ == other.id_;
+    }
+
+    inline bool operator!=(const Name& other) const {
+        return id_ != other.id_;
+    }
+
+    /**
+     * @brief Orders by id, i.e. by first interning, not alphabetically.
+     */
+    inline bool operator<(const Name& other) const {
+        return id_ < other.id_;
+    }
+
+public:
+    constexpr Name() = default;
+
+    Name(StringRef str);
+
+    Name(const char* str);
+
+    Name(const String& str);
+
+private:
+    uint32 id_ = 0;
+};
+
+}  //namespace licht
+
+inline std::ostream& operator<<(std::ostream& os, const licht::Name& name) {
+    os << name.to_string().data();
+    return os;
+}
+
+template <>
+struct std::hash<::licht::Name> {
+    size_t operator()(const licht::Name& name) const noexcept {
+        return static_cast<size_t>(name.id());
+    }
+};
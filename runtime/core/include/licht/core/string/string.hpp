@@ -5,6 +5,10 @@
 #include "licht/core/containers/array.hpp"
 #include "licht/core/core_exports.hpp"
 #include "licht/core/defines.hpp"
+#include "licht/core/hash/hasher.hpp"
+#include "licht/core/memory/default_allocator.hpp"
+#include "licht/core/memory/memory.hpp"
+#include "licht/core/memory/trivially_relocatable.hpp"
 
 namespace licht {
 
@@ -32,102 +36,182 @@ LICHT_CORE_API int32 string_compare(const wchar_t* str1, const wchar_t* str2);
  */
 LICHT_CORE_API StringBase<wchar_t> unicode_of_str(const char* p_str);
 
+/**
+ * @brief Null-terminated string with small-string optimization.
+ *
+ * Strings of up to `inline_capacity` characters (23 for `String`) are stored inside the object,
+ * longer ones in a heap buffer that grows geometrically, so repeated appends are amortized O(1).
+ */
 template <typename CharType>
 class StringBase {
+public:
+    struct HeapBuffer {
+        CharType* data;
+        size_t capacity;
+    };
+
+    static constexpr size_t inline_capacity = 24 / sizeof(CharType) - 1;
+
 public:
     size_t size() const {
-        return buffer_.size() > 0 ? buffer_.size() - 1 : 0;
+        return size_ & ~heap_flag;
     }
 
+    /**
+     * @brief Number of characters the string can hold without allocating, the null terminator excluded.
+     */
     size_t capacity() const {
-        return buffer_.capacity();
+        return is_inline() ? inline_capacity : heap_.capacity;
     }
 
-    StringBase& append(const CharType* str) {
-        LCHECK_MSG(str, "Appempt to append a c-string null in a String.");
+    /**
+     * @brief Whether the characters are stored inside the string object.
+     */
+    bool is_inline() const {
+        return (size_ & heap_flag) == 0;
+    }
 
-        size_t len = string_length(str);
-        if (buffer_.size() > 0) {
-            buffer_.pop();  // Remove null terminator.
-        }
-        for (size_t i = 0; i < len; i++) {
-            buffer_.append(str[i]);
+    StringBase& append(const CharType* str, size_t length) {
+        const size_t old_size = size();
+        if (old_size + length > capacity()) {
+            // `str` may point into this string, keep its offset across the reallocation.
+            const CharType* old_data = data();
+            const bool is_self = str >= old_data && str <= old_data + old_size;
+            const size_t offset = is_self ? static_cast<size_t>(str - old_data) : 0;
+
+            ensure_capacity(old_size + length);
+            if (is_self) {
+                str = data() + offset;
+            }
         }
-        buffer_.append(CharType('\0'));
+
+        CharType* buffer = data();
+        Memory::move(buffer + old_size, str, length * sizeof(CharType));
+        set_size(old_size + length);
         return *this;
     }
 
+    StringBase& append(const CharType* str) {
+        LCHECK_MSG(str, "Appempt to append a c-string null in a String.");
+        return append(str, string_length(str));
+    }
+
     StringBase& append(CharType c) {
-        if (buffer_.size() > 0) {
-            buffer_.pop();  // Remove null terminator.
-        }
-        buffer_.append(c);
-        buffer_.append(CharType('\0'));
+        const size_t old_size = size();
+        ensure_capacity(old_size + 1);
+        data()[old_size] = c;
+        set_size(old_size + 1);
         return *this;
     }
 
     StringBase& append(const StringBase& string) {
-        append(string.data());
-        return *this;
+        return append(string.data(), string.size());
     }
 
     const CharType* data() const {
-        return buffer_.data();
+        return is_inline() ? inline_ : heap_.data;
     }
 
     CharType* data() {
-        return buffer_.data();
+        return is_inline() ? inline_ : heap_.data;
     }
 
     void clear() {
-        buffer_.clear();
-        buffer_.append(CharType('\0'));
+        set_size(0);
     }
 
+    /**
+     * @brief Changes the size of the string, new characters are set to zero.
+     */
     void resize(size_t size) {
-        buffer_.resize(size + 1);
-        buffer_[size] = CharType('\0');
+        const size_t old_size = this->size();
+        ensure_capacity(size);
+        if (size > old_size) {
+            CharType* characters = data();
+            for (size_t i = old_size; i < size; i++) {
+                characters[i] = CharType('\0');
+            }
+        }
+        set_size(size);
+    }
+
+    /**
+     * @brief Changes the size of the string, leaving new characters uninitialized except the terminator.
+     * For callers writing every new character right after.
+     */
+    void resize_uninitialized(size_t size) {
+        ensure_capacity(size);
+        set_size(size);
     }
 
     void reserve(size_t capacity) {
-        buffer_.reserve(capacity + 1);
+        if (capacity > this->capacity()) {
+            reallocate(capacity);
+        }
     }
 
-    bool empty() {
+    bool empty() const {
         return size() == 0;
     }
 
 public:
-    StringBase()
-        : buffer_() {
-        buffer_.append(CharType('\0'));
+    StringBase() {
+        inline_[0] = CharType('\0');
     }
 
     explicit StringBase(size_t capacity)
-        : buffer_() {
+        : StringBase() {
         reserve(capacity);
-        buffer_.append(CharType('\0'));
+    }
+
+    StringBase(const CharType* c_str, size_t length)
+        : StringBase() {
+        append(c_str, length);
     }
 
     StringBase(const CharType* c_str)
-        : buffer_() {
+        : StringBase() {
         LCHECK_MSG(c_str, "Appempt to append a c-string null in a String.");
         append(c_str);
     }
 
     StringBase(const StringBase& other)
-        : buffer_(other.buffer_) {}
+        : StringBase() {
+        append(other.data(), other.size());
+    }
+
+    StringBase(StringBase&& other) noexcept
+        : size_(other.size_) {
+        Memory::copy(inline_, other.inline_, sizeof(inline_));
+        other.size_ = 0;
+        other.inline_[0] = CharType('\0');
+    }
 
     StringBase& operator=(const StringBase& other) {
         if (this != std::addressof(other)) {
-            buffer_ = other.buffer_;
+            clear();
+            append(other.data(), other.size());
+        }
+        return *this;
+    }
+
+    StringBase& operator=(StringBase&& other) noexcept {
+        if (this != std::addressof(other)) {
+            release();
+            size_ = other.size_;
+            Memory::copy(inline_, other.inline_, sizeof(inline_));
+            other.size_ = 0;
+            other.inline_[0] = CharType('\0');
         }
         return *this;
     }
 
     StringBase& operator=(const CharType* c_str) {
         LCHECK_MSG(c_str, "Appempt to append a c-string null in a String.");
-        *this = StringBase<CharType>(c_str);
+        const size_t length = string_length(c_str);
+        ensure_capacity(length);
+        Memory::move(data(), c_str, length * sizeof(CharType));
+        set_size(length);
         return *this;
     }
 
@@ -141,34 +225,85 @@ public:
     }
 
     StringBase& operator+=(CharType c) {
-        if (buffer_.size() > 0) {
-            buffer_.pop();
-        }
-        buffer_.append(c);
-        buffer_.append(CharType('\0'));
-        return *this;
+        return append(c);
     }
 
     bool operator==(const StringBase& str) const {
-        return string_compare(buffer_.data(), str.data()) == 0;
+        return size() == str.size() && Memory::compare(data(), str.data(), size() * sizeof(CharType)) == 0;
     }
 
-    virtual ~StringBase() {}
+    bool operator==(const CharType* c_str) const {
+        LCHECK_MSG(c_str, "Appempt to compare a String with a null c-string.");
+        return string_compare(data(), c_str) == 0;
+    }
+
+    ~StringBase() {
+        release();
+    }
 
 protected:
+    /**
+     * @brief Makes room for `required_capacity` characters, at least doubling the heap buffer when it grows.
+     */
     void ensure_capacity(size_t required_capacity) {
-        if (required_capacity + 1 > buffer_.capacity()) {
-            reserve(required_capacity);
+        const size_t current_capacity = capacity();
+        if (required_capacity > current_capacity) {
+            reallocate(required_capacity > current_capacity * 2 ? required_capacity : current_capacity * 2);
         }
     }
 
-protected:
-    Array<CharType> buffer_;
+private:
+    static constexpr size_t heap_flag = size_t(1) << (sizeof(size_t) * 8 - 1);
+
+    void set_size(size_t size) {
+        size_ = size | (size_ & heap_flag);
+        data()[size] = CharType('\0');
+    }
+
+    void reallocate(size_t new_capacity) {
+        CharType* new_data = allocate(new_capacity);
+
+        const size_t current_size = size();
+        Memory::copy(new_data, data(), (current_size + 1) * sizeof(CharType));
+
+        release();
+        heap_.data = new_data;
+        heap_.capacity = new_capacity;
+        size_ = current_size | heap_flag;
+    }
+
+    void release() {
+        if (!is_inline()) {
+            DefaultAllocator::get_instance().deallocate(heap_.data, (heap_.capacity + 1) * sizeof(CharType), alignof(CharType));
+        }
+    }
+
+    static CharType* allocate(size_t capacity) {
+        void* memory = DefaultAllocator::get_instance().allocate((capacity + 1) * sizeof(CharType), alignof(CharType));
+        LCHECK(memory);
+        return static_cast<CharType*>(memory);
+    }
+
+private:
+    size_t size_ = 0;
+    union {
+        HeapBuffer heap_;
+        CharType inline_[inline_capacity + 1];
+    };
 };
 
+template <typename CharType>
+struct TriviallyRelocatable<StringBase<CharType>> : std::true_type {};
+
 using WString =  StringBase<wchar_t>;
 using String = StringBase<char>;
 
+template <>
+struct HashTransparentKey<String, const char*> : std::true_type {};
+
+template <size_t Size>
+struct HashTransparentKey<String, char[Size]> : std::true_type {};
+
 }  //namespace licht
 
 template <typename CharType>
@@ -180,18 +315,6 @@ std::ostream& operator<<(std::ostream& os, const licht::StringBase<CharType>& st
 template <>
 struct std::hash<licht::String> {
     size_t operator()(const licht::String& s) const noexcept {
-        const char* data = s.data();
-        size_t len = s.size();
-
-        // FNV-1a 64-bit
-        uint64 hash = 14695981039346656037ULL;
-        constexpr uint64_t prime = 1099511628211ULL;
-
-        for (size_t i = 0; i < len; ++i) {
-            hash ^= static_cast<uint8>(data[i]);
-            hash *= prime;
-        }
-
-        return static_cast<size_t>(hash);
+        return static_cast<size_t>(licht::Hasher::hash_bytes(s.data(), s.size()));
     }
 };
\ No newline at end of file
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "licht/core/defines.hpp"
+#include "licht/core/string/string.hpp"
+#include "licht/core/string/string_ref.hpp"
+
+#include <utility>
+
+namespace licht {
+
+/**
+ * @brief Accumulates the parts of a string before building it with a single final buffer.
+ *
+ * ```
+ * String path = StringBuilder::concat(projectdir, "/assets/shaders/", name, ".vert");
+ * ```
+ */
+template <typename CharType>
+class StringBuilderBase {
+public:
+    /**
+     * @brief Concatenates all the parts with one allocation at most.
+     */
+    template <typename... Parts>
+    static StringBase<CharType> concat(const Parts&... parts) {
+        StringBuilderBase builder((part_length(parts) + ... + 0));
+        (builder.append(parts), ...);
+        return builder.build();
+    }
+
+    StringBuilderBase& append(const CharType* str, size_t length) {
+        buffer_.append(str, length);
+        return *this;
+    }
+
+    StringBuilderBase& append(const CharType* str) {
+        buffer_.append(str);
+        return *this;
+    }
+
+    StringBuilderBase& append(StringRefBase<CharType> str) {
+        buffer_.append(str.data(), str.size());
+        return *this;
+    }
+
+    StringBuilderBase& append(const StringBase<CharType>& str) {
+        buffer_.append(str.data(), str.size());
+        return *this;
+    }
+
+    StringBuilderBase& append(CharType c) {
+        buffer_.append(c);
+        return *this;
+    }
+
+    /**
+     * @brief Appends `count` copies of the character.
+     */
+    StringBuilderBase& append(CharType c, size_t count) {
+        const size_t old_size = buffer_.size();
+        buffer_.resize_uninitialized(old_size + count);
+
+        CharType* data = buffer_.data();
+        for (size_t i = 0; i < count; i++) {
+            data[old_size + i] = c;
+        }
+        return *this;
+    }
+
+    size_t size() const {
+        return buffer_.size();
+    }
+
+    bool empty() const {
+        return buffer_.empty();
+    }
+
+    void reserve(size_t capacity) {
+        buffer_.reserve(capacity);
+    }
+
+    void clear() {
+        buffer_.clear();
+    }
+
+    /**
+     * @brief View of the characters appended so far, invalidated by the next append.
+     */
+    StringRefBase<CharType> view() const {
+        return StringRefBase<CharType>(buffer_.data());
+    }
+
+    /**
+     * @brief Hands the built string over, leaving the builder empty.
+     */
+    StringBase<CharType> build() {
+        return std::move(buffer_);
+    }
+
+public:
+    StringBuilderBase() = default;
+
+    explicit StringBuilderBase(size_t capacity)
+        : buffer_(capacity) {}
+
+private:
+    static size_t part_length(const CharType* str) {
+        return string_length(str);
+    }
+
+    static size_t part_length(StringRefBase<CharType> str) {
+        return str.size();
+    }
+
+    static size_t part_length(const StringBase<CharType>& str) {
+        return str.size();
+    }
+
+    static size_t part_length(CharType) {
+        return 1;
+    }
+
+private:
+    StringBase<CharType> buffer_;
+};
+
+using StringBuilder = StringBuilderBase<char>;
+using WStringBuilder = StringBuilderBase<wchar_t>;
+
+}  //namespace licht
@@ -61,27 +61,35 @@ private:
 using StringRef = StringRefBase<char>;
 using WStringRef = StringRefBase<wchar_t>;
 
+template <typename CharType>
+constexpr bool operator==(const StringBase<CharType>& lhs, StringRefBase<CharType> rhs) {
+    return string_compare(lhs.data(), rhs.data()) == 0;
+}
+
+template <>
+struct HashTransparentKey<String, StringRef> : std::true_type {};
+
 }  // namespace licht
 
 template<typename CharType>
-constexpr licht::StringBase<CharType> operator+(licht::StringRefBase<CharType> lhs, licht::StringRefBase<CharType> rhs) {
-    licht::StringBase<CharType> base(lhs);
-    base.append(rhs);
-    return std::move(base);
+licht::StringBase<CharType> operator+(licht::StringRefBase<CharType> lhs, licht::StringRefBase<CharType> rhs) {
+    const size_t lhs_size = lhs.size();
+    const size_t rhs_size = rhs.size();
+
+    licht::StringBase<CharType> base(lhs_size + rhs_size);
+    base.append(lhs.data(), lhs_size);
+    base.append(rhs.data(), rhs_size);
+    return base;
 }
 
 template<typename CharType>
-constexpr licht::StringBase<CharType> operator+(licht::StringRefBase<CharType> lhs, const CharType* rhs) {
-    licht::StringBase<CharType> base(lhs);
-    base.append(rhs);
-    return std::move(base);
+licht::StringBase<CharType> operator+(licht::StringRefBase<CharType> lhs, const CharType* rhs) {
+    return lhs + licht::StringRefBase<CharType>(rhs);
 }
 
 template<typename CharType>
-constexpr licht::StringBase<CharType> operator+(const CharType* lhs, licht::StringRefBase<CharType> rhs) {
-    licht::StringBase<CharType> base(lhs);
-    base.append(rhs);
-    return std::move(base);
+licht::StringBase<CharType> operator+(const CharType* lhs, licht::StringRefBase<CharType> rhs) {
+    return licht::StringRefBase<CharType>(lhs) + rhs;
 }
 
 template <typename CharType>
@@ -93,18 +101,6 @@ std::ostream& operator<<(std::ostream& os, const licht::StringRefBase<CharType>&
 template <>
 struct LICHT_CORE_API std::hash<::licht::StringRef> {
     size_t operator()(const licht::StringRef& s) const noexcept {
-        const char* data = s.data();
-        size_t len = s.size();
-
-        // FNV-1a 64-bit
-        uint64 hash = 14695981039346656037ULL;
-        constexpr uint64_t prime = 1099511628211ULL;
-
-        for (size_t i = 0; i < len; ++i) {
-            hash ^= static_cast<uint8>(data[i]);
-            hash *= prime;
-        }
-
-        return static_cast<size_t>(hash);
+        return static_cast<size_t>(licht::Hasher::hash_bytes(s.data(), s.size()));
     }
 };
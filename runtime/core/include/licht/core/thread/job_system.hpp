@@ -0,0 +1,169 @@
+#pragma once
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/containers/mpmc_queue.hpp"
+#include "licht/core/containers/work_stealing_deque.hpp"
+#include "licht/core/core_exports.hpp"
+#include "licht/core/defines.hpp"
+#include "licht/core/function/function.hpp"
+#include "licht/core/memory/allocator.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace licht {
+
+class JobSystem;
+
+namespace internal {
+
+struct Job;
+
+}  //namespace internal
+
+using JobFunction = Function<void()>;
+
+/**
+ * @brief Counts the jobs left in a group. Each job run with the counter increments it,
+ * and decrements it once done. Jobs can be started once a counter reaches zero with `JobSystem::run_after`.
+ *
+ * A counter must outlive its jobs, which is the case when it is waited on before going out of scope.
+ */
+class LICHT_CORE_API JobCounter {
+public:
+    /**
+     * @brief Whether every job of the group is done and no worker touches the counter anymore.
+     */
+    inline bool is_done() const {
+        return value_.load(std::memory_order_acquire) == 0 && finishing_count_.load(std::memory_order_acquire) == 0;
+    }
+
+    inline uint32 get_value() const {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+public:
+    JobCounter() = default;
+    ~JobCounter() = default;
+
+    JobCounter(const JobCounter&) = delete;
+    JobCounter(JobCounter&&) = delete;
+
+    JobCounter& operator=(const JobCounter&) = delete;
+    JobCounter& operator=(JobCounter&&) = delete;
+
+private:
+    friend class JobSystem;
+
+    std::atomic<uint32> value_ = 0;
+    std::atomic<uint32> finishing_count_ = 0;
+
+    std::mutex continuation_mutex_;
+    Array<internal::Job*> continuations_ = Array<internal::Job*>(NoAllocationOnConstructionPolicy());
+};
+
+/**
+ * @brief Runs small jobs on worker threads that each own a Chase-Lev deque.
+ *
+ * A worker pushes the jobs it spawns on its own deque and pops them back in LIFO order,
+ * which keeps their data warm in its cache. An idle worker steals the oldest job of another worker.
+ * Jobs run from a thread outside the system go through a shared queue.
+ *
+ * When every worker gets a physical core of its own, worker `i` is pinned to core `i + 1`,
+ * leaving the first core to the calling thread, so that a worker keeps its deque and its jobs' data in one cache.
+ *
+ * Without workers, jobs run immediately on the calling thread.
+ * The engine starts the global system (`get_instance`) at startup and stops it at shutdown.
+ */
+class LICHT_CORE_API JobSystem {
+public:
+    static JobSystem& get_instance();
+
+    /**
+     * @brief One worker per physical core, minus the calling thread, see `ThreadPool::get_default_worker_count`.
+     */
+    static size_t get_default_worker_count();
+
+    /**
+     * @brief Index of the worker running the calling thread in the system it belongs to, -1 outside any worker.
+     */
+    static int32 get_current_worker_index();
+
+    void start(size_t worker_count);
+
+    /**
+     * @brief Joins the workers once they have run every job left.
+     */
+    void stop();
+
+    inline bool is_running() const {
+        return !workers_.empty();
+    }
+
+    inline size_t get_worker_count() const {
+        return workers_.size();
+    }
+
+    /**
+     * @brief Schedules `function`. If `counter` is given, it is incremented now and decremented once the job is done.
+     */
+    void run(JobFunction function, JobCounter* counter = nullptr);
+
+    /**
+     * @brief Schedules `function` once `dependency` reaches zero, immediately if it already has.
+     */
+    void run_after(JobCounter& dependency, JobFunction function, JobCounter* counter = nullptr);
+
+    /**
+     * @brief Returns once every job of `counter` is done, running other jobs in the meantime.
+     */
+    void wait(JobCounter& counter);
+
+    /**
+     * @brief Runs one scheduled job on the calling thread.
+     * @return false if no job was found.
+     */
+    bool try_run_one_job();
+
+public:
+    explicit JobSystem(size_t worker_count = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem(JobSystem&&) = delete;
+
+    JobSystem& operator=(const JobSystem&) = delete;
+    JobSystem& operator=(JobSystem&&) = delete;
+
+private:
+    struct Worker {
+        WorkStealingDeque<internal::Job*> deque;
+        std::thread thread;
+    };
+
+    void schedule(internal::Job* job);
+    void execute(internal::Job* job);
+    void finish(JobCounter& counter);
+
+    bool find_job(Worker* worker, internal::Job*& out_job);
+
+    void worker_main(size_t index);
+
+private:
+    static constexpr size_t injection_capacity = 4096;
+    static constexpr uint32 spin_count_before_sleep = 64;
+
+    Array<Worker*> workers_;
+    MpmcQueue<internal::Job*> injected_jobs_;
+
+    std::atomic<int64> pending_job_count_;
+    std::atomic<uint32> sleeping_worker_count_;
+    std::atomic<bool> stopping_;
+
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_condition_;
+};
+
+}  //namespace licht
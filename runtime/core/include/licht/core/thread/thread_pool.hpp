@@ -0,0 +1,166 @@
+#pragma once
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/containers/mpmc_queue.hpp"
+#include "licht/core/core_exports.hpp"
+#include "licht/core/defines.hpp"
+#include "licht/core/function/function.hpp"
+#include "licht/core/platform/cpu.hpp"
+#include "licht/core/thread/job_system.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace licht {
+
+/**
+ * @brief Fixed set of worker threads running the tasks submitted to a shared queue.
+ *
+ * The thread calling `run_parallel` takes part in the work, so a pool without workers
+ * still runs everything, serially, on the caller.
+ * A pool can also run its tasks as jobs of a `JobSystem`, on its workers, instead of threads of its own.
+ * The engine starts the global pool (`get_instance`) that way at startup, so that the pool and the job system
+ * share one worker per core, and stops it at shutdown.
+ *
+ * As in the job system, when every worker gets a physical core of its own, worker `i` is pinned to core `i + 1`.
+ */
+class LICHT_CORE_API ThreadPool {
+public:
+    using Task = Function<void()>;
+
+    /**
+     * @brief Pool shared by the engine, the asset and the scene code.
+     * It has no worker until `start` is called.
+     */
+    static ThreadPool& get_instance();
+
+    /**
+     * @brief One worker per physical core, minus the calling thread. SMT siblings share the execution
+     * units of their core, a second worker on them mostly competes with the first.
+     */
+    static size_t get_default_worker_count();
+
+    void start(size_t worker_count);
+
+    /**
+     * @brief Runs the tasks as jobs of `job_system`, on its workers, without starting any thread.
+     */
+    void start(JobSystem& job_system);
+
+    /**
+     * @brief Runs the tasks left in the queue, then joins the workers, or detaches from the job system.
+     */
+    void stop();
+
+    inline bool is_running() const {
+        return !workers_.empty() || job_system_ != nullptr;
+    }
+
+    /**
+     * @brief Threads of the pool, or workers of the job system it runs on.
+     */
+    inline size_t get_worker_count() const {
+        return job_system_ ? job_system_->get_worker_count() : workers_.size();
+    }
+
+    /**
+     * @brief Number of threads working on a `run_parallel` call: the workers and the caller.
+     */
+    inline size_t get_concurrency() const {
+        return get_worker_count() + 1;
+    }
+
+    /**
+     * @brief Queues a task for a worker. Without workers, or with a full queue, the task runs on the caller.
+     */
+    void submit(Task task);
+
+    /**
+     * @brief Pops a queued task, or a job of the job system the pool runs on, and runs it on the calling thread.
+     * @return false if the queue was empty.
+     */
+    bool try_run_pending_task();
+
+    /**
+     * @brief Calls `func(index)` for every index in [0, count) across the workers and the calling thread,
+     * and returns once every call has returned.
+     *
+     * While it waits for the other threads, the caller runs queued tasks, so this can be nested in a task.
+     */
+    template <typename Func>
+    void run_parallel(size_t count, Func&& func);
+
+public:
+    explicit ThreadPool(size_t worker_count = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+private:
+    void worker_main();
+
+private:
+    static constexpr size_t task_capacity = 4096;
+    static constexpr uint32 spin_count_before_sleep = 64;
+
+    MpmcQueue<Task> tasks_;
+    Array<std::thread> workers_;
+    JobSystem* job_system_;
+
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_condition_;
+    std::atomic<bool> stopping_;
+};
+
+template <typename Func>
+void ThreadPool::run_parallel(size_t count, Func&& func) {
+    if (count == 0) {
+        return;
+    }
+
+    const size_t helper_count = std::min(count - 1, get_worker_count());
+    if (helper_count == 0) {
+        for (size_t i = 0; i < count; i++) {
+            func(i);
+        }
+        return;
+    }
+
+    std::atomic<size_t> next_index = 0;
+    std::atomic<size_t> active_helper_count = helper_count;
+
+    auto drain = [&]() {
+        for (size_t i = next_index.fetch_add(1, std::memory_order_relaxed); i < count;
+             i = next_index.fetch_add(1, std::memory_order_relaxed)) {
+            func(i);
+        }
+    };
+
+    for (size_t i = 0; i < helper_count; i++) {
+        submit([&]() {
+            drain();
+            active_helper_count.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    drain();
+
+    // The helpers reference this stack frame, wait for all of them, even those that found nothing left to do.
+    SpinWait spin;
+    while (active_helper_count.load(std::memory_order_acquire) != 0) {
+        if (try_run_pending_task()) {
+            spin.reset();
+        } else {
+            spin.wait();
+        }
+    }
+}
+
+}  //namespace licht
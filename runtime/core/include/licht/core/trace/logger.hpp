@@ -5,6 +5,8 @@
 #include "licht/core/containers/array.hpp"
 #include "licht/core/string/string_ref.hpp"
 #include "licht/core/containers/hash_map.hpp"
+#include "licht/core/containers/hash_set.hpp"
+#include "licht/core/string/name.hpp"
 #include "licht/core/function/function.hpp"
 
 namespace licht {
@@ -104,6 +106,20 @@ public:
      */
     void set_delegate(LogFn func);
 
+    /**
+     * @brief Mutes or unmutes the messages of a channel.
+     * @param channel The channel, e.g. "[ModuleRegistry]".
+     * @param enabled Whether its messages reach the delegate.
+     */
+    void set_channel_enabled(Name channel, bool enabled);
+
+    /**
+     * @brief Checks whether the messages of a channel reach the delegate.
+     * @param channel The channel to check.
+     * @return False if the channel has been muted.
+     */
+    bool is_channel_enabled(Name channel) const;
+
     /**
      * @brief Constructs a Logger with a specified logging function.
      * @param fn The logging function to use as the delegate.
@@ -118,6 +134,9 @@ public:
 private:
     /** The logging delegate function. */
     LogFn log_fn_;
+
+    /** Channels whose messages are dropped. */
+    HashSet<Name> muted_channels_;
 };
 
 /**
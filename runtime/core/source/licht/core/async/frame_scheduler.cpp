@@ -0,0 +1,60 @@
+#include "licht/core/async/frame_scheduler.hpp"
+
+#include <utility>
+
+namespace licht {
+
+FrameScheduler& FrameScheduler::get_instance() {
+    static FrameScheduler s_frame_scheduler;
+    return s_frame_scheduler;
+}
+
+FrameScheduler::~FrameScheduler() {
+    // Each waiting chain of tasks is suspended in one place only, so every owner is destroyed once.
+    for (const Waiting& waiting : next_tick_) {
+        if (waiting.owner) {
+            waiting.owner.destroy();
+        }
+    }
+    for (const Timer& timer : timers_) {
+        if (timer.waiting.owner) {
+            timer.waiting.owner.destroy();
+        }
+    }
+}
+
+void FrameScheduler::tick() {
+    frame_index_++;
+
+    {
+        std::lock_guard lock(mutex_);
+        std::swap(resuming_, next_tick_);
+
+        const Clock::time_point now = Clock::now();
+        timers_.remove_if([this, now](const Timer& timer) -> bool {
+            if (timer.deadline > now) {
+                return false;
+            }
+            resuming_.append(timer.waiting);
+            return true;
+        });
+    }
+
+    // Resumed outside the lock, a coroutine may queue itself again.
+    for (const Waiting& waiting : resuming_) {
+        waiting.handle.resume();
+    }
+    resuming_.clear();
+}
+
+void FrameScheduler::resume_next_tick(std::coroutine_handle<> handle, std::coroutine_handle<> owner) {
+    std::lock_guard lock(mutex_);
+    next_tick_.append(Waiting{handle, owner});
+}
+
+void FrameScheduler::resume_after(Clock::time_point deadline, std::coroutine_handle<> handle, std::coroutine_handle<> owner) {
+    std::lock_guard lock(mutex_);
+    timers_.append(Timer{deadline, Waiting{handle, owner}});
+}
+
+}  //namespace licht
@@ -0,0 +1,203 @@
+#include "licht/core/memory/frame_allocator.hpp"
+#include "licht/core/memory/default_allocator.hpp"
+#include "licht/core/platform/cpu.hpp"
+
+namespace licht {
+
+namespace {
+
+struct ThreadArena {
+    const FrameAllocator* allocator = nullptr;
+    uint64 generation = 0;
+    uintptr_t cursor = 0;
+    uintptr_t end = 0;
+};
+
+// A thread keeps one sub-arena per allocator it uses, up to a few allocators at once,
+// so that going back and forth between them does not carve a new sub-arena each time.
+constexpr size_t thread_arena_count = 4;
+
+struct ThreadArenaCache {
+    ThreadArena arenas[thread_arena_count];
+    uint32 next_evicted = 0;
+};
+
+thread_local ThreadArenaCache t_thread_arenas;
+
+inline uintptr_t align_up(uintptr_t address, size_t alignment) {
+    return (address + (alignment - 1)) & ~(alignment - 1);
+}
+
+// Zero is never handed out, it marks a thread without sub-arena.
+std::atomic<uint64> s_next_generation = 1;
+
+uint64 next_generation() {
+    return s_next_generation.fetch_add(1, std::memory_order_relaxed);
+}
+
+}  // namespace
+
+FrameAllocator::FrameAllocator()
+    : frames_(nullptr)
+    , frame_count_(0)
+    , current_frame_(0)
+    , thread_arena_size_(default_thread_arena_size)
+    , generation_(0)
+#ifdef LDEBUG
+    , poison_on_reset_(true) {
+#else
+    , poison_on_reset_(false) {
+#endif
+}
+
+FrameAllocator::FrameAllocator(uint32 frame_count, size_t frame_size, size_t thread_arena_size)
+    : FrameAllocator() {
+    initialize(frame_count, frame_size, thread_arena_size);
+}
+
+FrameAllocator::~FrameAllocator() {
+    destroy();
+}
+
+void FrameAllocator::initialize(uint32 frame_count, size_t frame_size, size_t thread_arena_size) {
+    LCHECK_MSG(frame_count > 0, "A frame allocator needs at least one frame.");
+
+    destroy();
+
+    frames_ = TypedDefaultAllocator<Frame>().allocate(frame_count);
+    for (uint32 i = 0; i < frame_count; i++) {
+        lplacement_new(frames_ + i) Frame();
+        frames_[i].arena.initialize(frame_size);
+    }
+
+    frame_count_ = frame_count;
+    current_frame_ = 0;
+    thread_arena_size_ = align_up(thread_arena_size, cache_line_size);
+    generation_.store(next_generation(), std::memory_order_relaxed);
+}
+
+void FrameAllocator::destroy() {
+    if (!frames_) {
+        return;
+    }
+
+    for (uint32 i = 0; i < frame_count_; i++) {
+        for (const OverflowBlock& overflow_block : frames_[i].overflow_blocks) {
+            Memory::free(overflow_block.block, overflow_block.size, overflow_block.alignment);
+        }
+        frames_[i].arena.destroy();
+        frames_[i].~Frame();
+    }
+    TypedDefaultAllocator<Frame>().deallocate(frames_, frame_count_);
+
+    frames_ = nullptr;
+    frame_count_ = 0;
+    current_frame_ = 0;
+    generation_.store(0, std::memory_order_relaxed);
+}
+
+void FrameAllocator::begin_frame(uint32 frame) {
+    LCHECK_MSG(frame < frame_count_, "Frame out of range.");
+
+    Frame& reset_frame = frames_[frame];
+
+    if (poison_on_reset_) {
+        Memory::write(reset_frame.arena.get_buffer(), poison_byte, reset_frame.arena.get_offset());
+    }
+
+    for (const OverflowBlock& overflow_block : reset_frame.overflow_blocks) {
+        if (poison_on_reset_) {
+            Memory::write(overflow_block.block, poison_byte, overflow_block.size);
+        }
+        Memory::free(overflow_block.block, overflow_block.size, overflow_block.alignment);
+    }
+    reset_frame.overflow_blocks.clear();
+    reset_frame.overflow_size = 0;
+    reset_frame.arena.reset();
+
+    current_frame_ = frame;
+
+    // Every thread drops its sub-arena of the previous frame.
+    generation_.store(next_generation(), std::memory_order_relaxed);
+}
+
+void* FrameAllocator::allocate(size_t size, size_t alignment) {
+    const uint64 generation = generation_.load(std::memory_order_relaxed);
+    for (ThreadArena& thread_arena : t_thread_arenas.arenas) {
+        if (thread_arena.allocator != this || thread_arena.generation != generation) {
+            continue;
+        }
+
+        const uintptr_t address = align_up(thread_arena.cursor, alignment);
+        if (address + size <= thread_arena.end) {
+            thread_arena.cursor = address + size;
+            return reinterpret_cast<void*>(address);
+        }
+        break;
+    }
+
+    return allocate_slow(size, alignment);
+}
+
+void FrameAllocator::deallocate(void* /* block */, size_t /* size */, size_t /* alignment */) {
+}
+
+size_t FrameAllocator::get_used_size(uint32 frame) const {
+    LCHECK_MSG(frame < frame_count_, "Frame out of range.");
+    return frames_[frame].arena.get_offset();
+}
+
+size_t FrameAllocator::get_overflow_size(uint32 frame) const {
+    LCHECK_MSG(frame < frame_count_, "Frame out of range.");
+    return frames_[frame].overflow_size;
+}
+
+void* FrameAllocator::allocate_slow(size_t size, size_t alignment) {
+    LCHECK_MSG(is_valid(), "The frame allocator is not initialized.");
+
+    std::lock_guard lock(mutex_);
+
+    // Large blocks would waste most of a sub-arena, they are taken from the frame directly.
+    if (size + alignment > thread_arena_size_ / 4) {
+        return allocate_from_frame(size, alignment);
+    }
+
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(allocate_from_frame(thread_arena_size_, cache_line_size));
+
+    // Replaces the sub-arena this thread had in this allocator, or else the oldest of another allocator.
+    ThreadArenaCache& cache = t_thread_arenas;
+    ThreadArena* thread_arena = nullptr;
+    for (ThreadArena& arena : cache.arenas) {
+        if (arena.allocator == this) {
+            thread_arena = &arena;
+            break;
+        }
+    }
+    if (!thread_arena) {
+        thread_arena = &cache.arenas[cache.next_evicted];
+        cache.next_evicted = (cache.next_evicted + 1) % thread_arena_count;
+    }
+
+    thread_arena->allocator = this;
+    thread_arena->generation = generation_.load(std::memory_order_relaxed);
+    thread_arena->end = begin + thread_arena_size_;
+
+    const uintptr_t address = align_up(begin, alignment);
+    thread_arena->cursor = address + size;
+    return reinterpret_cast<void*>(address);
+}
+
+void* FrameAllocator::allocate_from_frame(size_t size, size_t alignment) {
+    Frame& frame = frames_[current_frame_];
+
+    if (void* block = frame.arena.allocate(size, alignment)) {
+        return block;
+    }
+
+    void* block = Memory::allocate(size, alignment);
+    frame.overflow_blocks.append(OverflowBlock{block, size, alignment});
+    frame.overflow_size += size;
+    return block;
+}
+
+}  //namespace licht
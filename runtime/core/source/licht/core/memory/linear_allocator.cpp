@@ -25,10 +25,10 @@ void LinearAllocator::deallocate(void* /* block */, size_t /* size */, size_t /*
 }
 
 void LinearAllocator::initialize(size_t size) {
-    size_ = size;
     if (buffer_) {
         destroy();
     }
+    size_ = size;
     buffer_ = Memory::allocate(size_);
     if (buffer_) {
         Memory::write(buffer_, 0, size_);
@@ -36,7 +36,7 @@ void LinearAllocator::initialize(size_t size) {
 }
 
 void LinearAllocator::destroy() {
-    if (buffer_) {
+    if (!buffer_) {
         return;
     }
 
@@ -61,6 +61,47 @@ LinearAllocator::LinearAllocator()
     , buffer_(nullptr) {
 }
 
+LinearAllocator::LinearAllocator(const LinearAllocator& other)
+    : LinearAllocator() {
+    size_ = other.size_;
+    if (other.buffer_) {
+        initialize(other.size_);
+    }
+}
+
+LinearAllocator::LinearAllocator(LinearAllocator&& other) noexcept
+    : size_(other.size_)
+    , offset_(other.offset_)
+    , buffer_(other.buffer_) {
+    other.buffer_ = nullptr;
+    other.size_ = 0;
+    other.offset_ = 0;
+}
+
+LinearAllocator& LinearAllocator::operator=(const LinearAllocator& other) {
+    if (this != &other) {
+        destroy();
+        size_ = other.size_;
+        if (other.buffer_) {
+            initialize(other.size_);
+        }
+    }
+    return *this;
+}
+
+LinearAllocator& LinearAllocator::operator=(LinearAllocator&& other) noexcept {
+    if (this != &other) {
+        destroy();
+        size_ = other.size_;
+        offset_ = other.offset_;
+        buffer_ = other.buffer_;
+        other.buffer_ = nullptr;
+        other.size_ = 0;
+        other.offset_ = 0;
+    }
+    return *this;
+}
+
 LinearAllocator::~LinearAllocator() {
     if (buffer_) {
         destroy();
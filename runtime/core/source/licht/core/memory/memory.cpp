@@ -1,8 +1,8 @@
 #include "licht/core/memory/memory.hpp"
 #include "licht/core/defines.hpp"
 #include "licht/core/memory/memory_trace.hpp"
+#include "licht/core/memory/size_class_allocator.hpp"
 
-#include <cstdlib>
 #include <cstring>
 
 namespace licht {
@@ -35,47 +35,32 @@ bool Memory::is_aligned(const uintptr_t address, size_t alignment) {
 }
 
 uint8* Memory::allocate(size_t size) noexcept {
-    licht::MemoryTrace::global_add_allocate_bytes(size);
-    return static_cast<uint8*>(::malloc(size));
+    const MemoryTag tag = MemoryTrace::get_current_tag();
+    MemoryTrace::global_add_allocate_bytes(size, tag);
+    return static_cast<uint8*>(SizeClassAllocator::allocate(size, SizeClassAllocator::default_alignment, static_cast<uint8>(tag)));
 }
 
 uint8* Memory::allocate(size_t size, size_t alignment) noexcept {
     LCHECK_MSG(alignment > 0, "Alignment must be greater than zero.");
     LCHECK_MSG((alignment & (alignment - 1)) == 0, "Alignment must be a power of two.");
 
-    // To ensure we can align the memory, we allocate extra bytes.
-    size_t total_size = size + alignment;
-    uint8* raw_memory = Memory::allocate(total_size);
-    uint8* aligned_memory = align(raw_memory, alignment);
-
-    if (aligned_memory == raw_memory) {
-        // If the memory is already aligned, we need to move the pointer forward
-        // to ensure we have enough space for alignment.
-        aligned_memory += alignment;
-    }
-
-    // Calculate the shift for debugging purposes.
-    ptrdiff_t shift = aligned_memory - raw_memory;
-    LCHECK_MSG(shift >= 0 && shift <= alignment, "Alignment adjustment is out of bounds.");
-
-    // Store the shift value just before the aligned memory for later use in deallocation.
-    aligned_memory[-1] = static_cast<uint8>(shift & 0xFF);
-
-    return aligned_memory;
+    const MemoryTag tag = MemoryTrace::get_current_tag();
+    MemoryTrace::global_add_allocate_bytes(size, tag);
+    return static_cast<uint8*>(SizeClassAllocator::allocate(size, alignment, static_cast<uint8>(tag)));
 }
 
 void Memory::free(void* block, size_t size) noexcept {
-    MemoryTrace::global_add_freed_bytes(size);
-    ::free(block);
+    free(block, size, SizeClassAllocator::default_alignment);
 }
 
 void Memory::free(void* block, size_t size, size_t alignment) noexcept {
-    size_t total_size = size + alignment;
-    uint8* aligned_memory = static_cast<uint8*>(block);
-    // Retrieve the shift value stored just before the aligned memory.
-    ptrdiff_t shift = static_cast<ptrdiff_t>(aligned_memory[-1]);
-    uint8* raw_memory = aligned_memory - shift;
-    free(raw_memory, total_size);
+    if (!block) {
+        return;
+    }
+
+    // Accounted to the tag the block was allocated under, whichever tag the freeing thread is in.
+    MemoryTrace::global_add_freed_bytes(size, static_cast<MemoryTag>(SizeClassAllocator::get_tag(block, size, alignment)));
+    SizeClassAllocator::free(block, size, alignment);
 }
 
 void* Memory::copy(void* destination,
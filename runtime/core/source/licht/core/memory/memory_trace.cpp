@@ -1,34 +1,384 @@
 #include "licht/core/memory/memory_trace.hpp"
+#include "licht/core/memory/size_class_allocator.hpp"
+#include "licht/core/string/format.hpp"
+#include "licht/core/trace/trace.hpp"
+
+#include <atomic>
+#include <bit>
+#include <mutex>
+#include <new>
 
 namespace licht {
 
-void MemoryTrace::global_add_freed_bytes(uint64 size) {
-    get_default().add_freed_bytes(size);
+namespace {
+
+struct TagCounters {
+    std::atomic<uint64> allocated_bytes;
+    std::atomic<uint64> freed_bytes;
+    std::atomic<uint64> allocation_count;
+    std::atomic<uint64> free_count;
+    std::atomic<uint64> size_histogram[memory_trace_histogram_size];
+};
+
+/**
+ * @brief Counters of one thread at a time, never freed: once its thread exits, the next new thread reuses it.
+ */
+struct ThreadCounters {
+    TagCounters tags[memory_tag_count] = {};
+    ThreadCounters* next = nullptr;
+    std::atomic<bool> is_owned = false;
+};
+
+struct TagTotals {
+    uint64 allocated_bytes = 0;
+    uint64 freed_bytes = 0;
+    uint64 allocation_count = 0;
+    uint64 free_count = 0;
+    uint64 size_histogram[memory_trace_histogram_size] = {};
+};
+
+/**
+ * @brief Live bytes of a tag across every thread, on a cache line of its own, so that the peak follows every change.
+ */
+struct alignas(64) TagLiveBytes {
+    std::atomic<int64> current_bytes;
+    std::atomic<int64> peak_bytes;
+};
+
+struct TraceRegistry {
+    std::atomic<ThreadCounters*> head = nullptr;
+    TagLiveBytes live_bytes[memory_tag_count] = {};
+
+    /**
+     * @brief Counters of the threads past their exit, when their own block went back to the registry.
+     * Shared, so updated with atomic read-modify-writes.
+     */
+    ThreadCounters exited_counters;
+
+    std::mutex frame_mutex;
+    uint64 frame_index = 0;
+    uint64 frame_baseline[memory_tag_count] = {};
+    uint64 frame_allocation_count[memory_tag_count] = {};
+};
+
+/**
+ * @brief Never destroyed: allocations keep being traced while static destructors run.
+ */
+TraceRegistry& get_registry() {
+    alignas(TraceRegistry) static uint8 s_storage[sizeof(TraceRegistry)];
+    static TraceRegistry* s_registry = ::new (s_storage) TraceRegistry();
+    return *s_registry;
+}
+
+enum class ThreadTraceState : uint8 {
+    Unregistered,
+    Registered,
+    Exited,
+};
+
+thread_local ThreadCounters* t_counters = nullptr;
+thread_local ThreadTraceState t_state = ThreadTraceState::Unregistered;
+thread_local MemoryTag t_tag = MemoryTag::General;
+
+struct ThreadCountersGuard {
+    ~ThreadCountersGuard() {
+        if (t_counters) {
+            t_counters->is_owned.store(false, std::memory_order_release);
+            t_counters = nullptr;
+        }
+        t_state = ThreadTraceState::Exited;
+    }
+};
+
+thread_local ThreadCountersGuard t_counters_guard;
+
+ThreadCounters* acquire_counters() {
+    TraceRegistry& registry = get_registry();
+
+    for (ThreadCounters* counters = registry.head.load(std::memory_order_acquire); counters; counters = counters->next) {
+        bool is_owned = false;
+        if (!counters->is_owned.load(std::memory_order_relaxed) &&
+            counters->is_owned.compare_exchange_strong(is_owned, true, std::memory_order_acquire)) {
+            return counters;
+        }
+    }
+
+    // Straight from the size classes: going through `Memory` would trace this allocation, recursively.
+    void* storage = SizeClassAllocator::allocate(sizeof(ThreadCounters), alignof(ThreadCounters));
+    ThreadCounters* counters = ::new (storage) ThreadCounters();
+    counters->is_owned.store(true, std::memory_order_relaxed);
+
+    ThreadCounters* head = registry.head.load(std::memory_order_relaxed);
+    do {
+        counters->next = head;
+    } while (!registry.head.compare_exchange_weak(head, counters, std::memory_order_release, std::memory_order_relaxed));
+
+    return counters;
+}
+
+/**
+ * @return nullptr once the thread is exiting, when it counts into the shared block.
+ */
+inline ThreadCounters* get_thread_counters() {
+    if (t_counters) {
+        return t_counters;
+    }
+
+    if (t_state == ThreadTraceState::Exited) {
+        return nullptr;
+    }
+
+    // Constructs the guard, which registers its destructor for the thread exit.
+    static_cast<void>(&t_counters_guard);
+    t_counters = acquire_counters();
+    t_state = ThreadTraceState::Registered;
+    return t_counters;
+}
+
+/**
+ * @brief Only the owning thread writes its counters: a plain load and store is enough for readers to see whole values.
+ */
+inline void add_owned(std::atomic<uint64>& counter, uint64 value) {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+inline void add_shared(std::atomic<uint64>& counter, uint64 value) {
+    counter.fetch_add(value, std::memory_order_relaxed);
+}
+
+inline size_t get_histogram_bucket(uint64 size) {
+    if (size <= 16) {
+        return 0;
+    }
+
+    const size_t bucket = static_cast<size_t>(std::bit_width(size - 1)) - 4;
+    return bucket < memory_trace_histogram_size ? bucket : memory_trace_histogram_size - 1;
 }
 
-void MemoryTrace::global_add_allocate_bytes(uint64 size) {
-    get_default().add_allocate_bytes(size);
+void sum_counters(TagTotals (&totals)[memory_tag_count]) {
+    TraceRegistry& registry = get_registry();
+
+    const auto add = [&totals](const ThreadCounters& counters) {
+        for (size_t tag = 0; tag < memory_tag_count; tag++) {
+            const TagCounters& source = counters.tags[tag];
+            TagTotals& total = totals[tag];
+            total.allocated_bytes += source.allocated_bytes.load(std::memory_order_relaxed);
+            total.freed_bytes += source.freed_bytes.load(std::memory_order_relaxed);
+            total.allocation_count += source.allocation_count.load(std::memory_order_relaxed);
+            total.free_count += source.free_count.load(std::memory_order_relaxed);
+            for (size_t bucket = 0; bucket < memory_trace_histogram_size; bucket++) {
+                total.size_histogram[bucket] += source.size_histogram[bucket].load(std::memory_order_relaxed);
+            }
+        }
+    };
+
+    for (ThreadCounters* counters = registry.head.load(std::memory_order_acquire); counters; counters = counters->next) {
+        add(*counters);
+    }
+    add(registry.exited_counters);
+}
+
+inline int64 get_current_bytes(const TagTotals& totals) {
+    return static_cast<int64>(totals.allocated_bytes - totals.freed_bytes);
+}
+
+inline void add_live_bytes(size_t tag, int64 size) {
+    TagLiveBytes& live_bytes = get_registry().live_bytes[tag];
+    const int64 current_bytes = live_bytes.current_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+
+    int64 peak_bytes = live_bytes.peak_bytes.load(std::memory_order_relaxed);
+    while (current_bytes > peak_bytes &&
+           !live_bytes.peak_bytes.compare_exchange_weak(peak_bytes, current_bytes, std::memory_order_relaxed)) {
+    }
+}
+
+}  // namespace
+
+StringRef memory_tag_to_string(MemoryTag tag) {
+    switch (tag) {
+        case MemoryTag::General:
+            return "General";
+        case MemoryTag::Containers:
+            return "Containers";
+        case MemoryTag::Strings:
+            return "Strings";
+        case MemoryTag::Jobs:
+            return "Jobs";
+        case MemoryTag::Messaging:
+            return "Messaging";
+        case MemoryTag::Assets:
+            return "Assets";
+        case MemoryTag::RHI:
+            return "RHI";
+        case MemoryTag::Renderer:
+            return "Renderer";
+        case MemoryTag::Engine:
+            return "Engine";
+        default:
+            return "Unknown";
+    }
+}
+
+MemoryTagStatistics MemoryTraceSnapshot::get_total() const {
+    MemoryTagStatistics total;
+    for (const MemoryTagStatistics& statistics : tags) {
+        total.current_bytes += statistics.current_bytes;
+        total.peak_bytes += statistics.peak_bytes;
+        total.allocated_bytes += statistics.allocated_bytes;
+        total.freed_bytes += statistics.freed_bytes;
+        total.allocation_count += statistics.allocation_count;
+        total.free_count += statistics.free_count;
+        total.frame_allocation_count += statistics.frame_allocation_count;
+        for (size_t bucket = 0; bucket < memory_trace_histogram_size; bucket++) {
+            total.size_histogram[bucket] += statistics.size_histogram[bucket];
+        }
+    }
+    return total;
+}
+
+MemoryTraceSnapshot MemoryTraceSnapshot::diff(const MemoryTraceSnapshot& before) const {
+    MemoryTraceSnapshot result = *this;
+    for (size_t tag = 0; tag < memory_tag_count; tag++) {
+        MemoryTagStatistics& statistics = result.tags[tag];
+        const MemoryTagStatistics& earlier = before.tags[tag];
+        statistics.current_bytes -= earlier.current_bytes;
+        statistics.allocated_bytes -= earlier.allocated_bytes;
+        statistics.freed_bytes -= earlier.freed_bytes;
+        statistics.allocation_count -= earlier.allocation_count;
+        statistics.free_count -= earlier.free_count;
+        for (size_t bucket = 0; bucket < memory_trace_histogram_size; bucket++) {
+            statistics.size_histogram[bucket] -= earlier.size_histogram[bucket];
+        }
+    }
+    return result;
+}
+
+void MemoryTrace::global_add_freed_bytes(uint64 size, MemoryTag allocation_tag) {
+    const size_t tag = static_cast<size_t>(allocation_tag);
+    add_live_bytes(tag, -static_cast<int64>(size));
+    if (ThreadCounters* counters = get_thread_counters()) {
+        add_owned(counters->tags[tag].freed_bytes, size);
+        add_owned(counters->tags[tag].free_count, 1);
+    } else {
+        TagCounters& shared = get_registry().exited_counters.tags[tag];
+        add_shared(shared.freed_bytes, size);
+        add_shared(shared.free_count, 1);
+    }
+}
+
+void MemoryTrace::global_add_allocate_bytes(uint64 size, MemoryTag allocation_tag) {
+    const size_t tag = static_cast<size_t>(allocation_tag);
+    const size_t bucket = get_histogram_bucket(size);
+    add_live_bytes(tag, static_cast<int64>(size));
+    if (ThreadCounters* counters = get_thread_counters()) {
+        add_owned(counters->tags[tag].allocated_bytes, size);
+        add_owned(counters->tags[tag].allocation_count, 1);
+        add_owned(counters->tags[tag].size_histogram[bucket], 1);
+    } else {
+        TagCounters& shared = get_registry().exited_counters.tags[tag];
+        add_shared(shared.allocated_bytes, size);
+        add_shared(shared.allocation_count, 1);
+        add_shared(shared.size_histogram[bucket], 1);
+    }
 }
 
 size_t MemoryTrace::global_get_memory_usage() {
-    return get_default().get_memory_usage();
+    TagTotals totals[memory_tag_count];
+    sum_counters(totals);
+
+    int64 usage = 0;
+    for (const TagTotals& total : totals) {
+        usage += get_current_bytes(total);
+    }
+    return static_cast<size_t>(usage);
+}
+
+size_t MemoryTrace::global_get_allocation_count() {
+    TagTotals totals[memory_tag_count];
+    sum_counters(totals);
+
+    size_t count = 0;
+    for (const TagTotals& total : totals) {
+        count += total.allocation_count;
+    }
+    return count;
 }
 
-MemoryTrace& MemoryTrace::get_default() {
-    static MemoryTrace tracer;
-    return tracer;
+void MemoryTrace::global_mark_frame() {
+    TagTotals totals[memory_tag_count];
+    sum_counters(totals);
+
+    TraceRegistry& registry = get_registry();
+    std::lock_guard lock(registry.frame_mutex);
+
+    for (size_t tag = 0; tag < memory_tag_count; tag++) {
+        registry.frame_allocation_count[tag] = totals[tag].allocation_count - registry.frame_baseline[tag];
+        registry.frame_baseline[tag] = totals[tag].allocation_count;
+    }
+    registry.frame_index++;
 }
 
-void MemoryTrace::add_freed_bytes(uint64 size) {
-    memory_usage_ -= size;
+size_t MemoryTrace::global_get_frame_allocation_count() {
+    TraceRegistry& registry = get_registry();
+    std::lock_guard lock(registry.frame_mutex);
+
+    size_t count = 0;
+    for (uint64 frame_allocation_count : registry.frame_allocation_count) {
+        count += frame_allocation_count;
+    }
+    return count;
+}
+
+MemoryTraceSnapshot MemoryTrace::global_capture_snapshot() {
+    TagTotals totals[memory_tag_count];
+    sum_counters(totals);
+
+    TraceRegistry& registry = get_registry();
+    std::lock_guard lock(registry.frame_mutex);
+
+    MemoryTraceSnapshot snapshot;
+    snapshot.frame_index = registry.frame_index;
+    for (size_t tag = 0; tag < memory_tag_count; tag++) {
+        MemoryTagStatistics& statistics = snapshot.tags[tag];
+        statistics.current_bytes = get_current_bytes(totals[tag]);
+        statistics.peak_bytes = registry.live_bytes[tag].peak_bytes.load(std::memory_order_relaxed);
+        statistics.allocated_bytes = totals[tag].allocated_bytes;
+        statistics.freed_bytes = totals[tag].freed_bytes;
+        statistics.allocation_count = totals[tag].allocation_count;
+        statistics.free_count = totals[tag].free_count;
+        statistics.frame_allocation_count = registry.frame_allocation_count[tag];
+        for (size_t bucket = 0; bucket < memory_trace_histogram_size; bucket++) {
+            statistics.size_histogram[bucket] = totals[tag].size_histogram[bucket];
+        }
+    }
+    return snapshot;
+}
+
+void MemoryTrace::global_dump_snapshot(const MemoryTraceSnapshot& snapshot) {
+    LLOG_INFO("[MemoryTrace]", vformat("Memory trace at frame %llu:", static_cast<unsigned long long>(snapshot.frame_index)));
+
+    for (size_t tag = 0; tag < memory_tag_count; tag++) {
+        const MemoryTagStatistics& statistics = snapshot.tags[tag];
+        if (statistics.allocation_count == 0 && statistics.free_count == 0 && statistics.current_bytes == 0) {
+            continue;
+        }
+
+        LLOG_INFO("[MemoryTrace]", vformat("  %s: %lld bytes live (peak %lld), %llu allocations, %llu frees, %llu last frame",
+                                           memory_tag_to_string(static_cast<MemoryTag>(tag)).data(),
+                                           static_cast<long long>(statistics.current_bytes),
+                                           static_cast<long long>(statistics.peak_bytes),
+                                           static_cast<unsigned long long>(statistics.allocation_count),
+                                           static_cast<unsigned long long>(statistics.free_count),
+                                           static_cast<unsigned long long>(statistics.frame_allocation_count)));
+    }
 }
 
-void MemoryTrace::add_allocate_bytes(uint64 size) {
-    memory_usage_ += size;
+MemoryTag MemoryTrace::get_current_tag() {
+    return t_tag;
 }
 
-size_t MemoryTrace::get_memory_usage() const {
-    return memory_usage_;
+void MemoryTrace::set_current_tag(MemoryTag tag) {
+    t_tag = tag;
 }
 
-}  //namespace licht
\ No newline at end of file
+}  //namespace licht
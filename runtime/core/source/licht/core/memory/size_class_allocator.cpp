@@ -0,0 +1,595 @@
+#include "licht/core/memory/size_class_allocator.hpp"
+#include "licht/core/memory/memory.hpp"
+#include "licht/core/platform/platform_memory.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace licht {
+
+namespace {
+
+constexpr uint32 size_class_count = 32;
+constexpr uint32 invalid_size_class = size_class_count;
+constexpr uint32 span_magic = 0x5350414Eu;
+
+/**
+ * @brief 16 byte steps up to 128 bytes, then four classes per power of two up to `max_small_size`,
+ * which bounds the space lost to rounding at 25%.
+ */
+constexpr std::array<uint32, size_class_count> size_class_sizes = {
+    16, 32, 48, 64, 80, 96, 112, 128,
+    160, 192, 224, 256,
+    320, 384, 448, 512,
+    640, 768, 896, 1024,
+    1280, 1536, 1792, 2048,
+    2560, 3072, 3584, 4096,
+    5120, 6144, 7168, 8192};
+
+static_assert(size_class_sizes[size_class_count - 1] == SizeClassAllocator::max_small_size);
+
+struct FreeBlock {
+    FreeBlock* next;
+};
+
+/**
+ * @brief Header at the start of each span, followed by the tag of each block.
+ * The span of a block is found by masking its address.
+ */
+struct Span {
+    uint32 magic;
+    uint32 size_class;
+    uint32 capacity;
+    uint32 free_count;
+
+    /**
+     * @brief Blocks past this index have never been handed out, they are carved on demand
+     * so that a fresh span touches its pages only as it fills up.
+     */
+    uint32 carved_count;
+
+    FreeBlock* free_list;
+
+    Span* previous;
+    Span* next;
+    bool is_listed;
+};
+
+struct SizeClassInfo {
+    uint32 size;
+    uint32 alignment;
+    uint32 first_offset;
+    uint32 capacity;
+
+    /**
+     * @brief `ceil(2^32 / size)`: the index of a block is `(offset * reciprocal) >> 32`, exact for offsets within a span.
+     */
+    uint32 reciprocal;
+
+    /**
+     * @brief Blocks moved at once between a thread cache and the spans.
+     */
+    uint32 batch_count;
+};
+
+constexpr SizeClassInfo make_size_class_info(uint32 size) {
+    uint32 alignment = size & (~size + 1);
+    if (alignment > SizeClassAllocator::max_small_alignment) {
+        alignment = SizeClassAllocator::max_small_alignment;
+    }
+
+    // One tag byte per block between the header and the first block.
+    const uint32 span_size = static_cast<uint32>(SizeClassAllocator::span_size);
+    uint32 capacity = (span_size - static_cast<uint32>(sizeof(Span))) / (size + 1);
+    const uint32 first_offset = (static_cast<uint32>(sizeof(Span)) + capacity + alignment - 1) & ~(alignment - 1);
+    if (capacity > (span_size - first_offset) / size) {
+        capacity = (span_size - first_offset) / size;
+    }
+
+    const uint32 reciprocal = static_cast<uint32>(((uint64(1) << 32) + size - 1) / size);
+
+    uint32 batch_count = (16 * 1024) / size;
+    batch_count = batch_count < 2 ? 2 : (batch_count > 32 ? 32 : batch_count);
+
+    return SizeClassInfo{size, alignment, first_offset, capacity, reciprocal, batch_count};
+}
+
+constexpr std::array<SizeClassInfo, size_class_count> size_class_infos = []() {
+    std::array<SizeClassInfo, size_class_count> infos = {};
+    for (uint32 i = 0; i < size_class_count; i++) {
+        infos[i] = make_size_class_info(size_class_sizes[i]);
+    }
+    return infos;
+}();
+
+/**
+ * @brief Size class of every size in 16 byte steps, indexed by `(size + 15) / 16`.
+ */
+constexpr std::array<uint8, SizeClassAllocator::max_small_size / 16 + 1> size_class_lookup = []() {
+    std::array<uint8, SizeClassAllocator::max_small_size / 16 + 1> lookup = {};
+    uint32 size_class = 0;
+    for (uint32 i = 0; i < lookup.size(); i++) {
+        while (size_class_sizes[size_class] < i * 16) {
+            size_class++;
+        }
+        lookup[i] = static_cast<uint8>(size_class);
+    }
+    return lookup;
+}();
+
+inline uint32 get_size_class(size_t size, size_t alignment) {
+    if (size > SizeClassAllocator::max_small_size || alignment > SizeClassAllocator::max_small_alignment) {
+        return invalid_size_class;
+    }
+
+    uint32 size_class = size_class_lookup[(size + 15) >> 4];
+    while (size_class < size_class_count && size_class_infos[size_class].alignment < alignment) {
+        size_class++;
+    }
+    return size_class;
+}
+
+inline Span* get_span(const void* block) {
+    return reinterpret_cast<Span*>(reinterpret_cast<uintptr_t>(block) & ~(static_cast<uintptr_t>(SizeClassAllocator::span_size) - 1));
+}
+
+inline uint8& get_block_tag(Span* span, const void* block, const SizeClassInfo& info) {
+    const uint64 offset = reinterpret_cast<uintptr_t>(block) - reinterpret_cast<uintptr_t>(span) - info.first_offset;
+    const uint32 index = static_cast<uint32>((offset * info.reciprocal) >> 32);
+    return reinterpret_cast<uint8*>(span + 1)[index];
+}
+
+/**
+ * @brief Metadata in front of a large block, `get_large_header_size` bytes before it.
+ */
+struct LargeHeader {
+    uint8 tag;
+};
+
+inline size_t get_large_header_size(size_t alignment) {
+    return alignment > SizeClassAllocator::default_alignment ? alignment : SizeClassAllocator::default_alignment;
+}
+
+inline LargeHeader* get_large_header(const void* block) {
+    return reinterpret_cast<LargeHeader*>(reinterpret_cast<uintptr_t>(block) - sizeof(LargeHeader));
+}
+
+struct SpanList {
+    std::mutex mutex;
+
+    /**
+     * @brief Spans with free blocks. Full spans are unlisted until a block comes back.
+     */
+    Span* head = nullptr;
+};
+
+struct SpanHeap {
+    SpanList lists[size_class_count];
+
+    /**
+     * @brief Fully free spans, so that blocks handed from one thread to another do not map and unmap a span each time one drains.
+     */
+    std::mutex retained_mutex;
+    Span* retained_head = nullptr;
+    size_t retained_count = 0;
+
+    std::atomic<size_t> span_count = 0;
+    std::atomic<size_t> large_bytes = 0;
+    std::atomic<size_t> large_count = 0;
+};
+
+/**
+ * @brief Never destroyed: blocks may still be freed by static destructors running after this file's.
+ */
+SpanHeap& get_span_heap() {
+    alignas(SpanHeap) static uint8 s_storage[sizeof(SpanHeap)];
+    static SpanHeap* s_span_heap = ::new (s_storage) SpanHeap();
+    return *s_span_heap;
+}
+
+void link_span(SpanList& list, Span* span) {
+    span->previous = nullptr;
+    span->next = list.head;
+    if (list.head) {
+        list.head->previous = span;
+    }
+    list.head = span;
+    span->is_listed = true;
+}
+
+void unlink_span(SpanList& list, Span* span) {
+    if (span->previous) {
+        span->previous->next = span->next;
+    } else {
+        list.head = span->next;
+    }
+    if (span->next) {
+        span->next->previous = span->previous;
+    }
+    span->previous = nullptr;
+    span->next = nullptr;
+    span->is_listed = false;
+}
+
+Span* create_span(uint32 size_class) {
+    SpanHeap& heap = get_span_heap();
+
+    void* pages = nullptr;
+    {
+        std::lock_guard lock(heap.retained_mutex);
+        if (heap.retained_head) {
+            pages = heap.retained_head;
+            heap.retained_head = heap.retained_head->next;
+            heap.retained_count--;
+        }
+    }
+
+    if (!pages) {
+        pages = platform_allocate_pages(SizeClassAllocator::span_size, SizeClassAllocator::span_size);
+        if (!pages) {
+            return nullptr;
+        }
+        heap.span_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    const SizeClassInfo& info = size_class_infos[size_class];
+
+    Span* span = ::new (pages) Span();
+    span->magic = span_magic;
+    span->size_class = size_class;
+    span->capacity = info.capacity;
+    span->free_count = info.capacity;
+    span->carved_count = 0;
+    span->free_list = nullptr;
+    span->previous = nullptr;
+    span->next = nullptr;
+    span->is_listed = false;
+    return span;
+}
+
+void destroy_span(Span* span) {
+    SpanHeap& heap = get_span_heap();
+    span->magic = 0;
+
+    {
+        std::lock_guard lock(heap.retained_mutex);
+        if (heap.retained_count < SizeClassAllocator::max_retained_spans) {
+            span->next = heap.retained_head;
+            heap.retained_head = span;
+            heap.retained_count++;
+            return;
+        }
+    }
+
+    platform_free_pages(span, SizeClassAllocator::span_size);
+    heap.span_count.fetch_sub(1, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Takes up to `count` blocks of the class from its spans, mapping a new span if none has any left.
+ * @return The number of blocks chained from `out_head`, 0 if the OS is out of memory.
+ */
+uint32 take_blocks(uint32 size_class, uint32 count, FreeBlock*& out_head) {
+    const SizeClassInfo& info = size_class_infos[size_class];
+    SpanList& list = get_span_heap().lists[size_class];
+
+    std::lock_guard lock(list.mutex);
+
+    FreeBlock* head = nullptr;
+    uint32 taken = 0;
+    while (taken < count) {
+        Span* span = list.head;
+        if (!span) {
+            span = create_span(size_class);
+            if (!span) {
+                break;
+            }
+            link_span(list, span);
+        }
+
+        while (taken < count && span->free_count > 0) {
+            FreeBlock* block = span->free_list;
+            if (block) {
+                span->free_list = block->next;
+            } else {
+                const uintptr_t address = reinterpret_cast<uintptr_t>(span) + info.first_offset + static_cast<uintptr_t>(span->carved_count) * info.size;
+                block = reinterpret_cast<FreeBlock*>(address);
+                span->carved_count++;
+            }
+
+            block->next = head;
+            head = block;
+            span->free_count--;
+            taken++;
+        }
+
+        if (span->free_count == 0) {
+            unlink_span(list, span);
+        }
+    }
+
+    out_head = head;
+    return taken;
+}
+
+/**
+ * @brief Gives a chain of blocks of the class back to their spans, releasing spans left fully free.
+ * One free span per class is kept to absorb a thread allocating and freeing around a span boundary.
+ */
+void give_blocks(uint32 size_class, FreeBlock* head) {
+    SpanList& list = get_span_heap().lists[size_class];
+
+    std::lock_guard lock(list.mutex);
+
+    while (head) {
+        FreeBlock* block = head;
+        head = head->next;
+
+        Span* span = get_span(block);
+        LCHECK_MSG(span->magic == span_magic && span->size_class == size_class, "Block freed with a size or an alignment it was not allocated with.");
+
+        block->next = span->free_list;
+        span->free_list = block;
+        span->free_count++;
+
+        if (!span->is_listed) {
+            link_span(list, span);
+        }
+
+        if (span->free_count == span->capacity && (list.head != span || span->next)) {
+            unlink_span(list, span);
+            destroy_span(span);
+        }
+    }
+}
+
+enum class ThreadCacheState : uint8 {
+    Uninitialized,
+    Active,
+    Destroyed,
+};
+
+struct ThreadCacheList {
+    FreeBlock* head;
+    uint32 count;
+};
+
+/**
+ * @brief Trivially destructible so that it stays usable, as `Destroyed`, by thread_local destructors running after the guard's.
+ */
+struct ThreadCache {
+    ThreadCacheList lists[size_class_count];
+    ThreadCacheState state;
+};
+
+thread_local ThreadCache t_cache = {};
+
+void flush_cache(ThreadCache& cache) {
+    for (uint32 size_class = 0; size_class < size_class_count; size_class++) {
+        ThreadCacheList& list = cache.lists[size_class];
+        if (list.head) {
+            give_blocks(size_class, list.head);
+            list.head = nullptr;
+            list.count = 0;
+        }
+    }
+}
+
+struct ThreadCacheGuard {
+    ~ThreadCacheGuard() {
+        flush_cache(t_cache);
+        t_cache.state = ThreadCacheState::Destroyed;
+    }
+};
+
+thread_local ThreadCacheGuard t_cache_guard;
+
+/**
+ * @return false once the thread is exiting, when blocks go straight to the spans.
+ */
+bool prepare_cache(ThreadCache& cache) {
+    if (cache.state == ThreadCacheState::Uninitialized) {
+        // Constructs the guard, which registers its destructor for the thread exit.
+        static_cast<void>(&t_cache_guard);
+        cache.state = ThreadCacheState::Active;
+    }
+    return cache.state == ThreadCacheState::Active;
+}
+
+void* allocate_small_slow(uint32 size_class) {
+    ThreadCache& cache = t_cache;
+    const SizeClassInfo& info = size_class_infos[size_class];
+
+    if (!prepare_cache(cache)) {
+        FreeBlock* block = nullptr;
+        take_blocks(size_class, 1, block);
+        return block;
+    }
+
+    ThreadCacheList& list = cache.lists[size_class];
+    if (!list.head) {
+        list.count = take_blocks(size_class, info.batch_count, list.head);
+        if (!list.head) {
+            return nullptr;
+        }
+    }
+
+    FreeBlock* block = list.head;
+    list.head = block->next;
+    list.count--;
+    return block;
+}
+
+void free_small_slow(void* block, uint32 size_class) {
+    ThreadCache& cache = t_cache;
+    FreeBlock* free_block = static_cast<FreeBlock*>(block);
+
+    if (!prepare_cache(cache)) {
+        free_block->next = nullptr;
+        give_blocks(size_class, free_block);
+        return;
+    }
+
+    ThreadCacheList& list = cache.lists[size_class];
+    free_block->next = list.head;
+    list.head = free_block;
+    list.count++;
+
+    // Over two batches, the oldest batch goes back to the spans and the most recent, warmest, blocks stay.
+    const uint32 batch_count = size_class_infos[size_class].batch_count;
+    if (list.count > 2 * batch_count) {
+        FreeBlock* last_kept = list.head;
+        for (uint32 i = 1; i < batch_count; i++) {
+            last_kept = last_kept->next;
+        }
+
+        FreeBlock* released = last_kept->next;
+        last_kept->next = nullptr;
+        list.count = batch_count;
+        give_blocks(size_class, released);
+    }
+}
+
+void* allocate_large(size_t size, size_t alignment, uint8 tag) {
+    const size_t header_size = get_large_header_size(alignment);
+
+    void* base = nullptr;
+    if (alignment <= SizeClassAllocator::default_alignment) {
+        base = ::malloc(header_size + size);
+    } else {
+#ifdef _WIN32
+        base = ::_aligned_malloc(header_size + size, alignment);
+#else
+        if (::posix_memalign(&base, alignment, header_size + size) != 0) {
+            base = nullptr;
+        }
+#endif
+    }
+
+    if (!base) {
+        return nullptr;
+    }
+
+    SpanHeap& heap = get_span_heap();
+    heap.large_bytes.fetch_add(size, std::memory_order_relaxed);
+    heap.large_count.fetch_add(1, std::memory_order_relaxed);
+
+    void* block = static_cast<uint8*>(base) + header_size;
+    get_large_header(block)->tag = tag;
+    return block;
+}
+
+void free_large(void* block, size_t size, size_t alignment) {
+    SpanHeap& heap = get_span_heap();
+    heap.large_bytes.fetch_sub(size, std::memory_order_relaxed);
+    heap.large_count.fetch_sub(1, std::memory_order_relaxed);
+
+    void* base = static_cast<uint8*>(block) - get_large_header_size(alignment);
+#ifdef _WIN32
+    if (alignment > SizeClassAllocator::default_alignment) {
+        ::_aligned_free(base);
+        return;
+    }
+#endif
+    ::free(base);
+}
+
+}  // namespace
+
+void* SizeClassAllocator::allocate(size_t size, size_t alignment, uint8 tag) {
+    const uint32 size_class = get_size_class(size, alignment);
+    if (size_class == invalid_size_class) {
+        return allocate_large(size, alignment, tag);
+    }
+
+    ThreadCacheList& list = t_cache.lists[size_class];
+    FreeBlock* block = list.head;
+    if (block) {
+        list.head = block->next;
+        list.count--;
+    } else {
+        block = static_cast<FreeBlock*>(allocate_small_slow(size_class));
+        if (!block) {
+            return nullptr;
+        }
+    }
+
+    get_block_tag(get_span(block), block, size_class_infos[size_class]) = tag;
+    return block;
+}
+
+void SizeClassAllocator::free(void* block, size_t size, size_t alignment) {
+    if (!block) {
+        return;
+    }
+
+    if (get_size_class(size, alignment) == invalid_size_class) {
+        free_large(block, size, alignment);
+        return;
+    }
+
+    // The span knows the class of its blocks: a small block freed with another small size,
+    // e.g. through a base class deleter, still goes back to the list it came from.
+    // A large block freed with a small size has no span, its header is checked before being trusted.
+    const Span* span = get_span(block);
+    LCHECK_MSG(span->magic == span_magic && span->size_class < size_class_count,
+               "Small free of a block that was not allocated small, e.g. a large derived object freed through a small base.");
+    const uint32 size_class = span->size_class;
+
+    ThreadCacheList& list = t_cache.lists[size_class];
+    if (t_cache.state == ThreadCacheState::Active && list.count < 2 * size_class_infos[size_class].batch_count) {
+        FreeBlock* free_block = static_cast<FreeBlock*>(block);
+        free_block->next = list.head;
+        list.head = free_block;
+        list.count++;
+        return;
+    }
+
+    free_small_slow(block, size_class);
+}
+
+uint8 SizeClassAllocator::get_tag(const void* block, size_t size, size_t alignment) {
+    if (!block) {
+        return 0;
+    }
+
+    if (get_size_class(size, alignment) == invalid_size_class) {
+        return get_large_header(block)->tag;
+    }
+
+    Span* span = get_span(block);
+    LCHECK_MSG(span->magic == span_magic && span->size_class < size_class_count,
+               "Small block that was not allocated small, e.g. a large derived object freed through a small base.");
+    return get_block_tag(span, block, size_class_infos[span->size_class]);
+}
+
+void SizeClassAllocator::flush_thread_cache() {
+    if (t_cache.state == ThreadCacheState::Active) {
+        flush_cache(t_cache);
+    }
+}
+
+SizeClassAllocatorStatistics SizeClassAllocator::get_statistics() {
+    SpanHeap& heap = get_span_heap();
+
+    SizeClassAllocatorStatistics statistics;
+    statistics.span_count = heap.span_count.load(std::memory_order_relaxed);
+    statistics.span_bytes = statistics.span_count * span_size;
+    statistics.large_bytes = heap.large_bytes.load(std::memory_order_relaxed);
+    statistics.large_count = heap.large_count.load(std::memory_order_relaxed);
+    return statistics;
+}
+
+size_t SizeClassAllocator::get_allocation_size(size_t size, size_t alignment) {
+    const uint32 size_class = get_size_class(size, alignment);
+    return size_class == invalid_size_class ? size : size_class_infos[size_class].size;
+}
+
+}  //namespace licht
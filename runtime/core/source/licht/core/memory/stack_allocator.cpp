@@ -9,6 +9,38 @@ StackAllocator::StackAllocator(size_t size)
     initialize(size);
 }
 
+StackAllocator::StackAllocator(const StackAllocator& other)
+    : StackAllocator(other.size_) {
+}
+
+StackAllocator::StackAllocator(StackAllocator&& other) noexcept
+    : size_(other.size_), head_(other.head_), buffer_(other.buffer_) {
+    other.buffer_ = nullptr;
+    other.size_ = 0;
+    other.head_ = 0;
+}
+
+StackAllocator& StackAllocator::operator=(const StackAllocator& other) {
+    if (this != &other) {
+        destroy();
+        initialize(other.size_);
+    }
+    return *this;
+}
+
+StackAllocator& StackAllocator::operator=(StackAllocator&& other) noexcept {
+    if (this != &other) {
+        destroy();
+        size_ = other.size_;
+        head_ = other.head_;
+        buffer_ = other.buffer_;
+        other.buffer_ = nullptr;
+        other.size_ = 0;
+        other.head_ = 0;
+    }
+    return *this;
+}
+
 StackAllocator::~StackAllocator() {
     destroy();
 }
@@ -20,6 +52,10 @@ void StackAllocator::initialize(size_t size) {
 }
 
 void StackAllocator::destroy() {
+    if (!buffer_) {
+        return;
+    }
+
     Memory::free(buffer_, size_);
     buffer_ = nullptr;
     size_ = 0;
@@ -0,0 +1,158 @@
+#include "licht/core/memory/virtual_arena.hpp"
+#include "licht/core/memory/memory.hpp"
+#include "licht/core/platform/platform_memory.hpp"
+
+#include <utility>
+
+namespace licht {
+
+void* VirtualArena::allocate(size_t size, size_t alignment) {
+    if (!base_) {
+        return nullptr;
+    }
+
+    const uintptr_t base = reinterpret_cast<uintptr_t>(base_);
+    const size_t aligned_offset = Memory::align_address(base + offset_, alignment) - base;
+    if (aligned_offset + size > reserved_size_) {
+        // Out of address space.
+        return nullptr;
+    }
+
+    const size_t end = aligned_offset + size;
+    if (end > committed_size_ && !commit(end)) {
+        return nullptr;
+    }
+
+    offset_ = end;
+    if (offset_ > high_water_mark_) {
+        high_water_mark_ = offset_;
+    }
+
+    return base_ + aligned_offset;
+}
+
+void VirtualArena::deallocate(void* /* block */, size_t /* size */, size_t /* alignment */) {
+    // Blocks are freed all together, by `reset` or `rewind`.
+}
+
+bool VirtualArena::initialize(size_t reserve_size, size_t retained_size, bool use_huge_pages) {
+    destroy();
+
+    const size_t huge_page_size = use_huge_pages ? platform_get_huge_page_size() : 0;
+    commit_size_ = Memory::align_address(default_commit_size, platform_get_page_size());
+    if (huge_page_size > commit_size_) {
+        commit_size_ = huge_page_size;
+    }
+
+    reserved_size_ = Memory::align_address(reserve_size, commit_size_);
+    base_ = static_cast<uint8*>(platform_reserve_pages(reserved_size_, commit_size_));
+    if (!base_) {
+        reserved_size_ = 0;
+        return false;
+    }
+
+    if (huge_page_size != 0) {
+        platform_advise_huge_pages(base_, reserved_size_);
+    }
+
+    retained_size_ = Memory::align_address(retained_size, commit_size_);
+    if (retained_size_ > reserved_size_) {
+        retained_size_ = reserved_size_;
+    }
+
+    committed_size_ = 0;
+    offset_ = 0;
+    high_water_mark_ = 0;
+    return retained_size_ == 0 || commit(retained_size_);
+}
+
+void VirtualArena::destroy() {
+    if (!base_) {
+        return;
+    }
+
+    platform_free_pages(base_, reserved_size_);
+    base_ = nullptr;
+    reserved_size_ = 0;
+    committed_size_ = 0;
+    retained_size_ = 0;
+    offset_ = 0;
+    high_water_mark_ = 0;
+}
+
+void VirtualArena::reset() {
+    offset_ = 0;
+
+    if (committed_size_ > retained_size_) {
+        platform_decommit_pages(base_ + retained_size_, committed_size_ - retained_size_);
+        committed_size_ = retained_size_;
+    }
+}
+
+void VirtualArena::rewind(size_t offset) {
+    LCHECK_MSG(offset <= offset_, "Rewinding past the current offset.");
+    offset_ = offset;
+}
+
+void VirtualArena::reset_high_water_mark() {
+    high_water_mark_ = offset_;
+}
+
+bool VirtualArena::commit(size_t size) {
+    size_t committed_size = Memory::align_address(size, commit_size_);
+    if (committed_size > reserved_size_) {
+        committed_size = reserved_size_;
+    }
+
+    if (!platform_commit_pages(base_ + committed_size_, committed_size - committed_size_)) {
+        return false;
+    }
+
+    committed_size_ = committed_size;
+    return true;
+}
+
+VirtualArena::VirtualArena()
+    : base_(nullptr)
+    , reserved_size_(0)
+    , committed_size_(0)
+    , retained_size_(0)
+    , commit_size_(default_commit_size)
+    , offset_(0)
+    , high_water_mark_(0) {
+}
+
+VirtualArena::VirtualArena(size_t reserve_size, size_t retained_size, bool use_huge_pages)
+    : VirtualArena() {
+    initialize(reserve_size, retained_size, use_huge_pages);
+}
+
+VirtualArena::VirtualArena(VirtualArena&& other) noexcept
+    : base_(std::exchange(other.base_, nullptr))
+    , reserved_size_(std::exchange(other.reserved_size_, 0))
+    , committed_size_(std::exchange(other.committed_size_, 0))
+    , retained_size_(std::exchange(other.retained_size_, 0))
+    , commit_size_(other.commit_size_)
+    , offset_(std::exchange(other.offset_, 0))
+    , high_water_mark_(std::exchange(other.high_water_mark_, 0)) {
+}
+
+VirtualArena& VirtualArena::operator=(VirtualArena&& other) noexcept {
+    if (this != &other) {
+        destroy();
+        base_ = std::exchange(other.base_, nullptr);
+        reserved_size_ = std::exchange(other.reserved_size_, 0);
+        committed_size_ = std::exchange(other.committed_size_, 0);
+        retained_size_ = std::exchange(other.retained_size_, 0);
+        commit_size_ = other.commit_size_;
+        offset_ = std::exchange(other.offset_, 0);
+        high_water_mark_ = std::exchange(other.high_water_mark_, 0);
+    }
+    return *this;
+}
+
+VirtualArena::~VirtualArena() {
+    destroy();
+}
+
+}  //namespace licht
@@ -11,12 +11,12 @@ ModuleRegistry& ModuleRegistry::get_instance() {
     return s_instance;
 }
 
-Module* ModuleRegistry::load_module(const StringRef name) {
+Module* ModuleRegistry::load_module(Name name) {
     if (is_module_loaded(name)) {
         return get_module(name);
     }
 
-    String filepath_lib(name.data());
+    String filepath_lib(name.to_string().data());
     filepath_lib += DynamicLibraryLoader::extension();
 
     SharedRef<DynamicLibrary> library = nullptr;
@@ -27,7 +27,7 @@ Module* ModuleRegistry::load_module(const StringRef name) {
     }
 
     if (!pending_modules_.contains(name)) {
-        LLOG_ERROR("[ModuleRegistry]", vformat("Module '%s' is not registered and cannot be loaded.", name.data()))
+        LLOG_ERROR("[ModuleRegistry]", vformat("Module '%s' is not registered and cannot be loaded.", name.to_string().data()))
         return nullptr;
     }
 
@@ -46,7 +46,7 @@ Module* ModuleRegistry::load_module(const StringRef name) {
     return module;
 }
 
-void ModuleRegistry::unload_module(const StringRef name) {
+void ModuleRegistry::unload_module(Name name) {
     LoadedModule* loaded_module = loaded_modules_.get_ptr(name);
     if (!loaded_module) {
         return;
@@ -65,15 +65,15 @@ void ModuleRegistry::unload_module(const StringRef name) {
     loaded_modules_.remove(name);
 }
 
-bool ModuleRegistry::exists_module(const StringRef name) const {
+bool ModuleRegistry::exists_module(Name name) const {
     return pending_modules_.contains(name) || is_module_loaded(name);
 }
 
-bool ModuleRegistry::is_module_loaded(const StringRef name) const {
+bool ModuleRegistry::is_module_loaded(Name name) const {
     return loaded_modules_.contains(name);
 }
 
-Module* ModuleRegistry::get_module_interface(const StringRef name) {
+Module* ModuleRegistry::get_module_interface(Name name) {
     const LoadedModule* loaded_module = loaded_modules_.get_ptr(name);
     if (!loaded_module) {
         return nullptr;
@@ -81,14 +81,14 @@ Module* ModuleRegistry::get_module_interface(const StringRef name) {
     return loaded_module->module;
 }
 
-void ModuleRegistry::register_module(const StringRef name, const ModuleInitializerFunc& initializer) {
+void ModuleRegistry::register_module(Name name, ModuleInitializerFunc&& initializer) {
     if (!pending_modules_.contains(name)) {
-        pending_modules_.put(name, initializer);
-        LLOG_DEBUG("[ModuleRegistry]", vformat("The module '%s' has been registered.", name));
+        pending_modules_.put(Name(name), std::move(initializer));
+        LLOG_DEBUG("[ModuleRegistry]", vformat("The module '%s' has been registered.", name.to_string().data()));
     }
 }
 
-void ModuleRegistry::unregister_module(const StringRef name) {
+void ModuleRegistry::unregister_module(Name name) {
     pending_modules_.remove(name);
 }
 
@@ -0,0 +1,275 @@
+#ifdef __linux__
+
+#include "licht/core/platform/cpu_topology.hpp"
+#include "licht/core/containers/hash_map.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <utility>
+
+#include <sched.h>
+
+namespace licht {
+
+namespace {
+
+constexpr size_t sys_file_buffer_size = 256;
+
+/**
+ * @brief Reads a small sysfs file, such as a number or a CPU list, into `buffer`, without the trailing newline.
+ */
+bool read_sys_file(const char* path, char (&buffer)[sys_file_buffer_size]) {
+    std::FILE* file = std::fopen(path, "r");
+    if (!file) {
+        return false;
+    }
+
+    const size_t size = std::fread(buffer, 1, sys_file_buffer_size - 1, file);
+    std::fclose(file);
+
+    buffer[size] = '\0';
+    if (size > 0 && buffer[size - 1] == '\n') {
+        buffer[size - 1] = '\0';
+    }
+    return size > 0;
+}
+
+bool read_sys_number(const char* path, uint32& out_value) {
+    char buffer[sys_file_buffer_size];
+    if (!read_sys_file(path, buffer)) {
+        return false;
+    }
+
+    out_value = static_cast<uint32>(std::strtoul(buffer, nullptr, 10));
+    return true;
+}
+
+/**
+ * @brief Parses the kernel CPU list format, e.g. "0-3,8,10-11".
+ */
+Array<uint32> parse_cpu_list(const char* list) {
+    Array<uint32> processors;
+
+    const char* cursor = list;
+    while (*cursor) {
+        char* end = nullptr;
+        const uint32 first = static_cast<uint32>(std::strtoul(cursor, &end, 10));
+        if (end == cursor) {
+            break;
+        }
+
+        uint32 last = first;
+        if (*end == '-') {
+            cursor = end + 1;
+            last = static_cast<uint32>(std::strtoul(cursor, &end, 10));
+        }
+
+        for (uint32 processor = first; processor <= last; processor++) {
+            processors.append(processor);
+        }
+
+        cursor = *end == ',' ? end + 1 : end;
+    }
+
+    return processors;
+}
+
+/**
+ * @brief Cache sizes are written like "32K" or "16M".
+ */
+size_t parse_cache_size(const char* text) {
+    char* end = nullptr;
+    size_t size = static_cast<size_t>(std::strtoull(text, &end, 10));
+    switch (*end) {
+        case 'K':
+            size *= 1024;
+            break;
+        case 'M':
+            size *= 1024 * 1024;
+            break;
+        case 'G':
+            size *= 1024 * 1024 * 1024;
+            break;
+        default:
+            break;
+    }
+    return size;
+}
+
+void fill_fallback_topology(CpuTopology& topology, const Array<uint32>& processors) {
+    CpuNumaNode node;
+    for (uint32 processor : processors) {
+        CpuCore core;
+        core.logical_processors.append(processor);
+        topology.cores.append(std::move(core));
+        node.logical_processors.append(processor);
+    }
+    topology.numa_nodes.append(std::move(node));
+}
+
+void read_cores(CpuTopology& topology, const Array<uint32>& processors) {
+    // Cores are identified by their package and their id within it.
+    HashMap<uint64, uint32> core_indices;
+    char path[128];
+
+    for (uint32 processor : processors) {
+        uint32 package = 0;
+        uint32 core_id = processor;
+
+        std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/physical_package_id", processor);
+        read_sys_number(path, package);
+        std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/topology/core_id", processor);
+        read_sys_number(path, core_id);
+
+        const uint64 key = (static_cast<uint64>(package) << 32) | core_id;
+        if (const uint32* index = core_indices.get_ptr(key)) {
+            topology.cores[*index].logical_processors.append(processor);
+            continue;
+        }
+
+        core_indices.put(key, static_cast<uint32>(topology.cores.size()));
+
+        CpuCore core;
+        core.package = package;
+        core.logical_processors.append(processor);
+        topology.cores.append(std::move(core));
+    }
+}
+
+void read_caches(CpuTopology& topology, const Array<uint32>& processors) {
+    char path[128];
+    char buffer[sys_file_buffer_size];
+
+    for (uint32 processor : processors) {
+        for (uint32 index = 0;; index++) {
+            uint32 level = 0;
+            std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/level", processor, index);
+            if (!read_sys_number(path, level)) {
+                break;
+            }
+
+            std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/type", processor, index);
+            if (level < 2 || !read_sys_file(path, buffer) || std::strcmp(buffer, "Instruction") == 0) {
+                continue;
+            }
+
+            std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/shared_cpu_list", processor, index);
+            if (!read_sys_file(path, buffer)) {
+                continue;
+            }
+
+            // Only the processors the process may run on belong to the group, as for cores and nodes.
+            Array<uint32> sharing_processors;
+            for (uint32 sharing_processor : parse_cpu_list(buffer)) {
+                if (processors.contains(sharing_processor)) {
+                    sharing_processors.append(sharing_processor);
+                }
+            }
+
+            // Every processor of the group lists the same cache, it is kept once, for the first allowed of them.
+            if (sharing_processors.empty() || sharing_processors[0] != processor) {
+                continue;
+            }
+
+            CpuCacheGroup cache;
+            cache.level = level;
+            cache.logical_processors = std::move(sharing_processors);
+
+            std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%u/cache/index%u/size", processor, index);
+            if (read_sys_file(path, buffer)) {
+                cache.size = parse_cache_size(buffer);
+            }
+
+            topology.caches.append(std::move(cache));
+        }
+    }
+}
+
+void read_numa_nodes(CpuTopology& topology, const Array<uint32>& processors) {
+    char buffer[sys_file_buffer_size];
+    if (read_sys_file("/sys/devices/system/node/online", buffer)) {
+        char path[128];
+        for (uint32 index : parse_cpu_list(buffer)) {
+            std::snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", index);
+            if (!read_sys_file(path, buffer)) {
+                continue;
+            }
+
+            CpuNumaNode node;
+            node.index = index;
+            for (uint32 processor : parse_cpu_list(buffer)) {
+                if (processors.contains(processor)) {
+                    node.logical_processors.append(processor);
+                }
+            }
+
+            if (!node.logical_processors.empty()) {
+                topology.numa_nodes.append(std::move(node));
+            }
+        }
+    }
+
+    if (topology.numa_nodes.empty()) {
+        CpuNumaNode node;
+        node.logical_processors = processors;
+        topology.numa_nodes.append(std::move(node));
+    }
+
+    for (CpuCore& core : topology.cores) {
+        for (const CpuNumaNode& node : topology.numa_nodes) {
+            if (node.logical_processors.contains(core.logical_processors[0])) {
+                core.numa_node = node.index;
+            }
+        }
+    }
+}
+
+CpuTopology read_topology() {
+    CpuTopology topology;
+
+    // Only the processors the process may run on, e.g. within a container's cpuset.
+    Array<uint32> processors;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (::sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (uint32 processor = 0; processor < CPU_SETSIZE; processor++) {
+            if (CPU_ISSET(processor, &set)) {
+                processors.append(processor);
+            }
+        }
+    }
+
+    if (processors.empty()) {
+        const uint32 count = std::max<uint32>(1, std::thread::hardware_concurrency());
+        for (uint32 processor = 0; processor < count; processor++) {
+            processors.append(processor);
+        }
+    }
+
+    topology.logical_processor_count = static_cast<uint32>(processors.size());
+
+    char buffer[sys_file_buffer_size];
+    if (!read_sys_file("/sys/devices/system/cpu/online", buffer)) {
+        fill_fallback_topology(topology, processors);
+        return topology;
+    }
+
+    read_cores(topology, processors);
+    read_caches(topology, processors);
+    read_numa_nodes(topology, processors);
+    return topology;
+}
+
+}  // namespace
+
+const CpuTopology& platform_get_cpu_topology() {
+    static const CpuTopology s_topology = read_topology();
+    return s_topology;
+}
+
+}  //namespace licht
+
+#endif
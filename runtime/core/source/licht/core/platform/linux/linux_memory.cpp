@@ -0,0 +1,95 @@
+#ifdef __linux__
+
+#include "licht/core/platform/platform_memory.hpp"
+
+#include <fstream>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace licht {
+
+size_t platform_get_page_size() {
+    static const size_t s_page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    return s_page_size;
+}
+
+namespace {
+
+/**
+ * @brief mmap only guarantees page alignment: maps enough to find an aligned range, then unmaps the excess.
+ */
+void* map_aligned(size_t size, size_t alignment, int protection, int flags) {
+    const size_t page_size = platform_get_page_size();
+    alignment = alignment < page_size ? page_size : alignment;
+
+    const size_t mapped_size = size + alignment - page_size;
+    void* mapped = ::mmap(nullptr, mapped_size, protection, MAP_PRIVATE | MAP_ANONYMOUS | flags, -1, 0);
+    if (mapped == MAP_FAILED) {
+        return nullptr;
+    }
+
+    const uintptr_t mapped_begin = reinterpret_cast<uintptr_t>(mapped);
+    const uintptr_t aligned_begin = (mapped_begin + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+    const uintptr_t aligned_end = aligned_begin + ((size + page_size - 1) & ~(page_size - 1));
+    const uintptr_t mapped_end = mapped_begin + mapped_size;
+
+    if (aligned_begin > mapped_begin) {
+        ::munmap(mapped, aligned_begin - mapped_begin);
+    }
+    if (mapped_end > aligned_end) {
+        ::munmap(reinterpret_cast<void*>(aligned_end), mapped_end - aligned_end);
+    }
+
+    return reinterpret_cast<void*>(aligned_begin);
+}
+
+}  // namespace
+
+void* platform_allocate_pages(size_t size, size_t alignment) {
+    return map_aligned(size, alignment, PROT_READ | PROT_WRITE, 0);
+}
+
+void platform_free_pages(void* block, size_t size) {
+    if (block) {
+        ::munmap(block, size);
+    }
+}
+
+void* platform_reserve_pages(size_t size, size_t alignment) {
+    return map_aligned(size, alignment, PROT_NONE, MAP_NORESERVE);
+}
+
+bool platform_commit_pages(void* block, size_t size) {
+    return ::mprotect(block, size, PROT_READ | PROT_WRITE) == 0;
+}
+
+void platform_decommit_pages(void* block, size_t size) {
+    // Drops the physical pages, the next commit sees zeroes again.
+    ::madvise(block, size, MADV_DONTNEED);
+    ::mprotect(block, size, PROT_NONE);
+}
+
+bool platform_advise_huge_pages(void* block, size_t size) {
+#ifdef MADV_HUGEPAGE
+    return ::madvise(block, size, MADV_HUGEPAGE) == 0;
+#else
+    return false;
+#endif
+}
+
+size_t platform_get_huge_page_size() {
+    static const size_t s_huge_page_size = []() -> size_t {
+        std::ifstream file("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size");
+        size_t size = 0;
+        if (!(file >> size)) {
+            return 0;
+        }
+        return size;
+    }();
+    return s_huge_page_size;
+}
+
+}  //namespace licht
+
+#endif
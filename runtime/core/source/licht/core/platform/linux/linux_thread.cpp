@@ -0,0 +1,90 @@
+#ifdef __linux__
+
+#include "licht/core/platform/platform_thread.hpp"
+
+#include <cstring>
+
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+namespace licht {
+
+namespace {
+
+/**
+ * @brief The kernel keeps 16 bytes per thread name, terminator included.
+ */
+constexpr size_t thread_name_capacity = 16;
+
+bool make_cpu_set(const Array<uint32>& logical_processors, cpu_set_t& out_set) {
+    CPU_ZERO(&out_set);
+    for (uint32 processor : logical_processors) {
+        if (processor < CPU_SETSIZE) {
+            CPU_SET(processor, &out_set);
+        }
+    }
+    return CPU_COUNT(&out_set) > 0;
+}
+
+bool set_thread_affinity(pthread_t thread, const Array<uint32>& logical_processors) {
+    cpu_set_t set;
+    if (!make_cpu_set(logical_processors, set)) {
+        return false;
+    }
+    return ::pthread_setaffinity_np(thread, sizeof(set), &set) == 0;
+}
+
+bool set_thread_name(pthread_t thread, StringRef name) {
+    char truncated[thread_name_capacity];
+    std::strncpy(truncated, name.data(), thread_name_capacity - 1);
+    truncated[thread_name_capacity - 1] = '\0';
+    return ::pthread_setname_np(thread, truncated) == 0;
+}
+
+}  // namespace
+
+bool platform_set_current_thread_affinity(const Array<uint32>& logical_processors) {
+    return set_thread_affinity(::pthread_self(), logical_processors);
+}
+
+bool platform_set_thread_affinity(std::thread& thread, const Array<uint32>& logical_processors) {
+    return set_thread_affinity(thread.native_handle(), logical_processors);
+}
+
+bool platform_set_current_thread_name(StringRef name) {
+    return set_thread_name(::pthread_self(), name);
+}
+
+bool platform_set_thread_name(std::thread& thread, StringRef name) {
+    return set_thread_name(thread.native_handle(), name);
+}
+
+bool platform_set_current_thread_priority(ThreadPriority priority) {
+    // Threads of the default policy are weighted by their nice value, which Linux keeps per thread.
+    int32 nice_value = 0;
+    switch (priority) {
+        case ThreadPriority::Lowest:
+            nice_value = 10;
+            break;
+        case ThreadPriority::Low:
+            nice_value = 5;
+            break;
+        case ThreadPriority::Normal:
+            nice_value = 0;
+            break;
+        case ThreadPriority::High:
+            nice_value = -5;
+            break;
+        case ThreadPriority::Highest:
+            nice_value = -10;
+            break;
+    }
+
+    return ::setpriority(PRIO_PROCESS, static_cast<id_t>(::gettid()), nice_value) == 0;
+}
+
+}  //namespace licht
+
+#endif
@@ -0,0 +1,177 @@
+#ifdef _WIN32
+
+#include "licht/core/platform/windows/windows.hpp"
+
+#include "licht/core/memory/memory.hpp"
+#include "licht/core/platform/cpu_topology.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+namespace licht {
+
+namespace {
+
+/**
+ * @brief Logical processors are numbered across processor groups, 64 per group.
+ */
+void append_group_processors(const GROUP_AFFINITY& affinity, Array<uint32>& out_processors) {
+    for (uint32 bit = 0; bit < 64; bit++) {
+        if (affinity.Mask & (static_cast<KAFFINITY>(1) << bit)) {
+            out_processors.append(static_cast<uint32>(affinity.Group) * 64 + bit);
+        }
+    }
+}
+
+/**
+ * @brief Processors of the process affinity mask, empty when the process is not limited to a single group's mask.
+ */
+Array<uint32> read_allowed_processors() {
+    Array<uint32> processors;
+
+    DWORD_PTR process_mask = 0;
+    DWORD_PTR system_mask = 0;
+    // Both masks are zero for a process running threads in several groups.
+    if (!::GetProcessAffinityMask(::GetCurrentProcess(), &process_mask, &system_mask) || process_mask == 0) {
+        return processors;
+    }
+
+    USHORT group = 0;
+    USHORT group_count = 1;
+    if (!::GetProcessGroupAffinity(::GetCurrentProcess(), &group_count, &group)) {
+        return processors;
+    }
+
+    GROUP_AFFINITY affinity = {};
+    affinity.Mask = static_cast<KAFFINITY>(process_mask);
+    affinity.Group = group;
+    append_group_processors(affinity, processors);
+    return processors;
+}
+
+/**
+ * @brief Drops the processors the process may not run on from `groups`, and the groups left empty.
+ */
+template <typename GroupType>
+void keep_allowed_processors(Array<GroupType>& groups, const Array<uint32>& allowed_processors) {
+    for (GroupType& group : groups) {
+        group.logical_processors.remove_if([&allowed_processors](uint32 processor) -> bool {
+            return !allowed_processors.contains(processor);
+        });
+    }
+    groups.remove_if([](const GroupType& group) -> bool {
+        return group.logical_processors.empty();
+    });
+}
+
+CpuTopology read_topology() {
+    CpuTopology topology;
+    Array<Array<uint32>> packages;
+
+    DWORD length = 0;
+    ::GetLogicalProcessorInformationEx(RelationAll, nullptr, &length);
+
+    const size_t buffer_size = length;
+    uint8* buffer = Memory::allocate(buffer_size);
+    if (buffer && ::GetLogicalProcessorInformationEx(RelationAll, reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer), &length)) {
+        for (DWORD offset = 0; offset < length;) {
+            const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX* information =
+                reinterpret_cast<const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*>(buffer + offset);
+
+            switch (information->Relationship) {
+                case RelationProcessorCore: {
+                    CpuCore core;
+                    for (WORD i = 0; i < information->Processor.GroupCount; i++) {
+                        append_group_processors(information->Processor.GroupMask[i], core.logical_processors);
+                    }
+                    topology.cores.append(std::move(core));
+                    break;
+                }
+                case RelationProcessorPackage: {
+                    Array<uint32> processors;
+                    for (WORD i = 0; i < information->Processor.GroupCount; i++) {
+                        append_group_processors(information->Processor.GroupMask[i], processors);
+                    }
+                    packages.append(std::move(processors));
+                    break;
+                }
+                case RelationCache: {
+                    const CACHE_RELATIONSHIP& relationship = information->Cache;
+                    if (relationship.Level >= 2 && relationship.Type != CacheInstruction) {
+                        CpuCacheGroup cache;
+                        cache.level = relationship.Level;
+                        cache.size = relationship.CacheSize;
+                        append_group_processors(relationship.GroupMask, cache.logical_processors);
+                        topology.caches.append(std::move(cache));
+                    }
+                    break;
+                }
+                case RelationNumaNode: {
+                    CpuNumaNode node;
+                    node.index = information->NumaNode.NodeNumber;
+                    append_group_processors(information->NumaNode.GroupMask, node.logical_processors);
+                    topology.numa_nodes.append(std::move(node));
+                    break;
+                }
+                default:
+                    break;
+            }
+
+            offset += information->Size;
+        }
+    }
+    Memory::free(buffer, buffer_size);
+
+    // Only the processors the process may run on, e.g. within a job object or after `start /affinity`.
+    const Array<uint32> allowed_processors = read_allowed_processors();
+    if (!allowed_processors.empty()) {
+        keep_allowed_processors(topology.cores, allowed_processors);
+        keep_allowed_processors(topology.caches, allowed_processors);
+        keep_allowed_processors(topology.numa_nodes, allowed_processors);
+    }
+
+    if (topology.cores.empty()) {
+        const uint32 count = std::max<uint32>(1, std::thread::hardware_concurrency());
+        for (uint32 processor = 0; processor < count; processor++) {
+            CpuCore core;
+            core.logical_processors.append(processor);
+            topology.cores.append(std::move(core));
+        }
+    }
+
+    if (topology.numa_nodes.empty()) {
+        CpuNumaNode node;
+        for (const CpuCore& core : topology.cores) {
+            node.logical_processors.append_all(core.logical_processors);
+        }
+        topology.numa_nodes.append(std::move(node));
+    }
+
+    for (CpuCore& core : topology.cores) {
+        topology.logical_processor_count += static_cast<uint32>(core.logical_processors.size());
+        for (const CpuNumaNode& node : topology.numa_nodes) {
+            if (node.logical_processors.contains(core.logical_processors[0])) {
+                core.numa_node = node.index;
+            }
+        }
+        for (uint32 package = 0; package < packages.size(); package++) {
+            if (packages[package].contains(core.logical_processors[0])) {
+                core.package = package;
+            }
+        }
+    }
+
+    return topology;
+}
+
+}  // namespace
+
+const CpuTopology& platform_get_cpu_topology() {
+    static const CpuTopology s_topology = read_topology();
+    return s_topology;
+}
+
+}  //namespace licht
+
+#endif
@@ -0,0 +1,87 @@
+#ifdef _WIN32
+
+#include "licht/core/platform/windows/windows.hpp"
+
+#include "licht/core/platform/platform_memory.hpp"
+
+namespace licht {
+
+namespace {
+
+size_t get_allocation_granularity() {
+    SYSTEM_INFO system_info;
+    ::GetSystemInfo(&system_info);
+    return system_info.dwAllocationGranularity;
+}
+
+void* reserve_aligned(size_t size, size_t alignment, DWORD allocation_type, DWORD protection) {
+    static const size_t s_allocation_granularity = get_allocation_granularity();
+
+    // Reservations start on the allocation granularity, 64 KiB, which covers most alignments.
+    if (alignment <= s_allocation_granularity) {
+        return ::VirtualAlloc(nullptr, size, allocation_type, protection);
+    }
+
+    // Otherwise find an aligned address in a larger reservation, then reserve it alone.
+    // Another thread may take it in between, hence the retries.
+    for (uint32 attempt = 0; attempt < 8; attempt++) {
+        void* probe = ::VirtualAlloc(nullptr, size + alignment, MEM_RESERVE, PAGE_NOACCESS);
+        if (!probe) {
+            return nullptr;
+        }
+        ::VirtualFree(probe, 0, MEM_RELEASE);
+
+        const uintptr_t aligned = (reinterpret_cast<uintptr_t>(probe) + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+        if (void* block = ::VirtualAlloc(reinterpret_cast<void*>(aligned), size, allocation_type, protection)) {
+            return block;
+        }
+    }
+
+    return nullptr;
+}
+
+}  // namespace
+
+size_t platform_get_page_size() {
+    static const size_t s_page_size = []() -> size_t {
+        SYSTEM_INFO system_info;
+        ::GetSystemInfo(&system_info);
+        return system_info.dwPageSize;
+    }();
+    return s_page_size;
+}
+
+void* platform_allocate_pages(size_t size, size_t alignment) {
+    return reserve_aligned(size, alignment, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+}
+
+void platform_free_pages(void* block, size_t /* size */) {
+    if (block) {
+        ::VirtualFree(block, 0, MEM_RELEASE);
+    }
+}
+
+void* platform_reserve_pages(size_t size, size_t alignment) {
+    return reserve_aligned(size, alignment, MEM_RESERVE, PAGE_NOACCESS);
+}
+
+bool platform_commit_pages(void* block, size_t size) {
+    return ::VirtualAlloc(block, size, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+}
+
+void platform_decommit_pages(void* block, size_t size) {
+    ::VirtualFree(block, size, MEM_DECOMMIT);
+}
+
+bool platform_advise_huge_pages(void* /* block */, size_t /* size */) {
+    // Large pages need SeLockMemoryPrivilege and must be requested when committing, not hinted.
+    return false;
+}
+
+size_t platform_get_huge_page_size() {
+    return 0;
+}
+
+}  //namespace licht
+
+#endif
@@ -0,0 +1,79 @@
+#ifdef _WIN32
+
+#include "licht/core/platform/windows/windows.hpp"
+
+#include "licht/core/platform/platform_thread.hpp"
+#include "licht/core/string/string.hpp"
+
+namespace licht {
+
+namespace {
+
+/**
+ * @brief A thread runs within one processor group, the one of the first given processor.
+ */
+bool set_thread_affinity(HANDLE thread, const Array<uint32>& logical_processors) {
+    if (logical_processors.empty()) {
+        return false;
+    }
+
+    GROUP_AFFINITY affinity = {};
+    affinity.Group = static_cast<WORD>(logical_processors[0] / 64);
+    for (uint32 processor : logical_processors) {
+        if (processor / 64 == affinity.Group) {
+            affinity.Mask |= static_cast<KAFFINITY>(1) << (processor % 64);
+        }
+    }
+
+    return ::SetThreadGroupAffinity(thread, &affinity, nullptr) != 0;
+}
+
+bool set_thread_name(HANDLE thread, StringRef name) {
+    WString wname = unicode_of_str(name.data());
+    return SUCCEEDED(::SetThreadDescription(thread, wname.data()));
+}
+
+}  // namespace
+
+bool platform_set_current_thread_affinity(const Array<uint32>& logical_processors) {
+    return set_thread_affinity(::GetCurrentThread(), logical_processors);
+}
+
+bool platform_set_thread_affinity(std::thread& thread, const Array<uint32>& logical_processors) {
+    return set_thread_affinity(static_cast<HANDLE>(thread.native_handle()), logical_processors);
+}
+
+bool platform_set_current_thread_name(StringRef name) {
+    return set_thread_name(::GetCurrentThread(), name);
+}
+
+bool platform_set_thread_name(std::thread& thread, StringRef name) {
+    return set_thread_name(static_cast<HANDLE>(thread.native_handle()), name);
+}
+
+bool platform_set_current_thread_priority(ThreadPriority priority) {
+    int32 thread_priority = THREAD_PRIORITY_NORMAL;
+    switch (priority) {
+        case ThreadPriority::Lowest:
+            thread_priority = THREAD_PRIORITY_LOWEST;
+            break;
+        case ThreadPriority::Low:
+            thread_priority = THREAD_PRIORITY_BELOW_NORMAL;
+            break;
+        case ThreadPriority::Normal:
+            thread_priority = THREAD_PRIORITY_NORMAL;
+            break;
+        case ThreadPriority::High:
+            thread_priority = THREAD_PRIORITY_ABOVE_NORMAL;
+            break;
+        case ThreadPriority::Highest:
+            thread_priority = THREAD_PRIORITY_HIGHEST;
+            break;
+    }
+
+    return ::SetThreadPriority(::GetCurrentThread(), thread_priority) != 0;
+}
+
+}  //namespace licht
+
+#endif
@@ -0,0 +1,164 @@
+#include "licht/core/string/name.hpp"
+#include "licht/core/containers/hash_map.hpp"
+#include "licht/core/memory/memory.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+
+namespace licht {
+
+namespace {
+
+/**
+ * @brief Global table of the interned strings.
+ *
+ * Characters are appended to chunks that are never freed nor moved, so the views handed out stay valid.
+ * Ids index a paged array whose pages are published atomically: `get` never takes the lock,
+ * only `find` (shared) and `find_or_add` (exclusive) do to reach the string to id index.
+ */
+class NameTable {
+public:
+    static NameTable& get_instance() {
+        static NameTable s_table;
+        return s_table;
+    }
+
+    uint32 find(StringRef str) const {
+        std::shared_lock lock(mutex_);
+        const uint32* id = ids_.get_ptr(str);
+        return id ? *id : 0;
+    }
+
+    uint32 find_or_add(StringRef str) {
+        if (str.empty()) {
+            return 0;
+        }
+
+        {
+            std::shared_lock lock(mutex_);
+            if (const uint32* id = ids_.get_ptr(str)) {
+                return *id;
+            }
+        }
+
+        std::unique_lock lock(mutex_);
+
+        // Another thread may have added it between the two locks.
+        if (const uint32* id = ids_.get_ptr(str)) {
+            return *id;
+        }
+
+        const uint32 id = add(str.data(), str.size());
+        ids_.put(StringRef(get(id)), id);
+        return id;
+    }
+
+    const char* get(uint32 id) const {
+        LCHECK_MSG(id < count_.load(std::memory_order_acquire), "Invalid name id.");
+        const std::atomic<const char*>* page = pages_[id >> page_shift].load(std::memory_order_acquire);
+        return page[id & page_mask].load(std::memory_order_acquire);
+    }
+
+    uint32 count() const {
+        return count_.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr uint32 page_shift = 12;
+    static constexpr uint32 page_size = 1u << page_shift;
+    static constexpr uint32 page_mask = page_size - 1;
+    static constexpr uint32 max_pages = 1024;
+    static constexpr size_t chunk_size = 64 * 1024;
+
+    NameTable()
+        : ids_(1024) {
+        for (auto& page : pages_) {
+            page.store(nullptr, std::memory_order_relaxed);
+        }
+        add("", 0);
+    }
+
+    /**
+     * @brief Copies the characters and gives them the next id, the lock being held exclusively.
+     */
+    uint32 add(const char* str, size_t size) {
+        const uint32 id = count_.load(std::memory_order_relaxed);
+        LCHECK_MSG((id >> page_shift) < max_pages, "The name table is full.");
+
+        std::atomic<const char*>* page = pages_[id >> page_shift].load(std::memory_order_relaxed);
+        if (!page) {
+            page = reinterpret_cast<std::atomic<const char*>*>(
+                Memory::allocate(sizeof(std::atomic<const char*>) * page_size, alignof(std::atomic<const char*>)));
+            for (uint32 i = 0; i < page_size; i++) {
+                lplacement_new(page + i) std::atomic<const char*>(nullptr);
+            }
+            pages_[id >> page_shift].store(page, std::memory_order_release);
+        }
+
+        page[id & page_mask].store(store_characters(str, size), std::memory_order_release);
+        count_.store(id + 1, std::memory_order_release);
+        return id;
+    }
+
+    const char* store_characters(const char* str, size_t size) {
+        const size_t bytes = size + 1;
+
+        if (bytes > chunk_size / 4) {
+            // Long strings get their own block rather than wasting the end of a chunk.
+            char* block = reinterpret_cast<char*>(Memory::allocate(bytes));
+            Memory::copy(block, str, size);
+            block[size] = '\0';
+            return block;
+        }
+
+        if (chunk_offset_ + bytes > chunk_size || !chunk_) {
+            chunk_ = reinterpret_cast<char*>(Memory::allocate(chunk_size));
+            chunk_offset_ = 0;
+        }
+
+        char* characters = chunk_ + chunk_offset_;
+        Memory::copy(characters, str, size);
+        characters[size] = '\0';
+        chunk_offset_ += bytes;
+        return characters;
+    }
+
+private:
+    mutable std::shared_mutex mutex_;
+    HashMap<StringRef, uint32> ids_;
+    std::atomic<std::atomic<const char*>*> pages_[max_pages];
+    std::atomic<uint32> count_ = 0;
+    char* chunk_ = nullptr;
+    size_t chunk_offset_ = 0;
+};
+
+}  // namespace
+
+Name::Name(StringRef str)
+    : id_(NameTable::get_instance().find_or_add(str)) {
+}
+
+Name::Name(const char* str)
+    : Name(StringRef(str)) {
+}
+
+Name::Name(const String& str)
+    : Name(StringRef(str)) {
+}
+
+Name Name::find(StringRef str) {
+    Name name;
+    name.id_ = NameTable::get_instance().find(str);
+    return name;
+}
+
+uint32 Name::get_interned_count() {
+    return NameTable::get_instance().count();
+}
+
+StringRef Name::to_string() const {
+    return NameTable::get_instance().get(id_);
+}
+
+}  //namespace licht
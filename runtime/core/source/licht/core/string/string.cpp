@@ -43,6 +43,7 @@ WString unicode_of_str(const char* c_str) {
     WString wstring(size);
     size_t outSize;
     ::mbstowcs_s(&outSize, wstring.data(), size, c_str, size - 1);
+    wstring.resize_uninitialized(outSize > 0 ? outSize - 1 : 0);
     return wstring;
 }
 
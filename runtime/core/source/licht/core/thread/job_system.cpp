@@ -0,0 +1,300 @@
+#include "licht/core/thread/job_system.hpp"
+#include "licht/core/memory/default_allocator.hpp"
+#include "licht/core/memory/memory.hpp"
+#include "licht/core/memory/memory_trace.hpp"
+#include "licht/core/platform/cpu.hpp"
+#include "licht/core/platform/cpu_topology.hpp"
+#include "licht/core/platform/platform_thread.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <utility>
+
+namespace licht {
+
+namespace internal {
+
+struct Job {
+    JobFunction function;
+    JobCounter* counter;
+};
+
+}  //namespace internal
+
+namespace {
+
+thread_local JobSystem* t_current_system = nullptr;
+thread_local int32 t_current_worker_index = -1;
+thread_local uint64 t_steal_random_state = 0x9E3779B97F4A7C15ull;
+
+uint64 next_steal_random() {
+    // xorshift64, only used to spread the thieves over the victims.
+    uint64 x = t_steal_random_state;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    t_steal_random_state = x;
+    return x;
+}
+
+internal::Job* create_job(JobFunction&& function, JobCounter* counter) {
+    internal::Job* job = TypedDefaultAllocator<internal::Job>().allocate(1);
+    lplacement_new(job) internal::Job{std::move(function), counter};
+    return job;
+}
+
+void destroy_job(internal::Job* job) {
+    job->~Job();
+    TypedDefaultAllocator<internal::Job>().deallocate(job, 1);
+}
+
+}  // namespace
+
+JobSystem& JobSystem::get_instance() {
+    static JobSystem s_job_system;
+    return s_job_system;
+}
+
+size_t JobSystem::get_default_worker_count() {
+    const size_t core_count = std::max<size_t>(1, platform_get_cpu_topology().get_physical_core_count());
+    return core_count - 1;
+}
+
+int32 JobSystem::get_current_worker_index() {
+    return t_current_worker_index;
+}
+
+JobSystem::JobSystem(size_t worker_count)
+    : workers_()
+    , injected_jobs_(injection_capacity)
+    , pending_job_count_(0)
+    , sleeping_worker_count_(0)
+    , stopping_(false) {
+    start(worker_count);
+}
+
+JobSystem::~JobSystem() {
+    stop();
+}
+
+void JobSystem::start(size_t worker_count) {
+    LCHECK_MSG(!is_running(), "The job system is already running.");
+
+    stopping_.store(false, std::memory_order_relaxed);
+
+    // Every deque exists before any worker starts stealing.
+    workers_.reserve(worker_count);
+    for (size_t i = 0; i < worker_count; i++) {
+        Worker* worker = TypedDefaultAllocator<Worker>().allocate(1);
+        lplacement_new(worker) Worker();
+        workers_.append(worker);
+    }
+
+    const CpuTopology& topology = platform_get_cpu_topology();
+    const bool pin_workers = worker_count < topology.cores.size();
+
+    for (size_t i = 0; i < worker_count; i++) {
+        std::thread& thread = workers_[i]->thread;
+        thread = std::thread([this, i]() { worker_main(i); });
+
+        char name[16];
+        std::snprintf(name, sizeof(name), "Job %u", static_cast<uint32>(i));
+        platform_set_thread_name(thread, name);
+
+        if (pin_workers) {
+            platform_set_thread_affinity(thread, topology.cores[i + 1].logical_processors);
+        }
+    }
+}
+
+void JobSystem::stop() {
+    {
+        std::lock_guard lock(sleep_mutex_);
+        stopping_.store(true, std::memory_order_seq_cst);
+    }
+    wake_condition_.notify_all();
+
+    for (Worker* worker : workers_) {
+        worker->thread.join();
+    }
+
+    for (Worker* worker : workers_) {
+        worker->~Worker();
+        TypedDefaultAllocator<Worker>().deallocate(worker, 1);
+    }
+    workers_.clear();
+
+    // Jobs injected after the workers left.
+    internal::Job* job = nullptr;
+    while (injected_jobs_.try_pop(job)) {
+        pending_job_count_.fetch_sub(1, std::memory_order_relaxed);
+        execute(job);
+    }
+}
+
+void JobSystem::run(JobFunction function, JobCounter* counter) {
+    if (counter) {
+        counter->value_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    schedule(create_job(std::move(function), counter));
+}
+
+void JobSystem::run_after(JobCounter& dependency, JobFunction function, JobCounter* counter) {
+    if (counter) {
+        counter->value_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    internal::Job* job = create_job(std::move(function), counter);
+    {
+        std::lock_guard lock(dependency.continuation_mutex_);
+        if (dependency.value_.load(std::memory_order_acquire) != 0) {
+            dependency.continuations_.append(job);
+            return;
+        }
+    }
+
+    schedule(job);
+}
+
+void JobSystem::wait(JobCounter& counter) {
+    SpinWait spin;
+    while (!counter.is_done()) {
+        if (try_run_one_job()) {
+            spin.reset();
+        } else {
+            spin.wait();
+        }
+    }
+}
+
+bool JobSystem::try_run_one_job() {
+    Worker* worker = t_current_system == this ? workers_[t_current_worker_index] : nullptr;
+
+    internal::Job* job = nullptr;
+    if (!find_job(worker, job)) {
+        return false;
+    }
+
+    execute(job);
+    return true;
+}
+
+void JobSystem::schedule(internal::Job* job) {
+    if (workers_.empty()) {
+        execute(job);
+        return;
+    }
+
+    // Counted before the push so that a worker never sleeps past a job it could have seen.
+    pending_job_count_.fetch_add(1, std::memory_order_seq_cst);
+
+    if (t_current_system == this) {
+        workers_[t_current_worker_index]->deque.push(job);
+    } else {
+        injected_jobs_.push(job);
+    }
+
+    if (sleeping_worker_count_.load(std::memory_order_seq_cst) != 0) {
+        {
+            std::lock_guard lock(sleep_mutex_);
+        }
+        wake_condition_.notify_one();
+    }
+}
+
+void JobSystem::execute(internal::Job* job) {
+    job->function();
+
+    JobCounter* counter = job->counter;
+    destroy_job(job);
+
+    if (counter) {
+        finish(*counter);
+    }
+}
+
+void JobSystem::finish(JobCounter& counter) {
+    // A waiter returns only once `finishing_count_` is back to zero, this being the last access to the counter.
+    counter.finishing_count_.fetch_add(1, std::memory_order_relaxed);
+
+    Array<internal::Job*> continuations(NoAllocationOnConstructionPolicy{});
+    {
+        std::lock_guard lock(counter.continuation_mutex_);
+        if (counter.value_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::swap(continuations, counter.continuations_);
+        }
+    }
+
+    for (internal::Job* continuation : continuations) {
+        schedule(continuation);
+    }
+
+    counter.finishing_count_.fetch_sub(1, std::memory_order_release);
+}
+
+bool JobSystem::find_job(Worker* worker, internal::Job*& out_job) {
+    bool found = (worker && worker->deque.try_pop(out_job)) || injected_jobs_.try_pop(out_job);
+
+    if (!found && !workers_.empty()) {
+        const size_t worker_count = workers_.size();
+        const size_t first_victim = static_cast<size_t>(next_steal_random() % worker_count);
+        for (size_t i = 0; i < worker_count && !found; i++) {
+            Worker* victim = workers_[(first_victim + i) % worker_count];
+            found = victim != worker && victim->deque.try_steal(out_job);
+        }
+    }
+
+    if (found) {
+        pending_job_count_.fetch_sub(1, std::memory_order_relaxed);
+    }
+    return found;
+}
+
+void JobSystem::worker_main(size_t index) {
+    t_current_system = this;
+    t_current_worker_index = static_cast<int32>(index);
+    t_steal_random_state ^= (index + 1) * 0xBF58476D1CE4E5B9ull;
+
+    // Jobs that do not tag their allocations themselves are accounted to the job system.
+    MemoryTrace::set_current_tag(MemoryTag::Jobs);
+
+    Worker* worker = workers_[index];
+    SpinWait spin;
+    uint32 spin_count = 0;
+
+    while (true) {
+        internal::Job* job = nullptr;
+        if (find_job(worker, job)) {
+            execute(job);
+            spin.reset();
+            spin_count = 0;
+            continue;
+        }
+
+        if (spin_count < spin_count_before_sleep) {
+            spin.wait();
+            spin_count++;
+            continue;
+        }
+
+        std::unique_lock lock(sleep_mutex_);
+        if (stopping_.load(std::memory_order_seq_cst) && pending_job_count_.load(std::memory_order_seq_cst) <= 0) {
+            break;
+        }
+
+        sleeping_worker_count_.fetch_add(1, std::memory_order_seq_cst);
+        wake_condition_.wait(lock, [this]() {
+            return stopping_.load(std::memory_order_seq_cst) || pending_job_count_.load(std::memory_order_seq_cst) > 0;
+        });
+        sleeping_worker_count_.fetch_sub(1, std::memory_order_relaxed);
+
+        spin.reset();
+        spin_count = 0;
+    }
+
+    t_current_system = nullptr;
+    t_current_worker_index = -1;
+}
+
+}  //namespace licht
@@ -0,0 +1,144 @@
+#include "licht/core/thread/thread_pool.hpp"
+#include "licht/core/platform/cpu_topology.hpp"
+#include "licht/core/platform/platform_thread.hpp"
+
+#include <cstdio>
+
+namespace licht {
+
+ThreadPool& ThreadPool::get_instance() {
+    static ThreadPool s_thread_pool;
+    return s_thread_pool;
+}
+
+size_t ThreadPool::get_default_worker_count() {
+    const size_t core_count = std::max<size_t>(1, platform_get_cpu_topology().get_physical_core_count());
+    return core_count - 1;
+}
+
+ThreadPool::ThreadPool(size_t worker_count)
+    : tasks_(task_capacity)
+    , workers_()
+    , job_system_(nullptr)
+    , stopping_(false) {
+    start(worker_count);
+}
+
+ThreadPool::~ThreadPool() {
+    stop();
+}
+
+void ThreadPool::start(size_t worker_count) {
+    LCHECK_MSG(!is_running(), "The thread pool is already running.");
+
+    stopping_.store(false, std::memory_order_relaxed);
+
+    const CpuTopology& topology = platform_get_cpu_topology();
+    const bool pin_workers = worker_count < topology.cores.size();
+
+    workers_.reserve(worker_count);
+    for (size_t i = 0; i < worker_count; i++) {
+        workers_.append(std::thread([this]() { worker_main(); }));
+
+        char name[16];
+        // Thread names are limited to 15 characters on Linux, "Pool " and a 32-bit index always fit.
+        std::snprintf(name, sizeof(name), "Pool %u", static_cast<uint32>(i));
+        platform_set_thread_name(workers_.back(), name);
+
+        if (pin_workers) {
+            platform_set_thread_affinity(workers_.back(), topology.cores[i + 1].logical_processors);
+        }
+    }
+}
+
+void ThreadPool::start(JobSystem& job_system) {
+    LCHECK_MSG(!is_running(), "The thread pool is already running.");
+
+    job_system_ = &job_system;
+}
+
+void ThreadPool::stop() {
+    {
+        std::lock_guard lock(sleep_mutex_);
+        stopping_.store(true, std::memory_order_relaxed);
+    }
+    wake_condition_.notify_all();
+
+    for (std::thread& worker : workers_) {
+        worker.join();
+    }
+    workers_.clear();
+
+    // Tasks run as jobs belong to the job system, waited on by the `run_parallel` calls that submitted them.
+    // Detached once no worker of ours reads it.
+    job_system_ = nullptr;
+
+    // Tasks submitted after the workers left.
+    while (try_run_pending_task()) {
+    }
+}
+
+void ThreadPool::submit(Task task) {
+    if (job_system_) {
+        job_system_->run(std::move(task));
+        return;
+    }
+
+    if (workers_.empty() || !tasks_.try_push(std::move(task))) {
+        task();
+        return;
+    }
+
+    // Taking the lock orders the push with a worker checking the queue before it sleeps.
+    {
+        std::lock_guard lock(sleep_mutex_);
+    }
+    wake_condition_.notify_one();
+}
+
+bool ThreadPool::try_run_pending_task() {
+    if (job_system_) {
+        return job_system_->try_run_one_job();
+    }
+
+    Task task;
+    if (!tasks_.try_pop(task)) {
+        return false;
+    }
+
+    task();
+    return true;
+}
+
+void ThreadPool::worker_main() {
+    SpinWait spin;
+    uint32 spin_count = 0;
+
+    while (true) {
+        if (try_run_pending_task()) {
+            spin.reset();
+            spin_count = 0;
+            continue;
+        }
+
+        if (spin_count < spin_count_before_sleep) {
+            spin.wait();
+            spin_count++;
+            continue;
+        }
+
+        std::unique_lock lock(sleep_mutex_);
+        wake_condition_.wait(lock, [this]() {
+            return stopping_.load(std::memory_order_relaxed) || !tasks_.empty_approx();
+        });
+
+        if (stopping_.load(std::memory_order_relaxed) && tasks_.empty_approx()) {
+            return;
+        }
+
+        spin.reset();
+        spin_count = 0;
+    }
+}
+
+}  //namespace licht
@@ -30,6 +30,10 @@ Logger& Logger::get_default() {
 }
 
 void Logger::log(const LogMessage& message) const {
+    // Channels are only looked up once one is muted. `find` keeps unknown channels out of the name table.
+    if (!muted_channels_.empty() && muted_channels_.contains(Name::find(message.channel))) {
+        return;
+    }
     log_fn_(message);
 }
 
@@ -41,6 +45,18 @@ void Logger::set_delegate(LogFn func) {
     log_fn_ = func;
 }
 
+void Logger::set_channel_enabled(Name channel, bool enabled) {
+    if (enabled) {
+        muted_channels_.remove(channel);
+    } else {
+        muted_channels_.add(channel);
+    }
+}
+
+bool Logger::is_channel_enabled(Name channel) const {
+    return !muted_channels_.contains(channel);
+}
+
 Logger::Logger(LogFn fn)
     : log_fn_(fn) {}
 
@@ -0,0 +1,88 @@
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+
+#include "licht/core/algorithm/parallel.hpp"
+#include "licht/core/containers/array.hpp"
+#include "licht/core/containers/array_view.hpp"
+#include "licht/core/thread/thread_pool.hpp"
+
+using namespace licht;
+
+namespace {
+
+Array<uint32> iota(size_t count) {
+    Array<uint32> values(count);
+    for (uint32 i = 0; i < count; i++) {
+        values.append(i);
+    }
+    return values;
+}
+
+}  // namespace
+
+TEST_CASE("parallel_for - Visits every index and element once", "[parallel]") {
+    ThreadPool pool(3);
+    const size_t count = GENERATE(size_t(0), size_t(1), size_t(1000), size_t(100000));
+    const size_t grain_size = GENERATE(size_t(0), size_t(7), size_t(1024));
+
+    Array<std::atomic<uint32>> visits(count);
+    for (size_t i = 0; i < count; i++) {
+        visits.emplace_back(0);
+    }
+
+    parallel_for(count, [&](size_t i) { visits[i].fetch_add(1, std::memory_order_relaxed); }, grain_size, pool);
+
+    bool all_visited_once = true;
+    for (const std::atomic<uint32>& visit : visits) {
+        all_visited_once &= visit.load() == 1;
+    }
+    REQUIRE(all_visited_once);
+
+    Array<uint32> values = iota(count);
+    parallel_for(values, [](uint32& value) { value *= 2; }, grain_size, pool);
+    for (size_t i = 0; i < count; i++) {
+        REQUIRE(values[i] == i * 2);
+    }
+}
+
+TEST_CASE("parallel_map - Keeps the order of the elements", "[parallel]") {
+    ThreadPool pool(3);
+    const Array<uint32> values = iota(50000);
+
+    const Array<uint64> squares = parallel_map(values, [](uint32 value) { return uint64(value) * value; }, 512, pool);
+    REQUIRE(squares.size() == values.size());
+    for (size_t i = 0; i < values.size(); i++) {
+        REQUIRE(squares[i] == uint64(i) * i);
+    }
+
+    const Array<float32> halves = parallel_map(ArrayView<uint32>(values), [](uint32 value) {
+        return static_cast<float32>(value) * 0.5f;
+    }, 512, pool);
+    REQUIRE(halves[101] == 50.5f);
+}
+
+TEST_CASE("parallel_reduce - Gives the same result whatever the thread count", "[parallel]") {
+    Array<float32> values(100000);
+    for (uint32 i = 0; i < 100000; i++) {
+        values.append(1.0f / static_cast<float32>(i + 1));
+    }
+
+    auto sum = [](float32 total, float32 value) { return total + value; };
+
+    ThreadPool serial_pool;
+    const float32 expected = parallel_reduce(values, 0.0f, sum, 256, serial_pool);
+
+    ThreadPool pool(4);
+    for (uint32 run = 0; run < 10; run++) {
+        REQUIRE(parallel_reduce(values, 0.0f, sum, 256, pool) == expected);
+    }
+
+    const Array<uint32> indices = iota(10000);
+    const uint64 total = parallel_reduce(indices, uint64(0),
+        [](uint64 partial, uint32 value) { return partial + value; },
+        [](uint64 lhs, uint64 rhs) { return lhs + rhs; }, 100, pool);
+    REQUIRE(total == 10000ull * 9999 / 2);
+
+    REQUIRE(parallel_reduce(Array<uint32>(), uint32(7), [](uint32 a, uint32 b) { return a + b; }) == 7);
+}
@@ -0,0 +1,154 @@
+#include <catch2/catch_all.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <string>
+
+#include "licht/core/algorithm/sort.hpp"
+#include "licht/core/containers/array.hpp"
+#include "licht/core/string/string.hpp"
+
+using namespace licht;
+
+namespace {
+
+template <typename Key>
+Array<Key> random_keys(size_t count, uint64 seed) {
+    std::mt19937_64 random(seed);
+    Array<Key> keys(count);
+    for (size_t i = 0; i < count; i++) {
+        keys.append(static_cast<Key>(random()));
+    }
+    return keys;
+}
+
+template <typename Key>
+bool matches_std_sort(Array<Key> keys) {
+    Array<Key> expected = keys;
+    std::sort(expected.begin(), expected.end());
+    radix_sort(keys);
+    return keys == expected;
+}
+
+}  // namespace
+
+TEST_CASE("radix_sort - Orders integer keys like std::sort", "[sort][radix]") {
+    const size_t count = GENERATE(size_t(0), size_t(1), size_t(63), size_t(64), size_t(1000), size_t(100000));
+
+    REQUIRE(matches_std_sort(random_keys<uint32>(count, 1)));
+    REQUIRE(matches_std_sort(random_keys<uint64>(count, 2)));
+    REQUIRE(matches_std_sort(random_keys<int32>(count, 3)));
+    REQUIRE(matches_std_sort(random_keys<int64>(count, 4)));
+    REQUIRE(matches_std_sort(random_keys<uint16>(count, 5)));
+}
+
+TEST_CASE("radix_sort - Keys sharing their high bits", "[sort][radix]") {
+    // Only the low 12 bits vary, most passes are skipped.
+    Array<uint64> keys = random_keys<uint64>(5000, 6);
+    for (uint64& key : keys) {
+        key = 0xABCD000000000000ULL | (key & 0xFFF);
+    }
+    REQUIRE(matches_std_sort(keys));
+
+    Array<uint64> same;
+    same.resize(500, 42);
+    REQUIRE(matches_std_sort(same));
+}
+
+TEST_CASE("radix_sort - Carries values along the keys, stably", "[sort][radix]") {
+    Array<uint32> keys = random_keys<uint32>(10000, 7);
+    for (uint32& key : keys) {
+        key %= 100;  // Many equal keys.
+    }
+
+    Array<uint32> values(keys.size());
+    for (uint32 i = 0; i < keys.size(); i++) {
+        values.append(i);
+    }
+    const Array<uint32> original_keys = keys;
+
+    radix_sort(keys, values);
+
+    for (size_t i = 0; i < keys.size(); i++) {
+        REQUIRE(original_keys[values[i]] == keys[i]);
+        if (i > 0) {
+            REQUIRE(keys[i - 1] <= keys[i]);
+            if (keys[i - 1] == keys[i]) {
+                REQUIRE(values[i - 1] < values[i]);
+            }
+        }
+    }
+}
+
+TEST_CASE("parallel_sort - Orders like std::sort", "[sort][parallel]") {
+    const size_t count = GENERATE(size_t(0), size_t(10), size_t(5000), size_t(200000));
+    const size_t thread_count = GENERATE(size_t(1), size_t(3), size_t(8));
+
+    Array<uint64> keys = random_keys<uint64>(count, 8);
+    Array<uint64> expected = keys;
+    std::sort(expected.begin(), expected.end());
+
+    parallel_sort(keys, std::less<>(), thread_count, 1024);
+    REQUIRE(keys == expected);
+}
+
+TEST_CASE("parallel_sort - Custom comparison and non trivial elements", "[sort][parallel]") {
+    Array<String> strings(4096);
+    std::mt19937 random(9);
+    for (size_t i = 0; i < 4096; i++) {
+        String value("item-");
+        value.append(String(std::to_string(random() % 10000).c_str()));
+        strings.append(value);
+    }
+
+    parallel_sort(strings, [](const String& lhs, const String& rhs) {
+        return std::strcmp(lhs.data(), rhs.data()) > 0;
+    }, 4, 256);
+
+    for (size_t i = 1; i < strings.size(); i++) {
+        REQUIRE(std::strcmp(strings[i - 1].data(), strings[i].data()) >= 0);
+    }
+}
+
+TEST_CASE("parallel_radix_sort - Orders like std::sort", "[sort][parallel][radix]") {
+    const size_t count = GENERATE(size_t(0), size_t(10), size_t(5000), size_t(200000));
+    const size_t thread_count = GENERATE(size_t(1), size_t(3), size_t(8));
+
+    Array<uint64> keys = random_keys<uint64>(count, 10);
+    Array<uint64> expected = keys;
+    std::sort(expected.begin(), expected.end());
+    parallel_radix_sort(keys, thread_count, 1024);
+    REQUIRE(keys == expected);
+
+    Array<int32> signed_keys = random_keys<int32>(count, 11);
+    Array<int32> signed_expected = signed_keys;
+    std::sort(signed_expected.begin(), signed_expected.end());
+    parallel_radix_sort(signed_keys, thread_count, 1024);
+    REQUIRE(signed_keys == signed_expected);
+}
+
+TEST_CASE("parallel_radix_sort - Carries values along the keys, stably", "[sort][parallel][radix]") {
+    Array<uint64> keys = random_keys<uint64>(50000, 12);
+    for (uint64& key : keys) {
+        key = 0xABCD000000000000ULL | (key % 1000);  // Many equal keys, most passes skipped.
+    }
+
+    Array<uint32> values(keys.size());
+    for (uint32 i = 0; i < keys.size(); i++) {
+        values.append(i);
+    }
+    const Array<uint64> original_keys = keys;
+
+    parallel_radix_sort(keys, values, 5, 1024);
+
+    for (size_t i = 0; i < keys.size(); i++) {
+        REQUIRE(original_keys[values[i]] == keys[i]);
+        if (i > 0) {
+            REQUIRE(keys[i - 1] <= keys[i]);
+            if (keys[i - 1] == keys[i]) {
+                REQUIRE(values[i - 1] < values[i]);
+            }
+        }
+    }
+}
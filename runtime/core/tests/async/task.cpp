@@ -0,0 +1,249 @@
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+#include "licht/core/async/awaiters.hpp"
+#include "licht/core/async/frame_scheduler.hpp"
+#include "licht/core/async/task.hpp"
+#include "licht/core/async/when_all.hpp"
+#include "licht/core/containers/array.hpp"
+#include "licht/core/io/async_file_read.hpp"
+#include "licht/core/memory/shared_ref.hpp"
+#include "licht/core/string/string.hpp"
+#include "licht/core/thread/job_system.hpp"
+
+using namespace licht;
+
+namespace {
+
+Task<int32> make_value(int32 value) {
+    co_return value;
+}
+
+Task<int32> add_values(int32 lhs, int32 rhs) {
+    const int32 a = co_await make_value(lhs);
+    const int32 b = co_await make_value(rhs);
+    co_return a + b;
+}
+
+Task<int32> sum_deep_chain(int32 depth) {
+    if (depth == 0) {
+        co_return 0;
+    }
+    co_return 1 + co_await sum_deep_chain(depth - 1);
+}
+
+Task<uint64> square_on_worker(JobSystem& jobs, uint64 value) {
+    co_await resume_on_worker(jobs);
+    co_return value * value;
+}
+
+class MemoryFileHandle : public FileHandle {
+public:
+    explicit MemoryFileHandle(const char* content)
+        : content_(content) {}
+
+    virtual int64 tell() override { return 0; }
+    virtual bool seek(int64) override { return true; }
+    virtual bool read(uint8*, size_t) override { return false; }
+    virtual bool write(const uint8*, size_t) override { return false; }
+    virtual bool flush() override { return true; }
+    virtual size_t size() override { return std::strlen(content_); }
+
+    virtual Array<uint8> read_all_bytes() override {
+        Array<uint8> bytes(size());
+        for (size_t i = 0; i < size(); i++) {
+            bytes.append(static_cast<uint8>(content_[i]));
+        }
+        return bytes;
+    }
+
+private:
+    const char* content_;
+};
+
+class MemoryFileSystem : public FileSystem {
+public:
+    virtual bool file_exists(StringRef filepath) const override {
+        return String(filepath) == "shader.spv";
+    }
+
+    virtual void make_directory(StringRef) override {}
+    virtual void remove_file(StringRef) override {}
+    virtual void rename(StringRef, StringRef) override {}
+    virtual void move(StringRef, StringRef) override {}
+
+    virtual FileHandleResult open_write(StringRef) const override {
+        return FileHandleResult::Failure(FileSystemOpenError::Unkown);
+    }
+
+    virtual FileHandleResult open_read(StringRef filepath) const override {
+        if (!file_exists(filepath)) {
+            return FileHandleResult::Failure(FileSystemOpenError::FileNotExist);
+        }
+        return FileHandleResult::Success(new_ref<MemoryFileHandle>("SPIRV"));
+    }
+};
+
+}  // namespace
+
+TEST_CASE("Task - Awaits nested tasks", "[Task]") {
+    REQUIRE(sync_wait(add_values(40, 2)) == 42);
+
+    // Symmetric transfer keeps long chains from growing the stack.
+    REQUIRE(sync_wait(sum_deep_chain(10000)) == 10000);
+
+    bool ran = false;
+    auto set_ran = [](bool* out) -> Task<void> {
+        *out = true;
+        co_return;
+    };
+    sync_wait(set_ran(&ran));
+    REQUIRE(ran);
+}
+
+TEST_CASE("Task - Is lazy and spawn runs it to completion", "[Task]") {
+    bool started = false;
+    auto mark = [](bool* out) -> Task<void> {
+        *out = true;
+        co_return;
+    };
+
+    Task<void> task = mark(&started);
+    REQUIRE_FALSE(started);
+    spawn(std::move(task));
+    REQUIRE(started);
+}
+
+TEST_CASE("Task - resume_on_worker hops to a worker", "[Task]") {
+    JobSystem jobs(2);
+    REQUIRE(sync_wait(square_on_worker(jobs, 12), jobs) == 144);
+
+    // Nothing but the workers runs jobs here, so the coroutine can only resume on one of them.
+    std::atomic<int32> resumed_on_worker = -2;
+    auto report_worker = [](JobSystem& jobs, std::atomic<int32>* out) -> Task<void> {
+        co_await resume_on_worker(jobs);
+        out->store(JobSystem::get_current_worker_index());
+    };
+    spawn(report_worker(jobs, &resumed_on_worker));
+    while (resumed_on_worker.load() == -2) {
+        std::this_thread::yield();
+    }
+    REQUIRE(resumed_on_worker.load() >= 0);
+}
+
+TEST_CASE("Task - when_all completes once every task has", "[Task]") {
+    const size_t worker_count = GENERATE(size_t(0), size_t(3));
+    JobSystem jobs(worker_count);
+
+    auto [a, b, c] = sync_wait(when_all(square_on_worker(jobs, 2),
+                                        square_on_worker(jobs, 3),
+                                        make_value(7)), jobs);
+    REQUIRE(a == 4);
+    REQUIRE(b == 9);
+    REQUIRE(c == 7);
+
+    Array<Task<uint64>> tasks(100);
+    for (uint64 i = 0; i < 100; i++) {
+        tasks.append(square_on_worker(jobs, i));
+    }
+    const Array<uint64> squares = sync_wait(when_all(std::move(tasks)), jobs);
+    REQUIRE(squares.size() == 100);
+    for (uint64 i = 0; i < 100; i++) {
+        REQUIRE(squares[i] == i * i);
+    }
+
+    std::atomic<uint32> void_count = 0;
+    auto count_on_worker = [](JobSystem& jobs, std::atomic<uint32>* count) -> Task<void> {
+        co_await resume_on_worker(jobs);
+        count->fetch_add(1);
+    };
+    Array<Task<void>> void_tasks(10);
+    for (uint32 i = 0; i < 10; i++) {
+        void_tasks.append(count_on_worker(jobs, &void_count));
+    }
+    sync_wait(when_all(std::move(void_tasks)), jobs);
+    REQUIRE(void_count.load() == 10);
+}
+
+TEST_CASE("Task - next_frame and delay resume on ticks", "[Task]") {
+    FrameScheduler scheduler;
+    uint32 step = 0;
+
+    auto frames = [](FrameScheduler& scheduler, uint32* step) -> Task<void> {
+        *step = 1;
+        co_await next_frame(scheduler);
+        *step = 2;
+        co_await next_frame(scheduler);
+        *step = 3;
+        co_await delay(0.0, scheduler);
+        *step = 4;
+    };
+
+    spawn(frames(scheduler, &step));
+    REQUIRE(step == 1);
+
+    scheduler.tick();
+    REQUIRE(step == 2);
+
+    // Queued while the tick resumes coroutines, so it waits for the next tick.
+    scheduler.tick();
+    REQUIRE(step == 3);
+
+    scheduler.tick();
+    REQUIRE(step == 4);
+    REQUIRE(scheduler.get_frame_index() == 3);
+
+}
+
+TEST_CASE("Task - Coroutines still waiting are destroyed with the scheduler", "[Task]") {
+    struct DestroyFlag {
+        bool* destroyed;
+
+        ~DestroyFlag() {
+            *destroyed = true;
+        }
+    };
+
+    bool long_delay_done = false;
+    bool inner_destroyed = false;
+    bool outer_destroyed = false;
+
+    auto wait_long = [](FrameScheduler& scheduler, bool* done, bool* destroyed) -> Task<void> {
+        DestroyFlag flag{destroyed};
+        co_await delay(3600.0, scheduler);
+        *done = true;
+    };
+    auto wait_outer = [wait_long](FrameScheduler& scheduler, bool* done, bool* inner_destroyed, bool* outer_destroyed) -> Task<void> {
+        DestroyFlag flag{outer_destroyed};
+        co_await wait_long(scheduler, done, inner_destroyed);
+    };
+
+    {
+        FrameScheduler scheduler;
+        spawn(wait_outer(scheduler, &long_delay_done, &inner_destroyed, &outer_destroyed));
+        scheduler.tick();
+        REQUIRE_FALSE(long_delay_done);
+        REQUIRE_FALSE(inner_destroyed);
+    }
+
+    REQUIRE_FALSE(long_delay_done);
+    REQUIRE(inner_destroyed);
+    REQUIRE(outer_destroyed);
+}
+
+TEST_CASE("Task - read_file_async reads on a worker", "[Task]") {
+    JobSystem jobs(1);
+    MemoryFileSystem file_system;
+
+    FileOpenError<Array<uint8>> bytes = sync_wait(read_file_async(String("shader.spv"), file_system, jobs), jobs);
+    REQUIRE(bytes.has_value());
+    REQUIRE(bytes.value().size() == 5);
+    REQUIRE(bytes.value()[0] == 'S');
+
+    FileOpenError<Array<uint8>> missing = sync_wait(read_file_async(String("missing.spv"), file_system, jobs), jobs);
+    REQUIRE_FALSE(missing.has_value());
+    REQUIRE(missing.error() == FileSystemOpenError::FileNotExist);
+}
@@ -0,0 +1,241 @@
+#include <catch2/catch_all.hpp>
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/containers/spsc_queue.hpp"
+#include "licht/core/defines.hpp"
+#include "licht/core/memory/size_class_allocator.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+using namespace licht;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+float64 seconds_since(Clock::time_point begin) {
+    return std::chrono::duration<float64>(Clock::now() - begin).count();
+}
+
+struct SystemHeap {
+    static void* allocate(size_t size) {
+        return std::malloc(size);
+    }
+
+    static void free(void* block, size_t) {
+        std::free(block);
+    }
+};
+
+struct SizeClassHeap {
+    static void* allocate(size_t size) {
+        return SizeClassAllocator::allocate(size);
+    }
+
+    static void free(void* block, size_t size) {
+        SizeClassAllocator::free(block, size);
+    }
+};
+
+/**
+ * @brief Keeps a window of live blocks so that pairs do not always hit the same block.
+ */
+template <typename HeapType>
+float64 measure_pairs(size_t size, uint32 pair_count) {
+    constexpr uint32 window = 64;
+    void* blocks[window] = {};
+
+    const Clock::time_point begin = Clock::now();
+    for (uint32 i = 0; i < pair_count; i++) {
+        void*& block = blocks[i % window];
+        if (block) {
+            HeapType::free(block, size);
+        }
+        block = HeapType::allocate(size);
+        static_cast<uint8*>(block)[0] = static_cast<uint8>(i);
+    }
+    const float64 seconds = seconds_since(begin);
+
+    for (void* block : blocks) {
+        if (block) {
+            HeapType::free(block, size);
+        }
+    }
+    return pair_count / seconds;
+}
+
+template <typename HeapType>
+float64 measure_cross_thread(size_t size, uint32 block_count) {
+    SpscQueue<void*> queue(4096);
+
+    const Clock::time_point begin = Clock::now();
+    std::thread consumer([&queue, size, block_count]() {
+        for (uint32 i = 0; i < block_count; i++) {
+            void* block = nullptr;
+            while (!queue.try_pop(block)) {
+                std::this_thread::yield();
+            }
+            HeapType::free(block, size);
+        }
+    });
+
+    for (uint32 i = 0; i < block_count; i++) {
+        void* block = HeapType::allocate(size);
+        while (!queue.try_push(block)) {
+            std::this_thread::yield();
+        }
+    }
+    consumer.join();
+
+    return block_count / seconds_since(begin);
+}
+
+/**
+ * @brief One allocation of a synthetic engine trace: frame-transient strings and arrays,
+ * components and resources kept for a while, and a few long-lived large buffers.
+ */
+struct TraceEvent {
+    size_t size;
+    uint32 lifetime;
+};
+
+uint64 trace_random(uint64& state) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+Array<TraceEvent> make_engine_trace(uint32 event_count) {
+    Array<TraceEvent> trace(event_count);
+    uint64 state = 0x2545F4914F6CDD1Dull;
+
+    for (uint32 i = 0; i < event_count; i++) {
+        const uint64 kind = trace_random(state) % 100;
+        TraceEvent event = {};
+        if (kind < 55) {
+            // Names, strings and small temporary arrays.
+            event.size = 16 + trace_random(state) % 112;
+            event.lifetime = 1 + trace_random(state) % 64;
+        } else if (kind < 80) {
+            // Arrays growing by doubling.
+            event.size = size_t(32) << (trace_random(state) % 8);
+            event.lifetime = 16 + trace_random(state) % 1024;
+        } else if (kind < 97) {
+            // Components and render resources.
+            event.size = 128 + trace_random(state) % 2048;
+            event.lifetime = 1024 + trace_random(state) % 65536;
+        } else {
+            // Meshes, textures and staging buffers.
+            event.size = 16 * 1024 + trace_random(state) % (512 * 1024);
+            event.lifetime = 4096 + trace_random(state) % 262144;
+        }
+        trace.append(event);
+    }
+    return trace;
+}
+
+}  // namespace
+
+TEST_CASE("Allocator alloc/free pairs.", "[.][benchmark][Allocator]") {
+    constexpr uint32 pair_count = 1 << 22;
+
+    for (size_t size : {size_t(16), size_t(64), size_t(256), size_t(1024), size_t(4096)}) {
+        const float64 system_rate = measure_pairs<SystemHeap>(size, pair_count);
+        const float64 size_class_rate = measure_pairs<SizeClassHeap>(size, pair_count);
+
+        std::printf("Alloc/free pairs, %5zu bytes: malloc %8.2f Mpairs/s, SizeClassAllocator %8.2f Mpairs/s\n",
+                    size, system_rate / 1e6, size_class_rate / 1e6);
+    }
+}
+
+TEST_CASE("Allocator cross-thread frees.", "[.][benchmark][Allocator]") {
+    constexpr uint32 block_count = 1 << 20;
+
+    for (size_t size : {size_t(32), size_t(512)}) {
+        const float64 system_rate = measure_cross_thread<SystemHeap>(size, block_count);
+        const float64 size_class_rate = measure_cross_thread<SizeClassHeap>(size, block_count);
+
+        std::printf("Allocated on one thread, freed on another, %4zu bytes: malloc %8.2f Mblocks/s, SizeClassAllocator %8.2f Mblocks/s\n",
+                    size, system_rate / 1e6, size_class_rate / 1e6);
+    }
+}
+
+TEST_CASE("Allocator fragmentation on an engine allocation trace.", "[.][benchmark][Allocator]") {
+    constexpr uint32 event_count = 1 << 20;
+    const Array<TraceEvent> trace = make_engine_trace(event_count);
+
+    struct LiveBlock {
+        void* block;
+        size_t size;
+        uint32 free_at;
+    };
+
+    SizeClassAllocator::flush_thread_cache();
+    const SizeClassAllocatorStatistics baseline = SizeClassAllocator::get_statistics();
+
+    // Blocks are bucketed by the event they die at, so that replaying stays linear.
+    constexpr uint32 bucket_count = 1 << 12;
+    Array<Array<LiveBlock>> buckets(bucket_count);
+    for (uint32 i = 0; i < bucket_count; i++) {
+        buckets.emplace_back();
+    }
+
+    size_t live_bytes = 0;
+    size_t peak_live_bytes = 0;
+    size_t peak_reserved_bytes = 0;
+
+    const Clock::time_point begin = Clock::now();
+    for (uint32 i = 0; i < event_count; i++) {
+        Array<LiveBlock>& due = buckets[i % bucket_count];
+        for (size_t j = 0; j < due.size();) {
+            if (due[j].free_at == i) {
+                SizeClassAllocator::free(due[j].block, due[j].size);
+                live_bytes -= due[j].size;
+                due[j] = due[due.size() - 1];
+                due.pop();
+            } else {
+                j++;
+            }
+        }
+
+        const TraceEvent& event = trace[i];
+        void* block = SizeClassAllocator::allocate(event.size);
+        live_bytes += event.size;
+
+        const uint32 free_at = i + event.lifetime;
+        buckets[free_at % bucket_count].append(LiveBlock{block, event.size, free_at});
+
+        if (live_bytes > peak_live_bytes) {
+            peak_live_bytes = live_bytes;
+        }
+        if ((i & 4095) == 0) {
+            const SizeClassAllocatorStatistics statistics = SizeClassAllocator::get_statistics();
+            const size_t reserved_bytes = statistics.span_bytes + statistics.large_bytes - baseline.span_bytes - baseline.large_bytes;
+            if (reserved_bytes > peak_reserved_bytes) {
+                peak_reserved_bytes = reserved_bytes;
+            }
+        }
+    }
+    const float64 seconds = seconds_since(begin);
+
+    SizeClassAllocator::flush_thread_cache();
+    const SizeClassAllocatorStatistics end = SizeClassAllocator::get_statistics();
+
+    std::printf("Engine trace replay: %8.2f Mevents/s, peak live %8.2f MiB, peak reserved %8.2f MiB (%.2fx), %zu spans left for %8.2f MiB live\n",
+                event_count / seconds / 1e6,
+                peak_live_bytes / (1024.0 * 1024.0),
+                peak_reserved_bytes / (1024.0 * 1024.0),
+                static_cast<float64>(peak_reserved_bytes) / static_cast<float64>(peak_live_bytes),
+                end.span_count - baseline.span_count,
+                live_bytes / (1024.0 * 1024.0));
+
+    for (Array<LiveBlock>& bucket : buckets) {
+        for (const LiveBlock& live_block : bucket) {
+            SizeClassAllocator::free(live_block.block, live_block.size);
+        }
+    }
+}
@@ -0,0 +1,93 @@
+#include <catch2/catch_all.hpp>
+
+#include "licht/core/containers/bit_set.hpp"
+#include "licht/core/defines.hpp"
+
+#include <random>
+#include <string>
+
+using namespace licht;
+
+namespace {
+
+DynamicBitSet make_bits(size_t size, float64 density) {
+    DynamicBitSet bits(size);
+    std::mt19937_64 random(42);
+    std::bernoulli_distribution distribution(density);
+    for (size_t i = 0; i < size; ++i) {
+        if (distribution(random)) {
+            bits.set(i);
+        }
+    }
+    return bits;
+}
+
+}  // namespace
+
+TEST_CASE("DynamicBitSet set bit iteration over 1M bits.", "[.][benchmark][BitSet]") {
+    constexpr size_t bit_count = 1 << 20;
+    const float64 densities[] = {0.0001, 0.01, 0.1, 0.5, 0.9};
+
+    for (float64 density : densities) {
+        const DynamicBitSet bits = make_bits(bit_count, density);
+        const std::string suffix = " (density " + std::to_string(density) + ")";
+
+        BENCHMARK("test each bit" + suffix) {
+            size_t sum = 0;
+            for (size_t i = 0; i < bit_count; ++i) {
+                if (bits.test(i)) {
+                    sum += i;
+                }
+            }
+            return sum;
+        };
+
+        BENCHMARK("find_next loop" + suffix) {
+            size_t sum = 0;
+            for (size_t i = bits.find_first(); i != DynamicBitSet::npos; i = bits.find_next(i + 1)) {
+                sum += i;
+            }
+            return sum;
+        };
+
+        BENCHMARK("set_bits range" + suffix) {
+            size_t sum = 0;
+            for (size_t i : bits.set_bits()) {
+                sum += i;
+            }
+            return sum;
+        };
+
+        BENCHMARK("for_each_set" + suffix) {
+            size_t sum = 0;
+            bits.for_each_set([&](size_t i) { sum += i; });
+            return sum;
+        };
+    }
+}
+
+TEST_CASE("DynamicBitSet word operations over 1M bits.", "[.][benchmark][BitSet]") {
+    constexpr size_t bit_count = 1 << 20;
+    const DynamicBitSet a = make_bits(bit_count, 0.5);
+    const DynamicBitSet b = make_bits(bit_count, 0.5);
+    DynamicBitSet result = a;
+
+    BENCHMARK("and") {
+        result &= b;
+        return result.words()[0];
+    };
+
+    BENCHMARK("or") {
+        result |= b;
+        return result.words()[0];
+    };
+
+    BENCHMARK("and_not") {
+        result.and_not(b);
+        return result.words()[0];
+    };
+
+    BENCHMARK("count") {
+        return a.count();
+    };
+}
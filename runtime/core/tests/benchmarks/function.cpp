@@ -0,0 +1,76 @@
+#include <catch2/catch_all.hpp>
+
+#include "licht/core/defines.hpp"
+#include "licht/core/function/inplace_function.hpp"
+#include "licht/core/function/unique_function.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+
+using namespace licht;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+float64 seconds_since(Clock::time_point begin) {
+    return std::chrono::duration<float64>(Clock::now() - begin).count();
+}
+
+/**
+ * @brief Three pointers of captures: past the inline buffer of std::function in libstdc++, within ours.
+ */
+template <typename FunctionType>
+FunctionType make_function(uint64* a, uint64* b, uint64* c) {
+    return FunctionType([a, b, c](uint64 x) { return *a + *b + *c + x; });
+}
+
+template <typename FunctionType>
+float64 measure_construction(uint32 count) {
+    uint64 a = 1, b = 2, c = 3;
+    uint64 sum = 0;
+
+    const Clock::time_point begin = Clock::now();
+    for (uint32 i = 0; i < count; i++) {
+        FunctionType function = make_function<FunctionType>(&a, &b, &c);
+        FunctionType moved = std::move(function);
+        sum += moved(i);
+    }
+    const float64 seconds = seconds_since(begin);
+
+    REQUIRE(sum != 0);
+    return count / seconds;
+}
+
+template <typename FunctionType>
+float64 measure_invocation(uint32 count) {
+    uint64 a = 1, b = 2, c = 3;
+    FunctionType function = make_function<FunctionType>(&a, &b, &c);
+    uint64 sum = 0;
+
+    const Clock::time_point begin = Clock::now();
+    for (uint32 i = 0; i < count; i++) {
+        sum += function(sum & 0xff);
+    }
+    const float64 seconds = seconds_since(begin);
+
+    REQUIRE(sum != 0);
+    return count / seconds;
+}
+
+template <typename FunctionType>
+void report(const char* name, uint32 count) {
+    std::printf("%-16s construct+move: %8.2f Mops/s  invoke: %8.2f Mops/s\n",
+                name, measure_construction<FunctionType>(count) / 1e6, measure_invocation<FunctionType>(count) / 1e6);
+}
+
+}  // namespace
+
+TEST_CASE("Function construction and invocation throughput.", "[.][benchmark][Function]") {
+    constexpr uint32 count = 1 << 24;
+
+    report<std::function<uint64(uint64)>>("std::function", count);
+    report<InplaceFunction<uint64(uint64)>>("InplaceFunction", count);
+    report<UniqueFunction<uint64(uint64)>>("UniqueFunction", count);
+}
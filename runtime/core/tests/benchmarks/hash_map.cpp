@@ -0,0 +1,186 @@
+#include <catch2/catch_all.hpp>
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/containers/hash_map.hpp"
+#include "licht/core/defines.hpp"
+
+#include <random>
+#include <string>
+
+using namespace licht;
+
+namespace {
+
+/**
+ * Reference copy of the previous separate-chaining HashMap (one node allocation per entry),
+ * kept here so the open-addressing table can be compared against it.
+ */
+template <typename KeyType, typename ValueType>
+class ChainedHashMap {
+public:
+    struct Element {
+        KeyType key;
+        ValueType value;
+        Element* next;
+        size_t hash;
+    };
+
+    void put(const KeyType& key, const ValueType& value) {
+        if (static_cast<float64>(size_ + 1) > static_cast<float64>(capacity_) * 0.75) {
+            resize_rehash(capacity_ * 2);
+        }
+
+        size_t h = std::hash<KeyType>{}(key);
+        size_t idx = h % capacity_;
+        for (Element* cur = buckets_[idx]; cur; cur = cur->next) {
+            if (cur->key == key) {
+                cur->value = value;
+                return;
+            }
+        }
+
+        Element* element = new Element{key, value, buckets_[idx], h};
+        buckets_[idx] = element;
+        ++size_;
+    }
+
+    ValueType* get_ptr(const KeyType& key) {
+        size_t idx = std::hash<KeyType>{}(key) % capacity_;
+        for (Element* cur = buckets_[idx]; cur; cur = cur->next) {
+            if (cur->key == key) {
+                return &cur->value;
+            }
+        }
+        return nullptr;
+    }
+
+    ChainedHashMap()
+        : buckets_(new Element*[8]())
+        , size_(0)
+        , capacity_(8) {}
+
+    ~ChainedHashMap() {
+        for (size_t i = 0; i < capacity_; ++i) {
+            Element* cur = buckets_[i];
+            while (cur) {
+                Element* next = cur->next;
+                delete cur;
+                cur = next;
+            }
+        }
+        delete[] buckets_;
+    }
+
+private:
+    void resize_rehash(size_t new_capacity) {
+        Element** new_buckets = new Element*[new_capacity]();
+        for (size_t i = 0; i < capacity_; ++i) {
+            Element* cur = buckets_[i];
+            while (cur) {
+                Element* next = cur->next;
+                size_t idx = cur->hash % new_capacity;
+                cur->next = new_buckets[idx];
+                new_buckets[idx] = cur;
+                cur = next;
+            }
+        }
+        delete[] buckets_;
+        buckets_ = new_buckets;
+        capacity_ = new_capacity;
+    }
+
+private:
+    Element** buckets_;
+    size_t size_;
+    size_t capacity_;
+};
+
+Array<uint64> make_random_keys(size_t count, uint64 seed) {
+    std::mt19937_64 random(seed);
+    Array<uint64> keys(count);
+    for (size_t i = 0; i < count; ++i) {
+        keys.append(random());
+    }
+    return keys;
+}
+
+constexpr size_t lookup_batch = 4096;
+
+}  // namespace
+
+TEST_CASE("HashMap against the chained reference.", "[.][benchmark][HashMap]") {
+    const size_t count = GENERATE(size_t(1'000), size_t(100'000), size_t(10'000'000));
+    const std::string suffix = " (" + std::to_string(count) + " entries)";
+
+    Array<uint64> keys = make_random_keys(count, 0x11C47);
+    Array<uint64> misses = make_random_keys(lookup_batch, 0xBADC0DE);
+
+    Array<uint64> hits(lookup_batch);
+    std::mt19937_64 random(0x5EED);
+    for (size_t i = 0; i < lookup_batch; ++i) {
+        hits.append(keys[random() % count]);
+    }
+
+    BENCHMARK("HashMap::put" + suffix) {
+        HashMap<uint64, uint64> map;
+        for (uint64 key : keys) {
+            map.put(key, key);
+        }
+        return map.size();
+    };
+
+    BENCHMARK("ChainedHashMap::put" + suffix) {
+        ChainedHashMap<uint64, uint64> map;
+        for (uint64 key : keys) {
+            map.put(key, key);
+        }
+        return map.get_ptr(keys[0]) != nullptr;
+    };
+
+    HashMap<uint64, uint64> map;
+    ChainedHashMap<uint64, uint64> chained;
+    for (uint64 key : keys) {
+        map.put(key, key);
+        chained.put(key, key);
+    }
+
+    BENCHMARK("HashMap::get_ptr hit x4096" + suffix) {
+        uint64 sum = 0;
+        for (uint64 key : hits) {
+            sum += *map.get_ptr(key);
+        }
+        return sum;
+    };
+
+    BENCHMARK("ChainedHashMap::get_ptr hit x4096" + suffix) {
+        uint64 sum = 0;
+        for (uint64 key : hits) {
+            sum += *chained.get_ptr(key);
+        }
+        return sum;
+    };
+
+    BENCHMARK("HashMap::get_ptr miss x4096" + suffix) {
+        size_t found = 0;
+        for (uint64 key : misses) {
+            found += map.get_ptr(key) != nullptr;
+        }
+        return found;
+    };
+
+    BENCHMARK("ChainedHashMap::get_ptr miss x4096" + suffix) {
+        size_t found = 0;
+        for (uint64 key : misses) {
+            found += chained.get_ptr(key) != nullptr;
+        }
+        return found;
+    };
+
+    BENCHMARK("HashMap iteration" + suffix) {
+        uint64 sum = 0;
+        for (auto& [key, value] : map) {
+            sum += value;
+        }
+        return sum;
+    };
+}
@@ -0,0 +1,118 @@
+#include <catch2/catch_all.hpp>
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/defines.hpp"
+#include "licht/core/hash/hash_stream.hpp"
+#include "licht/core/hash/hasher.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <string_view>
+
+using namespace licht;
+
+namespace {
+
+Array<uint8> make_bytes(size_t count) {
+    Array<uint8> bytes(count);
+    uint64 state = 0x2545F4914F6CDD1DULL;
+    for (size_t i = 0; i < count; ++i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        bytes.append(static_cast<uint8>(state));
+    }
+    return bytes;
+}
+
+/**
+ * Reference copy of the previous byte hash (64-bit FNV-1a).
+ */
+uint64 fnv1a(const void* data, size_t size) {
+    const uint8* bytes = static_cast<const uint8*>(data);
+    uint64 hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+volatile uint64 throughput_sink = 0;
+
+/**
+ * Runs `hash` over `size` bytes for at least 200ms and prints the throughput in GB/s.
+ */
+template <typename HashFunction>
+void report_throughput(const char* name, size_t size, HashFunction&& hash) {
+    using Clock = std::chrono::steady_clock;
+
+    uint64 sink = 0;
+    size_t iterations = 0;
+    const Clock::time_point start = Clock::now();
+    Clock::duration elapsed;
+    do {
+        for (size_t i = 0; i < 16; ++i) {
+            sink += hash();
+        }
+        iterations += 16;
+        elapsed = Clock::now() - start;
+    } while (elapsed < std::chrono::milliseconds(200));
+
+    const float64 seconds = std::chrono::duration<float64>(elapsed).count();
+    const float64 gigabytes = static_cast<float64>(size) * static_cast<float64>(iterations) / 1e9;
+    throughput_sink = sink;
+    std::printf("%-28s %10zu bytes: %8.2f GB/s\n", name, size, gigabytes / seconds);
+}
+
+}  // namespace
+
+TEST_CASE("Hash throughput.", "[.][benchmark][Hasher]") {
+    const size_t size = GENERATE(size_t(16), size_t(64), size_t(1024), size_t(64 * 1024), size_t(16 * 1024 * 1024));
+    const Array<uint8> bytes = make_bytes(size);
+    const std::string_view view(reinterpret_cast<const char*>(bytes.data()), size);
+
+    report_throughput("Hasher::hash_bytes", size, [&]() {
+        return Hasher::hash_bytes(bytes.data(), size);
+    });
+
+    report_throughput("HashStream (4 KiB chunks)", size, [&]() {
+        HashStream stream;
+        for (size_t offset = 0; offset < size; offset += 4096) {
+            stream.update(bytes.data() + offset, offset + 4096 < size ? 4096 : size - offset);
+        }
+        return stream.finalize();
+    });
+
+    report_throughput("std::hash<std::string_view>", size, [&]() {
+        return static_cast<uint64>(std::hash<std::string_view>{}(view));
+    });
+
+    if (size <= 64 * 1024) {
+        report_throughput("FNV-1a", size, [&]() {
+            return fnv1a(bytes.data(), size);
+        });
+    }
+
+    const std::string suffix = " (" + std::to_string(size) + " bytes)";
+
+    BENCHMARK("Hasher::hash_bytes" + suffix) {
+        return Hasher::hash_bytes(bytes.data(), size);
+    };
+
+    BENCHMARK("std::hash<std::string_view>" + suffix) {
+        return std::hash<std::string_view>{}(view);
+    };
+}
+
+TEST_CASE("Hash combine throughput.", "[.][benchmark][Hasher]") {
+    BENCHMARK("Hasher::hash_values x1024 (4 fields)") {
+        uint64 sum = 0;
+        for (uint32 i = 0; i < 1024; ++i) {
+            sum += Hasher::hash_values(i, i * 3u, static_cast<uint64>(i) << 32, i ^ 0x55u);
+        }
+        return sum;
+    };
+}
@@ -0,0 +1,96 @@
+#include <catch2/catch_all.hpp>
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/defines.hpp"
+#include "licht/core/thread/job_system.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+
+using namespace licht;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+float64 seconds_since(Clock::time_point begin) {
+    return std::chrono::duration<float64>(Clock::now() - begin).count();
+}
+
+}  // namespace
+
+TEST_CASE("Job scheduling overhead.", "[.][benchmark][JobSystem]") {
+    constexpr uint32 job_count = 1 << 20;
+    const size_t worker_count = GENERATE(size_t(1), size_t(3), size_t(7));
+    JobSystem jobs(worker_count);
+
+    SECTION("From an outside thread") {
+        JobCounter counter;
+        const Clock::time_point begin = Clock::now();
+        for (uint32 i = 0; i < job_count; i++) {
+            jobs.run([]() {}, &counter);
+        }
+        jobs.wait(counter);
+        const float64 seconds = seconds_since(begin);
+
+        std::printf("JobSystem %zu workers, empty jobs from outside: %8.2f Mjobs/s\n",
+                    worker_count, job_count / seconds / 1e6);
+    }
+
+    SECTION("From a worker") {
+        JobCounter counter;
+        const Clock::time_point begin = Clock::now();
+        jobs.run([&]() {
+            for (uint32 i = 0; i < job_count; i++) {
+                jobs.run([]() {}, &counter);
+            }
+        }, &counter);
+        jobs.wait(counter);
+        const float64 seconds = seconds_since(begin);
+
+        std::printf("JobSystem %zu workers, empty jobs from a worker: %8.2f Mjobs/s\n",
+                    worker_count, job_count / seconds / 1e6);
+    }
+}
+
+TEST_CASE("Job fan-out/fan-in.", "[.][benchmark][JobSystem]") {
+    constexpr uint32 frame_count = 1000;
+    constexpr uint32 fan_out = 64;
+    constexpr uint32 work_per_job = 2000;
+    const size_t worker_count = GENERATE(size_t(1), size_t(3), size_t(7));
+    JobSystem jobs(worker_count);
+
+    // A frame: one job fans out to `fan_out` jobs doing a little arithmetic, a last one gathers their results.
+    Array<uint64> results;
+    results.resize(fan_out, 0);
+    uint64 checksum = 0;
+
+    const Clock::time_point begin = Clock::now();
+    for (uint32 frame = 0; frame < frame_count; frame++) {
+        JobCounter fan_out_counter;
+        JobCounter gather_counter;
+
+        for (uint32 i = 0; i < fan_out; i++) {
+            jobs.run([&results, i, frame]() {
+                uint64 value = i + frame;
+                for (uint32 k = 0; k < work_per_job; k++) {
+                    value = value * 6364136223846793005ull + 1442695040888963407ull;
+                }
+                results[i] = value;
+            }, &fan_out_counter);
+        }
+
+        jobs.run_after(fan_out_counter, [&results, &checksum]() {
+            for (uint64 result : results) {
+                checksum ^= result;
+            }
+        }, &gather_counter);
+
+        jobs.wait(gather_counter);
+    }
+    const float64 seconds = seconds_since(begin);
+
+    std::printf("JobSystem %zu workers, fan-out of %u jobs then gather: %8.2f us/frame (checksum %llx)\n",
+                worker_count, fan_out, seconds / frame_count * 1e6, static_cast<unsigned long long>(checksum));
+}
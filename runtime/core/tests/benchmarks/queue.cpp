@@ -0,0 +1,119 @@
+#include <catch2/catch_all.hpp>
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/containers/mpmc_queue.hpp"
+#include "licht/core/containers/spsc_queue.hpp"
+#include "licht/core/defines.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+using namespace licht;
+
+namespace {
+
+/**
+ * Reference queue: a std::deque behind a mutex, what a naive cross-thread queue would use.
+ */
+template <typename ElementType>
+class MutexQueue {
+public:
+    bool try_push(const ElementType& element) {
+        std::lock_guard lock(mutex_);
+        if (queue_.size() >= capacity_) {
+            return false;
+        }
+        queue_.push_back(element);
+        return true;
+    }
+
+    bool try_pop(ElementType& out) {
+        std::lock_guard lock(mutex_);
+        if (queue_.empty()) {
+            return false;
+        }
+        out = queue_.front();
+        queue_.pop_front();
+        return true;
+    }
+
+    explicit MutexQueue(size_t capacity)
+        : capacity_(capacity) {}
+
+private:
+    std::mutex mutex_;
+    std::deque<ElementType> queue_;
+    size_t capacity_;
+};
+
+/**
+ * Moves `per_producer` values from each of `producer_count` producers to as many consumers,
+ * and prints the number of values going through the queue per second.
+ */
+template <typename QueueType>
+void report_throughput(const char* name, uint32 producer_count, uint32 consumer_count, uint64 per_producer) {
+    using Clock = std::chrono::steady_clock;
+
+    QueueType queue(1024);
+    const uint64 total = per_producer * producer_count;
+    std::atomic<uint64> consumed = 0;
+    std::atomic<bool> start = false;
+
+    Array<std::thread> threads;
+    for (uint32 p = 0; p < producer_count; p++) {
+        threads.append(std::thread([&]() {
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (uint64 i = 0; i < per_producer; i++) {
+                while (!queue.try_push(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        }));
+    }
+
+    for (uint32 c = 0; c < consumer_count; c++) {
+        threads.append(std::thread([&]() {
+            uint64 value;
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                if (queue.try_pop(value)) {
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }));
+    }
+
+    const Clock::time_point begin = Clock::now();
+    start.store(true, std::memory_order_release);
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    const float64 seconds = std::chrono::duration<float64>(Clock::now() - begin).count();
+
+    std::printf("%-12s %u producers / %u consumers: %8.2f Mops/s\n",
+                name, producer_count, consumer_count, static_cast<float64>(total) / seconds / 1e6);
+}
+
+}  // namespace
+
+TEST_CASE("Single producer queue throughput.", "[.][benchmark][Queue]") {
+    constexpr uint64 per_producer = 1 << 20;
+
+    report_throughput<SpscQueue<uint64>>("SpscQueue", 1, 1, per_producer);
+    report_throughput<MutexQueue<uint64>>("MutexQueue", 1, 1, per_producer);
+}
+
+TEST_CASE("Multiple producers queue throughput.", "[.][benchmark][Queue]") {
+    constexpr uint64 per_producer = 1 << 20;
+
+    const uint32 producer_count = GENERATE(1u, 2u, 4u, 8u);
+    report_throughput<MpmcQueue<uint64>>("MpmcQueue", producer_count, producer_count, per_producer / producer_count);
+    report_throughput<MutexQueue<uint64>>("MutexQueue", producer_count, producer_count, per_producer / producer_count);
+}
@@ -0,0 +1,134 @@
+#include <catch2/catch_all.hpp>
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/defines.hpp"
+#include "licht/core/memory/intrusive_ref.hpp"
+#include "licht/core/memory/local_ref.hpp"
+#include "licht/core/memory/shared_ref.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+
+using namespace licht;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+float64 seconds_since(Clock::time_point begin) {
+    return std::chrono::duration<float64>(Clock::now() - begin).count();
+}
+
+/**
+ * @brief About the size of a message payload.
+ */
+struct Payload {
+    uint64 values[6] = {};
+};
+
+struct IntrusivePayload : IntrusiveRefCounted {
+    uint64 values[6] = {};
+};
+
+/**
+ * @brief Previous `new_ref`: the resource, then a separate counter.
+ */
+struct SeparateCounterRef {
+    using RefType = SharedRef<Payload>;
+
+    static RefType create() {
+        return RefType(lnew_args<Payload>(DefaultAllocator::get_instance()));
+    }
+};
+
+struct InlineCounterRef {
+    using RefType = SharedRef<Payload>;
+
+    static RefType create() {
+        return new_ref<Payload>();
+    }
+};
+
+/**
+ * @brief libstdc++ switches to plain counts while the process has a single thread, so its copies are not comparable.
+ */
+struct StdSharedRef {
+    using RefType = std::shared_ptr<Payload>;
+
+    static RefType create() {
+        return std::make_shared<Payload>();
+    }
+};
+
+struct IntrusiveCounterRef {
+    using RefType = IntrusiveRef<IntrusivePayload>;
+
+    static RefType create() {
+        return new_intrusive_ref<IntrusivePayload>();
+    }
+};
+
+struct LocalCounterRef {
+    using RefType = LocalRef<Payload>;
+
+    static RefType create() {
+        return new_local_ref<Payload>();
+    }
+};
+
+/**
+ * @brief Creates and destroys references, keeping a window of live ones like a queue of messages would.
+ */
+template <typename RefPolicy>
+float64 measure_create_destroy(uint32 count) {
+    constexpr uint32 window = 64;
+    Array<typename RefPolicy::RefType> refs;
+    refs.resize(window);
+
+    const Clock::time_point begin = Clock::now();
+    for (uint32 i = 0; i < count; i++) {
+        refs[i % window] = RefPolicy::create();
+        refs[i % window]->values[0] = i;
+    }
+    const float64 seconds = seconds_since(begin);
+
+    return count / seconds;
+}
+
+/**
+ * @brief Copies and drops references to a single live object.
+ */
+template <typename RefPolicy>
+float64 measure_copy(uint32 count) {
+    typename RefPolicy::RefType source = RefPolicy::create();
+    uint64 sum = 0;
+
+    const Clock::time_point begin = Clock::now();
+    for (uint32 i = 0; i < count; i++) {
+        typename RefPolicy::RefType copy = source;
+        sum += copy->values[0];
+    }
+    const float64 seconds = seconds_since(begin);
+
+    REQUIRE(sum == 0);
+    return count / seconds;
+}
+
+template <typename RefPolicy>
+void report(const char* name, uint32 count) {
+    std::printf("%-20s create/destroy: %8.2f Mops/s  copy: %8.2f Mops/s\n",
+                name, measure_create_destroy<RefPolicy>(count) / 1e6, measure_copy<RefPolicy>(count) / 1e6);
+}
+
+}  // namespace
+
+TEST_CASE("SharedRef create, copy and destroy throughput.", "[.][benchmark][SharedRef]") {
+    constexpr uint32 count = 1 << 22;
+
+    report<SeparateCounterRef>("SharedRef(raw)", count);
+    report<InlineCounterRef>("new_ref", count);
+    report<StdSharedRef>("std::make_shared", count);
+    report<IntrusiveCounterRef>("new_intrusive_ref", count);
+    report<LocalCounterRef>("new_local_ref", count);
+}
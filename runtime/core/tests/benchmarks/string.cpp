@@ -0,0 +1,122 @@
+#include <catch2/catch_all.hpp>
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/defines.hpp"
+#include "licht/core/memory/memory_trace.hpp"
+#include "licht/core/string/string.hpp"
+#include "licht/core/string/string_builder.hpp"
+#include "licht/core/string/string_ref.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+using namespace licht;
+
+namespace {
+
+/**
+ * Reference copy of the previous String, an Array of characters appended one at a time.
+ */
+class ArrayString {
+public:
+    ArrayString() {
+        buffer_.append('\0');
+    }
+
+    ArrayString(const char* c_str) {
+        append(c_str);
+    }
+
+    ArrayString& append(const char* str) {
+        size_t length = ::strlen(str);
+        if (buffer_.size() > 0) {
+            buffer_.pop();
+        }
+        for (size_t i = 0; i < length; i++) {
+            buffer_.append(str[i]);
+        }
+        buffer_.append('\0');
+        return *this;
+    }
+
+    size_t size() const {
+        return buffer_.size() - 1;
+    }
+
+private:
+    Array<char> buffer_;
+};
+
+/**
+ * Runs `operation` a fixed number of times and prints the average number of heap allocations per call.
+ */
+template <typename Operation>
+void report_allocations(const char* name, Operation&& operation) {
+    constexpr size_t iterations = 10'000;
+
+    const size_t allocations = MemoryTrace::global_get_allocation_count();
+    size_t sink = 0;
+    for (size_t i = 0; i < iterations; ++i) {
+        sink += operation();
+    }
+    const size_t delta = MemoryTrace::global_get_allocation_count() - allocations;
+
+    std::printf("%-40s %6.2f allocations/op\n", name, static_cast<float64>(delta) / iterations);
+    REQUIRE(sink > 0);
+}
+
+constexpr const char* projectdir = "/home/user/projects/licht/samples/ludo";
+
+}  // namespace
+
+TEST_CASE("String allocations per operation.", "[.][benchmark][String]") {
+    report_allocations("ArrayString short name", []() {
+        return ArrayString("channel.render").size();
+    });
+
+    report_allocations("String short name", []() {
+        return String("channel.render").size();
+    });
+
+    report_allocations("ArrayString path concatenation", []() {
+        ArrayString path(projectdir);
+        path.append("/assets/models/Sponza/glTF/Sponza.gltf");
+        return path.size();
+    });
+
+    report_allocations("String path concatenation", []() {
+        String path(projectdir);
+        path.append("/assets/models/Sponza/glTF/Sponza.gltf");
+        return path.size();
+    });
+
+    report_allocations("StringBuilder::concat path", []() {
+        return StringBuilder::concat(StringRef(projectdir), "/assets/models/", "Sponza", "/glTF/Sponza.gltf").size();
+    });
+}
+
+TEST_CASE("String append throughput.", "[.][benchmark][String]") {
+    BENCHMARK("ArrayString short name") {
+        return ArrayString("channel.render").size();
+    };
+
+    BENCHMARK("String short name") {
+        return String("channel.render").size();
+    };
+
+    BENCHMARK("ArrayString path concatenation") {
+        ArrayString path(projectdir);
+        path.append("/assets/models/Sponza/glTF/Sponza.gltf");
+        return path.size();
+    };
+
+    BENCHMARK("String path concatenation") {
+        String path(projectdir);
+        path.append("/assets/models/Sponza/glTF/Sponza.gltf");
+        return path.size();
+    };
+
+    BENCHMARK("StringBuilder::concat path") {
+        return StringBuilder::concat(StringRef(projectdir), "/assets/models/", "Sponza", "/glTF/Sponza.gltf").size();
+    };
+}
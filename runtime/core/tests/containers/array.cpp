@@ -1,6 +1,8 @@
 #include <catch2/catch_all.hpp>
 
 #include "licht/core/containers/array.hpp"
+#include "licht/core/memory/shared_ref.hpp"
+#include "licht/core/string/string.hpp"
 
 using namespace licht;
 
@@ -237,3 +239,80 @@ TEST_CASE("move_data and move assignment corner cases", "[Array::move]") {
     Array<int32> m = std::move(target);
     REQUIRE(m.size() == 3);
 }
+
+struct ArrayMoveOnlyTest {
+    static int32 copies;
+    static int32 moves;
+    int32 value;
+
+    ArrayMoveOnlyTest(int32 v = 0)
+        : value(v) {}
+
+    ArrayMoveOnlyTest(const ArrayMoveOnlyTest& o)
+        : value(o.value) { ++copies; }
+
+    ArrayMoveOnlyTest(ArrayMoveOnlyTest&& o) noexcept
+        : value(o.value) { ++moves; }
+};
+
+int32 ArrayMoveOnlyTest::copies = 0;
+int32 ArrayMoveOnlyTest::moves = 0;
+
+TEST_CASE("Growth moves elements instead of copying them", "[Array::relocate]") {
+    static_assert(CTriviallyRelocatable<int32>);
+    static_assert(CTriviallyRelocatable<Array<int32>>);
+    static_assert(CTriviallyRelocatable<String>);
+    static_assert(CTriviallyRelocatable<SharedRef<int32>>);
+    static_assert(!CTriviallyRelocatable<ArrayMoveOnlyTest>);
+
+    ArrayMoveOnlyTest::copies = 0;
+    ArrayMoveOnlyTest::moves = 0;
+
+    Array<ArrayMoveOnlyTest> array(NoAllocationOnConstructionPolicy{});
+    for (int32 i = 0; i < 100; ++i) {
+        array.push_back(ArrayMoveOnlyTest(i));
+    }
+    array.emplace_back(100);
+    array.append(ArrayMoveOnlyTest(101));
+    array.reserve(1000);
+
+    REQUIRE(ArrayMoveOnlyTest::copies == 0);
+    REQUIRE(ArrayMoveOnlyTest::moves > 0);
+    for (int32 i = 0; i < 102; ++i) {
+        REQUIRE(array[i].value == i);
+    }
+}
+
+TEST_CASE("Relocatable elements keep their resources across growth", "[Array::relocate]") {
+    SharedRef<int32> shared = new_ref<int32>(3);
+    {
+        Array<Array<SharedRef<int32>>> nested;
+        for (int32 i = 0; i < 64; ++i) {
+            Array<SharedRef<int32>>& inner = nested.emplace_back();
+            inner.append(shared);
+        }
+        REQUIRE(shared.get_shared_reference_count() == 65);
+
+        Array<String> names;
+        for (int32 i = 0; i < 64; ++i) {
+            names.append(String("name"));
+        }
+        REQUIRE(names[63] == "name");
+    }
+    REQUIRE(shared.is_unique());
+}
+
+TEST_CASE("Appending an element of the array itself while growing", "[Array::append]") {
+    Array<String> array = {"first"};
+    REQUIRE(array.capacity() == 1);
+
+    array.append(array[0]);
+    array.emplace_back(array[1]);
+    REQUIRE(array.size() == 3);
+    REQUIRE(array[2] == "first");
+
+    Array<int32> numbers = {1, 2};
+    int32& last = numbers.emplace_back(numbers[0] + numbers[1]);
+    REQUIRE(last == 3);
+    REQUIRE(numbers == Array<int32>{1, 2, 3});
+}
@@ -0,0 +1,158 @@
+#include <catch2/catch_all.hpp>
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/containers/bit_set.hpp"
+
+using namespace licht;
+
+TEST_CASE("BitSet - Set, reset, flip and test", "[BitSet]") {
+    BitSet<130> bits;
+    REQUIRE(bits.none());
+    REQUIRE(bits.size() == 130);
+
+    bits.set(0);
+    bits.set(64);
+    bits.set(129);
+    bits.flip(3);
+
+    REQUIRE(bits.test(0));
+    REQUIRE(bits[64]);
+    REQUIRE(bits.test(129));
+    REQUIRE(bits.test(3));
+    REQUIRE_FALSE(bits.test(1));
+    REQUIRE(bits.count() == 4);
+
+    bits.reset(64);
+    bits.flip(3);
+    REQUIRE(bits.count() == 2);
+
+    bits.set_all();
+    REQUIRE(bits.all());
+    REQUIRE(bits.count() == 130);
+
+    bits.reset_all();
+    REQUIRE(bits.none());
+}
+
+TEST_CASE("BitSet - Find and iterate set bits", "[BitSet]") {
+    BitSet<1000> bits;
+    REQUIRE(bits.find_first() == BitSet<1000>::npos);
+
+    const size_t indices[] = {5, 63, 64, 500, 999};
+    for (size_t index : indices) {
+        bits.set(index);
+    }
+
+    REQUIRE(bits.find_first() == 5);
+    REQUIRE(bits.find_next(6) == 63);
+    REQUIRE(bits.find_next(64) == 64);
+    REQUIRE(bits.find_next(65) == 500);
+    REQUIRE(bits.find_next(1000) == BitSet<1000>::npos);
+
+    Array<size_t> visited;
+    for (size_t index : bits.set_bits()) {
+        visited.append(index);
+    }
+    REQUIRE(visited == Array<size_t>({5, 63, 64, 500, 999}));
+
+    visited.clear();
+    bits.for_each_set([&](size_t index) { visited.append(index); });
+    REQUIRE(visited == Array<size_t>({5, 63, 64, 500, 999}));
+}
+
+TEST_CASE("BitSet - Word operations", "[BitSet]") {
+    BitSet<300> a;
+    BitSet<300> b;
+    for (size_t i = 0; i < 300; i += 2) {
+        a.set(i);
+    }
+    for (size_t i = 0; i < 300; i += 3) {
+        b.set(i);
+    }
+
+    BitSet<300> both = a;
+    both &= b;
+    for (size_t i = 0; i < 300; i++) {
+        REQUIRE(both.test(i) == (i % 6 == 0));
+    }
+
+    BitSet<300> either = a;
+    either |= b;
+    for (size_t i = 0; i < 300; i++) {
+        REQUIRE(either.test(i) == (i % 2 == 0 || i % 3 == 0));
+    }
+
+    BitSet<300> only_a = a;
+    only_a.and_not(b);
+    for (size_t i = 0; i < 300; i++) {
+        REQUIRE(only_a.test(i) == (i % 2 == 0 && i % 3 != 0));
+    }
+
+    REQUIRE(a != b);
+    REQUIRE(a == BitSet<300>(a));
+}
+
+TEST_CASE("DynamicBitSet - Resize keeps the bits and fills the new ones", "[DynamicBitSet]") {
+    DynamicBitSet bits(70);
+    REQUIRE(bits.size() == 70);
+    REQUIRE(bits.none());
+
+    bits.set(69);
+    bits.resize(200, true);
+    REQUIRE(bits.test(69));
+    REQUIRE_FALSE(bits.test(68));
+    REQUIRE(bits.count() == 1 + 130);
+
+    bits.resize(65);
+    REQUIRE(bits.count() == 0);
+    REQUIRE(bits.find_first() == DynamicBitSet::npos);
+
+    bits.set_all();
+    REQUIRE(bits.all());
+    REQUIRE(bits.count() == 65);
+}
+
+TEST_CASE("DynamicBitSet - Sparse scan across empty words", "[DynamicBitSet]") {
+    DynamicBitSet bits(1 << 16);
+    const size_t indices[] = {0, 1000, 1001, 40000, 65535};
+    for (size_t index : indices) {
+        bits.set(index);
+    }
+
+    Array<size_t> visited;
+    for (size_t index : bits.set_bits()) {
+        visited.append(index);
+    }
+    REQUIRE(visited == Array<size_t>({0, 1000, 1001, 40000, 65535}));
+
+    visited.clear();
+    bits.for_each_set([&](size_t index) { visited.append(index); });
+    REQUIRE(visited == Array<size_t>({0, 1000, 1001, 40000, 65535}));
+
+    REQUIRE(bits.find_next(1002) == 40000);
+    REQUIRE(bits.count() == 5);
+}
+
+TEST_CASE("DynamicBitSet - Word operations", "[DynamicBitSet]") {
+    DynamicBitSet a(1031);
+    DynamicBitSet b(1031);
+    for (size_t i = 0; i < 1031; i += 5) {
+        a.set(i);
+    }
+    for (size_t i = 0; i < 1031; i += 7) {
+        b.set(i);
+    }
+
+    DynamicBitSet both = a;
+    both &= b;
+    DynamicBitSet either = a;
+    either |= b;
+    DynamicBitSet only_a = a;
+    only_a.and_not(b);
+
+    for (size_t i = 0; i < 1031; i++) {
+        REQUIRE(both.test(i) == (i % 35 == 0));
+        REQUIRE(either.test(i) == (i % 5 == 0 || i % 7 == 0));
+        REQUIRE(only_a.test(i) == (i % 5 == 0 && i % 7 != 0));
+    }
+}
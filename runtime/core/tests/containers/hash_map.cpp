@@ -2,7 +2,9 @@
 
 #include "licht/core/containers/hash_map.hpp"
 #include "licht/core/defines.hpp"
+#include "licht/core/memory/shared_ref.hpp"
 #include "licht/core/string/string.hpp"
+#include "licht/core/string/string_ref.hpp"
 
 using namespace licht;
 
@@ -221,3 +223,87 @@ TEST_CASE("Overwrite value and repeated puts.", "[HashMap::put_overwrite]") {
     REQUIRE(map.get(42) == 3);
     REQUIRE(map.size() == 1);
 }
+
+TEST_CASE("Remove then reinsert reuses deleted slots.", "[HashMap::remove]") {
+    HashMap<uint32, uint32> map;
+    const uint32 N = 1000;
+
+    for (uint32 round = 0; round < 4; ++round) {
+        for (uint32 i = 0; i < N; ++i) {
+            map.put(i, i + round);
+        }
+        REQUIRE(map.size() == N);
+
+        for (uint32 i = 0; i < N; i += 2) {
+            map.remove(i);
+        }
+        REQUIRE(map.size() == N / 2);
+
+        for (uint32 i = 0; i < N; ++i) {
+            REQUIRE(map.contains(i) == (i % 2 == 1));
+        }
+    }
+
+    size_t capacity = map.capacity();
+    map.rehash();
+    REQUIRE(map.capacity() <= capacity);
+    REQUIRE(map.size() == N / 2);
+    REQUIRE(map.get(999) == 999 + 3);
+}
+
+TEST_CASE("Non-trivial entries are destroyed on remove and clear.", "[HashMap::lifetime]") {
+    SharedRef<uint32> shared = new_ref<uint32>(7);
+    {
+        HashMap<uint32, SharedRef<uint32>> map;
+        for (uint32 i = 0; i < 64; ++i) {
+            map.put(i, shared);
+        }
+        REQUIRE(shared.get_shared_reference_count() == 65);
+
+        map.remove(3);
+        REQUIRE(shared.get_shared_reference_count() == 64);
+
+        HashMap<uint32, SharedRef<uint32>> copy(map);
+        REQUIRE(shared.get_shared_reference_count() == 64 + 63);
+
+        map.clear();
+        REQUIRE(shared.get_shared_reference_count() == 64);
+    }
+    REQUIRE(shared.is_unique());
+}
+
+TEST_CASE("Find returns end for missing keys and iterates to the entry.", "[HashMap::find]") {
+    HashMap<String, uint32> map;
+    map.put("alpha", 1);
+    map.put("beta", 2);
+
+    REQUIRE(map.find("gamma") == map.end());
+
+    auto it = map.find("beta");
+    REQUIRE(it != map.end());
+    REQUIRE(it->value == 2);
+
+    map.reserve(1000);
+    REQUIRE(map.capacity() >= 1000);
+    REQUIRE(map.get("alpha") == 1);
+}
+
+TEST_CASE("String keys can be looked up without building a String.", "[HashMap::transparent]") {
+    HashMap<String, uint32> map;
+    map.put("alpha", 1);
+    map.put("beta", 2);
+
+    REQUIRE(Hasher::hash(String("alpha")) == Hasher::hash(StringRef("alpha")));
+    REQUIRE(Hasher::hash(String("alpha")) == Hasher::hash("alpha"));
+
+    StringRef beta = "beta";
+    REQUIRE(map.contains(beta));
+    REQUIRE(map.get(beta) == 2);
+    REQUIRE(*map.get_ptr("alpha") == 1);
+    REQUIRE(map.get_ptr(StringRef("gamma")) == nullptr);
+    REQUIRE(map.find(beta) != map.end());
+
+    map.remove(beta);
+    REQUIRE_FALSE(map.contains("beta"));
+    REQUIRE(map.size() == 1);
+}
@@ -4,6 +4,7 @@
 #include "catch2/catch_test_macros.hpp"
 #include "licht/core/defines.hpp"
 #include "licht/core/string/string.hpp"
+#include "licht/core/string/string_ref.hpp"
 #include "licht/core/string/format.hpp"
 #include "licht/core/trace/trace.hpp"
 
@@ -72,6 +73,17 @@ TEST_CASE("HashSet - Containment and Lookup", "[HashSet][Contains][Find]") {
         REQUIRE_FALSE(empty_set.contains(1));
         REQUIRE(empty_set.find(1) == empty_set.end());
     }
+
+    SECTION("StringRef Key") {
+        StringRef apple = "apple";
+        REQUIRE(set.contains(apple));
+        REQUIRE(set.find(apple) != set.end());
+        REQUIRE_FALSE(set.contains(StringRef("strawberry")));
+
+        set.remove(apple);
+        REQUIRE_FALSE(set.contains("apple"));
+        REQUIRE(set.size() == 2);
+    }
 }
 
 TEST_CASE("HashSet - Removal", "[HashSet][Remove]") {
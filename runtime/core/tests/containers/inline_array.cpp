@@ -0,0 +1,156 @@
+#include <catch2/catch_all.hpp>
+
+#include "licht/core/containers/array_view.hpp"
+#include "licht/core/containers/inline_array.hpp"
+#include "licht/core/memory/heap_allocator.hpp"
+#include "licht/core/memory/shared_ref.hpp"
+#include "licht/core/string/string.hpp"
+
+using namespace licht;
+
+namespace {
+
+class CountingHeapAllocator : public HeapAllocator {
+public:
+    static int32 allocations;
+
+    virtual void* allocate(size_t size, size_t alignment) override {
+        ++allocations;
+        return HeapAllocator::allocate(size, alignment);
+    }
+};
+
+int32 CountingHeapAllocator::allocations = 0;
+
+template <typename ElementType, size_t InlineCapacity>
+using CountingInlineArray = InlineArray<ElementType, InlineCapacity, TypedAllocator<ElementType, CountingHeapAllocator>>;
+
+}  // namespace
+
+TEST_CASE("Elements up to the inline capacity never touch the heap.", "[InlineArray]") {
+    CountingHeapAllocator::allocations = 0;
+
+    CountingInlineArray<int32, 4> array;
+    REQUIRE(array.empty());
+    REQUIRE(array.capacity() == 4);
+
+    array.append(1);
+    array.emplace(2);
+    array.push_back(3);
+    array.append(4);
+    REQUIRE(array.is_inline());
+    REQUIRE(CountingHeapAllocator::allocations == 0);
+
+    CountingInlineArray<int32, 4> copy(array);
+    CountingInlineArray<int32, 4> moved(std::move(copy));
+    REQUIRE(moved == array);
+    REQUIRE(copy.empty());
+    REQUIRE(CountingHeapAllocator::allocations == 0);
+
+    array.append(5);
+    REQUIRE_FALSE(array.is_inline());
+    REQUIRE(array.capacity() == 8);
+    REQUIRE(CountingHeapAllocator::allocations == 1);
+
+    for (int32 i = 0; i < 5; ++i) {
+        REQUIRE(array[i] == i + 1);
+    }
+
+    array.pop();
+    array.shrink();
+    REQUIRE(array.is_inline());
+    REQUIRE(array.size() == 4);
+    REQUIRE(array.back() == 4);
+}
+
+TEST_CASE("Moving a spilled array takes its heap block.", "[InlineArray]") {
+    InlineArray<int32, 2> array = {1, 2, 3};
+    REQUIRE_FALSE(array.is_inline());
+
+    const int32* data = array.data();
+    InlineArray<int32, 2> moved(std::move(array));
+    REQUIRE(moved.data() == data);
+    REQUIRE(array.is_inline());
+    REQUIRE(array.empty());
+
+    array = std::move(moved);
+    REQUIRE(array.data() == data);
+    REQUIRE(array.size() == 3);
+
+    moved = array;
+    REQUIRE(moved == array);
+    REQUIRE(moved.data() != data);
+}
+
+TEST_CASE("Non-trivial elements are constructed and destroyed once.", "[InlineArray]") {
+    SharedRef<uint32> shared = new_ref<uint32>(1);
+    {
+        InlineArray<SharedRef<uint32>, 2> array;
+        array.append(shared);
+        array.append(shared);
+        REQUIRE(shared.get_shared_reference_count() == 3);
+
+        array.append(array[0]);
+        REQUIRE(shared.get_shared_reference_count() == 4);
+
+        InlineArray<SharedRef<uint32>, 2> copy = array;
+        REQUIRE(shared.get_shared_reference_count() == 7);
+
+        copy.remove_if([](const SharedRef<uint32>&) { return true; });
+        REQUIRE(copy.empty());
+        REQUIRE(shared.get_shared_reference_count() == 4);
+
+        array.resize(1);
+        REQUIRE(shared.get_shared_reference_count() == 2);
+    }
+    REQUIRE(shared.is_unique());
+}
+
+TEST_CASE("Inline arrays are viewed like arrays.", "[InlineArray]") {
+    InlineArray<String, 2> array = {"vertex", "index"};
+    REQUIRE(array.contains("index"));
+
+    ArrayView<String> view = array;
+    REQUIRE(view.size() == 2);
+    REQUIRE(view[0] == "vertex");
+
+    Array<size_t> sizes = array.map<size_t>([](const String& name) { return name.size(); });
+    REQUIRE(sizes == Array<size_t>{6, 5});
+}
+
+TEST_CASE("Emplacing an element of the array itself while it grows.", "[InlineArray]") {
+    InlineArray<String, 2> array = {"a long enough string to live on the heap", "second"};
+
+    String& first = array.emplace_back(array[0]);
+    REQUIRE(&first == &array[2]);
+    REQUIRE(array[2] == "a long enough string to live on the heap");
+
+    array.emplace(array[1]);
+    array.append(String("moved"));
+    REQUIRE(array.size() == 5);
+    REQUIRE(array[3] == "second");
+    REQUIRE(array[4] == "moved");
+}
+
+TEST_CASE("Swapping inline and spilled arrays.", "[InlineArray]") {
+    InlineArray<String, 2> small = {"one"};
+    InlineArray<String, 2> large = {"a", "b", "c"};
+    REQUIRE(small.is_inline());
+    REQUIRE_FALSE(large.is_inline());
+
+    small.swap(large);
+    REQUIRE(small == InlineArray<String, 2>{"a", "b", "c"});
+    REQUIRE(large == InlineArray<String, 2>{"one"});
+
+    InlineArray<String, 2> other_large = {"x", "y", "z", "w"};
+    const String* heap_data = other_large.data();
+    swap(small, other_large);
+    REQUIRE(small.data() == heap_data);
+    REQUIRE(small.size() == 4);
+    REQUIRE(other_large.size() == 3);
+
+    InlineArray<String, 2> other_small = {"two"};
+    swap(large, other_small);
+    REQUIRE(large[0] == "two");
+    REQUIRE(other_small[0] == "one");
+}
@@ -0,0 +1,98 @@
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <thread>
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/containers/mpmc_queue.hpp"
+#include "licht/core/string/string.hpp"
+
+using namespace licht;
+
+TEST_CASE("MpmcQueue - Push and pop in order", "[MpmcQueue]") {
+    MpmcQueue<int32> queue(4);
+    REQUIRE(queue.capacity() == 4);
+
+    for (int32 i = 0; i < 4; i++) {
+        REQUIRE(queue.try_push(i));
+    }
+    REQUIRE_FALSE(queue.try_push(4));
+
+    int32 value = -1;
+    for (int32 i = 0; i < 4; i++) {
+        REQUIRE(queue.try_pop(value));
+        REQUIRE(value == i);
+    }
+    REQUIRE_FALSE(queue.try_pop(value));
+
+    // Second lap over the same cells.
+    int32 input[3] = {7, 8, 9};
+    int32 output[4] = {};
+    REQUIRE(queue.try_push_batch(input, 3) == 3);
+    REQUIRE(queue.try_pop_batch(output, 4) == 3);
+    REQUIRE(output[0] == 7);
+    REQUIRE(output[2] == 9);
+}
+
+TEST_CASE("MpmcQueue - Destroys the elements left", "[MpmcQueue]") {
+    MpmcQueue<String> queue(4);
+    queue.push(String("a string too long for the inline buffer"));
+    queue.push(String("another string too long for the inline buffer"));
+
+    REQUIRE(queue.pop() == "a string too long for the inline buffer");
+}
+
+TEST_CASE("MpmcQueue - Stress with several producers and consumers", "[MpmcQueue][stress]") {
+    constexpr uint64 producer_count = 4;
+    constexpr uint64 consumer_count = 4;
+    constexpr uint64 per_producer = 50000;
+
+    MpmcQueue<uint64> queue(128);
+    std::atomic<uint64> consumed_count = 0;
+    std::atomic<uint64> consumed_sum = 0;
+
+    // Each value is pushed exactly once, so every slot of `seen` must end up at 1.
+    Array<std::atomic<uint8>> seen(producer_count * per_producer);
+    for (uint64 i = 0; i < producer_count * per_producer; i++) {
+        seen.emplace_back(0);
+    }
+
+    Array<std::thread> threads;
+    for (uint64 p = 0; p < producer_count; p++) {
+        threads.append(std::thread([&, p]() {
+            for (uint64 i = 0; i < per_producer; i++) {
+                queue.push(p * per_producer + i);
+            }
+        }));
+    }
+
+    for (uint64 c = 0; c < consumer_count; c++) {
+        threads.append(std::thread([&]() {
+            uint64 value;
+            while (consumed_count.load(std::memory_order_relaxed) < producer_count * per_producer) {
+                if (queue.try_pop(value)) {
+                    seen[value].fetch_add(1, std::memory_order_relaxed);
+                    consumed_sum.fetch_add(value, std::memory_order_relaxed);
+                    consumed_count.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }));
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    const uint64 total = producer_count * per_producer;
+    REQUIRE(consumed_count.load() == total);
+    REQUIRE(consumed_sum.load() == total * (total - 1) / 2);
+
+    bool all_seen_once = true;
+    for (uint64 i = 0; i < total; i++) {
+        all_seen_once &= seen[i].load() == 1;
+    }
+    REQUIRE(all_seen_once);
+    REQUIRE(queue.empty_approx());
+}
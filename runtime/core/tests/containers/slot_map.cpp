@@ -0,0 +1,121 @@
+#include <catch2/catch_all.hpp>
+
+#include "licht/core/containers/hash_set.hpp"
+#include "licht/core/containers/slot_map.hpp"
+#include "licht/core/string/string.hpp"
+
+using namespace licht;
+
+TEST_CASE("SlotMap - Insert and get", "[SlotMap]") {
+    SlotMap<String> map;
+    REQUIRE(map.empty());
+
+    SlotHandle a = map.insert("albedo");
+    SlotHandle b = map.emplace("normal");
+
+    REQUIRE(map.size() == 2);
+    REQUIRE(map.contains(a));
+    REQUIRE(map[a] == "albedo");
+    REQUIRE(*map.get(b) == "normal");
+    REQUIRE(a != b);
+}
+
+TEST_CASE("SlotMap - Null handle", "[SlotMap]") {
+    SlotMap<int32> map;
+    map.insert(1);
+
+    SlotHandle null;
+    REQUIRE(null.is_null());
+    REQUIRE_FALSE(map.contains(null));
+    REQUIRE(map.get(null) == nullptr);
+    REQUIRE_FALSE(map.remove(null));
+}
+
+TEST_CASE("SlotMap - Handles survive removals of other elements", "[SlotMap]") {
+    SlotMap<int32> map;
+    SlotHandle handles[8];
+    for (int32 i = 0; i < 8; i++) {
+        handles[i] = map.insert(i * 10);
+    }
+
+    REQUIRE(map.remove(handles[0]));
+    REQUIRE(map.remove(handles[3]));
+
+    REQUIRE(map.size() == 6);
+    for (int32 i = 0; i < 8; i++) {
+        if (i == 0 || i == 3) {
+            REQUIRE(map.get(handles[i]) == nullptr);
+        } else {
+            REQUIRE(map[handles[i]] == i * 10);
+        }
+    }
+}
+
+TEST_CASE("SlotMap - Stale handles are rejected after slot reuse", "[SlotMap]") {
+    SlotMap<int32> map;
+    SlotHandle old_handle = map.insert(1);
+    REQUIRE(map.remove(old_handle));
+    REQUIRE_FALSE(map.remove(old_handle));
+
+    SlotHandle new_handle = map.insert(2);
+    REQUIRE(new_handle.index == old_handle.index);
+    REQUIRE(new_handle.generation != old_handle.generation);
+
+    REQUIRE_FALSE(map.contains(old_handle));
+    REQUIRE(map.get(old_handle) == nullptr);
+    REQUIRE(map[new_handle] == 2);
+}
+
+TEST_CASE("SlotMap - Iteration covers the live elements only", "[SlotMap]") {
+    SlotMap<int32> map;
+    Array<SlotHandle> handles;
+    for (int32 i = 0; i < 100; i++) {
+        handles.append(map.insert(i));
+    }
+    for (int32 i = 0; i < 100; i += 2) {
+        map.remove(handles[i]);
+    }
+
+    int32 sum = 0;
+    for (int32 value : map) {
+        REQUIRE(value % 2 == 1);
+        sum += value;
+    }
+    REQUIRE(sum == 2500);
+
+    map.for_each([&](SlotHandle handle, int32& value) {
+        REQUIRE(map.get(handle) == &value);
+    });
+
+    for (size_t i = 0; i < map.size(); i++) {
+        REQUIRE(map[map.handle_at(i)] == map.elements()[i]);
+    }
+}
+
+TEST_CASE("SlotMap - Clear invalidates every handle", "[SlotMap]") {
+    SlotMap<String> map;
+    SlotHandle a = map.insert("a");
+    SlotHandle b = map.insert("b");
+
+    map.clear();
+    REQUIRE(map.empty());
+    REQUIRE_FALSE(map.contains(a));
+    REQUIRE_FALSE(map.contains(b));
+
+    SlotHandle c = map.insert("c");
+    REQUIRE(map.contains(c));
+    REQUIRE_FALSE(map.contains(a));
+    REQUIRE_FALSE(map.contains(b));
+}
+
+TEST_CASE("SlotMap - Handles pack to 64 bits and hash", "[SlotMap]") {
+    SlotMap<int32> map;
+    SlotHandle handle = map.insert(7);
+
+    REQUIRE(SlotHandle::from_bits(handle.to_bits()) == handle);
+
+    HashSet<SlotHandle> set;
+    set.add(handle);
+    REQUIRE(set.contains(handle));
+    REQUIRE_FALSE(set.contains(SlotHandle{}));
+}
@@ -133,7 +133,7 @@ TEST_CASE("Destruction and lifecycle tracking.", "[SparseSet::destruction]") {
 }
 
 TEST_CASE("Paged indexing and large sparse indices.", "[SparseSet::paging]") {
-    SparseSet<int32, uint32> set(8);
+    SparseSet<int32, uint32, uint32, 8> set;
 
     set.put(0, 10);
     set.put(15, 150);   
@@ -163,3 +163,44 @@ TEST_CASE("Clear resets all sparse pages and dense data.", "[SparseSet::clear]")
     REQUIRE(set.empty());
     REQUIRE_FALSE(set.contains(10));
 }
+
+TEST_CASE("Untouched pages and 32-bit dense indices.", "[SparseSet::paging]") {
+    SparseSet<int32, uint64, uint32, 16> set;
+    STATIC_REQUIRE(sizeof(decltype(set)::dense_index_type) == 4);
+
+    set.put(1000, 1);
+    set.put(3, 2);
+
+    // Keys in pages never written to, or past the last page, are simply absent.
+    REQUIRE_FALSE(set.contains(500));
+    REQUIRE_FALSE(set.contains(1 << 20));
+    REQUIRE(set.get(17) == nullptr);
+
+    REQUIRE(set[1000] == 1);
+    REQUIRE(set[3] == 2);
+
+    // The last element takes the place of the removed one.
+    set.remove(1000);
+    REQUIRE_FALSE(set.contains(1000));
+    REQUIRE(set.dense_at(0) == 3);
+}
+
+TEST_CASE("Copy and move keep the pages.", "[SparseSet::paging]") {
+    SparseSet<String, uint32, uint32, 8> set;
+    for (uint32 i = 0; i < 40; i += 3) {
+        set.put(i, "value");
+    }
+
+    SparseSet<String, uint32, uint32, 8> copy(set);
+    set.remove(9);
+    REQUIRE(copy.contains(9));
+    REQUIRE_FALSE(set.contains(9));
+
+    SparseSet<String, uint32, uint32, 8> moved(std::move(copy));
+    REQUIRE(moved.size() == 14);
+    REQUIRE(*moved.get(39) == "value");
+
+    set = moved;
+    REQUIRE(set.contains(9));
+    REQUIRE(set.size() == 14);
+}
@@ -0,0 +1,99 @@
+#include <catch2/catch_all.hpp>
+
+#include <thread>
+
+#include "licht/core/containers/spsc_queue.hpp"
+#include "licht/core/string/string.hpp"
+
+using namespace licht;
+
+TEST_CASE("SpscQueue - Push and pop in order", "[SpscQueue]") {
+    SpscQueue<int32> queue(5);
+    REQUIRE(queue.capacity() == 8);
+    REQUIRE(queue.empty_approx());
+
+    for (int32 i = 0; i < 8; i++) {
+        REQUIRE(queue.try_push(i));
+    }
+    REQUIRE_FALSE(queue.try_push(8));
+    REQUIRE(queue.size_approx() == 8);
+
+    int32 value = -1;
+    for (int32 i = 0; i < 8; i++) {
+        REQUIRE(queue.try_pop(value));
+        REQUIRE(value == i);
+    }
+    REQUIRE_FALSE(queue.try_pop(value));
+}
+
+TEST_CASE("SpscQueue - Batches wrap around the ring", "[SpscQueue]") {
+    SpscQueue<int32> queue(8);
+    int32 input[6] = {0, 1, 2, 3, 4, 5};
+    int32 output[8] = {};
+
+    REQUIRE(queue.try_push_batch(input, 6) == 6);
+    REQUIRE(queue.try_pop_batch(output, 4) == 4);
+    REQUIRE(output[3] == 3);
+
+    // Only 6 slots are free, the batch is cut.
+    REQUIRE(queue.try_push_batch(input, 6) == 6);
+    REQUIRE(queue.try_push_batch(input, 6) == 0);
+
+    REQUIRE(queue.try_pop_batch(output, 8) == 8);
+    const int32 expected[8] = {4, 5, 0, 1, 2, 3, 4, 5};
+    for (int32 i = 0; i < 8; i++) {
+        REQUIRE(output[i] == expected[i]);
+    }
+}
+
+TEST_CASE("SpscQueue - Destroys the elements left", "[SpscQueue]") {
+    SpscQueue<String> queue(4);
+    queue.push(String("a string too long for the inline buffer"));
+    queue.push(String("another string too long for the inline buffer"));
+
+    REQUIRE(queue.pop() == "a string too long for the inline buffer");
+}
+
+TEST_CASE("SpscQueue - Stress between two threads", "[SpscQueue][stress]") {
+    constexpr uint64 count = 200000;
+    SpscQueue<uint64> queue(64);
+
+    std::thread producer([&]() {
+        uint64 batch[16];
+        uint64 next = 0;
+        while (next < count) {
+            if (next % 3 == 0) {
+                queue.push(next++);
+                continue;
+            }
+            const uint64 batch_size = count - next < 16 ? count - next : 16;
+            for (uint64 i = 0; i < batch_size; i++) {
+                batch[i] = next + i;
+            }
+            const uint64 pushed = queue.try_push_batch(batch, batch_size);
+            if (pushed == 0) {
+                std::this_thread::yield();
+            }
+            next += pushed;
+        }
+    });
+
+    uint64 expected = 0;
+    uint64 sum = 0;
+    uint64 batch[16];
+    while (expected < count) {
+        const size_t popped = queue.try_pop_batch(batch, 16);
+        if (popped == 0) {
+            std::this_thread::yield();
+        }
+        for (size_t i = 0; i < popped; i++) {
+            REQUIRE(batch[i] == expected);
+            sum += batch[i];
+            expected++;
+        }
+    }
+
+    producer.join();
+    REQUIRE(sum == count * (count - 1) / 2);
+    REQUIRE(queue.empty_approx());
+}
@@ -0,0 +1,90 @@
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <thread>
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/containers/work_stealing_deque.hpp"
+
+using namespace licht;
+
+TEST_CASE("WorkStealingDeque - Owner pops LIFO, thieves steal FIFO", "[WorkStealingDeque]") {
+    WorkStealingDeque<uint32> deque(4);
+
+    for (uint32 i = 0; i < 10; i++) {
+        deque.push(i);
+    }
+    REQUIRE(deque.size_approx() == 10);
+    REQUIRE(deque.capacity() == 16);
+
+    uint32 value = 0;
+    REQUIRE(deque.try_steal(value));
+    REQUIRE(value == 0);
+    REQUIRE(deque.try_pop(value));
+    REQUIRE(value == 9);
+
+    uint32 popped = 0;
+    while (deque.try_pop(value)) {
+        popped++;
+    }
+    REQUIRE(popped == 8);
+    REQUIRE(deque.empty_approx());
+    REQUIRE_FALSE(deque.try_steal(value));
+}
+
+TEST_CASE("WorkStealingDeque - Stress with thieves", "[WorkStealingDeque][stress]") {
+    constexpr uint32 thief_count = 3;
+    constexpr uint32 total = 200000;
+
+    WorkStealingDeque<uint32> deque(64);
+    Array<std::atomic<uint8>> seen(total);
+    for (uint32 i = 0; i < total; i++) {
+        seen.emplace_back(0);
+    }
+
+    std::atomic<uint32> taken_count = 0;
+    std::atomic<bool> done = false;
+
+    Array<std::thread> thieves;
+    for (uint32 t = 0; t < thief_count; t++) {
+        thieves.append(std::thread([&]() {
+            uint32 value;
+            while (!done.load(std::memory_order_acquire)) {
+                if (deque.try_steal(value)) {
+                    seen[value].fetch_add(1, std::memory_order_relaxed);
+                    taken_count.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }));
+    }
+
+    // The owner pushes in bursts, growing the ring, and pops part of its own work back.
+    uint32 value;
+    for (uint32 i = 0; i < total; i++) {
+        deque.push(i);
+        if (i % 3 == 0 && deque.try_pop(value)) {
+            seen[value].fetch_add(1, std::memory_order_relaxed);
+            taken_count.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    while (deque.try_pop(value)) {
+        seen[value].fetch_add(1, std::memory_order_relaxed);
+        taken_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    while (taken_count.load() < total) {
+        std::this_thread::yield();
+    }
+    done.store(true, std::memory_order_release);
+    for (std::thread& thief : thieves) {
+        thief.join();
+    }
+
+    bool all_taken_once = true;
+    for (uint32 i = 0; i < total; i++) {
+        all_taken_once &= seen[i].load() == 1;
+    }
+    REQUIRE(all_taken_once);
+}
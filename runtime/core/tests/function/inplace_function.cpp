@@ -0,0 +1,131 @@
+#include <catch2/catch_all.hpp>
+
+#include "licht/core/defines.hpp"
+#include "licht/core/function/inplace_function.hpp"
+#include "licht/core/function/unique_function.hpp"
+#include "licht/core/memory/shared_ref.hpp"
+
+using namespace licht;
+
+namespace {
+
+int32 subtract(int32 a, int32 b) {
+    return a - b;
+}
+
+struct Counter {
+    int32 value = 0;
+
+    int32 increment(int32 step) {
+        return value += step;
+    }
+};
+
+/**
+ * @brief Move-only capture, counting its destructions.
+ */
+struct MoveOnlyTracker {
+    int32* destroyed;
+
+    explicit MoveOnlyTracker(int32* destroyed)
+        : destroyed(destroyed) {}
+
+    MoveOnlyTracker(MoveOnlyTracker&& other) noexcept
+        : destroyed(std::exchange(other.destroyed, nullptr)) {}
+
+    MoveOnlyTracker(const MoveOnlyTracker&) = delete;
+
+    ~MoveOnlyTracker() {
+        if (destroyed) {
+            (*destroyed)++;
+        }
+    }
+};
+
+}  // namespace
+
+TEST_CASE("InplaceFunction - Calls lambdas, function pointers and member functions", "[InplaceFunction]") {
+    InplaceFunction<int32(int32, int32)> empty;
+    REQUIRE_FALSE(empty);
+
+    int32 offset = 10;
+    InplaceFunction<int32(int32, int32)> lambda = [offset](int32 a, int32 b) { return a + b + offset; };
+    REQUIRE(lambda);
+    REQUIRE(lambda(1, 2) == 13);
+
+    InplaceFunction<int32(int32, int32)> pointer = &subtract;
+    REQUIRE(pointer(5, 3) == 2);
+
+    int32 (*null_pointer)(int32, int32) = nullptr;
+    InplaceFunction<int32(int32, int32)> from_null = null_pointer;
+    REQUIRE_FALSE(from_null);
+
+    Counter counter;
+    InplaceFunction<int32(Counter&, int32)> method = &Counter::increment;
+    REQUIRE(method(counter, 4) == 4);
+    REQUIRE(counter.value == 4);
+
+    // Return values of the callable are dropped by void signatures.
+    InplaceFunction<void(int32, int32)> discard = &subtract;
+    discard(1, 1);
+}
+
+TEST_CASE("InplaceFunction - Moves callables and destroys them once", "[InplaceFunction]") {
+    int32 destroyed = 0;
+    {
+        InplaceFunction<int32()> function = [tracker = MoveOnlyTracker(&destroyed)]() { return 7; };
+        STATIC_REQUIRE(InplaceFunction<int32()>::is_stored_inline<MoveOnlyTracker>());
+
+        InplaceFunction<int32()> moved = std::move(function);
+        REQUIRE_FALSE(function);
+        REQUIRE(moved() == 7);
+        REQUIRE(destroyed == 0);
+
+        function = std::move(moved);
+        REQUIRE(function() == 7);
+
+        moved = [tracker = MoveOnlyTracker(&destroyed)]() { return 8; };
+        moved = nullptr;
+        REQUIRE(destroyed == 1);
+    }
+    REQUIRE(destroyed == 2);
+}
+
+TEST_CASE("InplaceFunction - Capacity bounds the captures", "[InplaceFunction]") {
+    struct Large {
+        uint8 bytes[64] = {};
+    };
+
+    STATIC_REQUIRE(InplaceFunction<void()>::is_stored_inline<void (*)()>());
+    STATIC_REQUIRE_FALSE(InplaceFunction<void()>::is_stored_inline<Large>());
+    STATIC_REQUIRE(InplaceFunction<void(), 64>::is_stored_inline<Large>());
+
+    Large large;
+    large.bytes[63] = 5;
+    InplaceFunction<uint8(), 64> function = [large]() { return large.bytes[63]; };
+    REQUIRE(function() == 5);
+}
+
+TEST_CASE("UniqueFunction - Stores large and move-only captures on the heap", "[UniqueFunction]") {
+    int32 destroyed = 0;
+    {
+        uint64 values[16] = {};
+        values[15] = 42;
+
+        UniqueFunction<uint64()> large = [values, tracker = MoveOnlyTracker(&destroyed)]() { return values[15]; };
+        REQUIRE(large() == 42);
+
+        UniqueFunction<uint64()> moved = std::move(large);
+        REQUIRE_FALSE(large);
+        REQUIRE(moved() == 42);
+        REQUIRE(destroyed == 0);
+
+        SharedRef<uint32> shared = new_ref<uint32>(3u);
+        UniqueFunction<uint32()> small = [shared]() { return *shared; };
+        REQUIRE(small() == 3);
+        REQUIRE(shared.get_shared_reference_count() == 2);
+        small.reset();
+        REQUIRE(shared.is_unique());
+    }
+    REQUIRE(destroyed == 1);
+}
@@ -0,0 +1,96 @@
+#include <catch2/catch_all.hpp>
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/containers/hash_set.hpp"
+#include "licht/core/defines.hpp"
+#include "licht/core/hash/hash_stream.hpp"
+#include "licht/core/hash/hasher.hpp"
+#include "licht/core/string/string.hpp"
+#include "licht/core/string/string_ref.hpp"
+
+using namespace licht;
+
+namespace {
+
+Array<uint8> make_bytes(size_t count) {
+    Array<uint8> bytes(count);
+    uint64 state = 0x9E3779B97F4A7C15ULL;
+    for (size_t i = 0; i < count; ++i) {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        bytes.append(static_cast<uint8>(state >> 56));
+    }
+    return bytes;
+}
+
+}  // namespace
+
+TEST_CASE("Hashing bytes is deterministic and seeded.", "[Hasher::hash_bytes]") {
+    Array<uint8> bytes = make_bytes(256);
+
+    for (size_t size = 0; size <= bytes.size(); ++size) {
+        REQUIRE(Hasher::hash_bytes(bytes.data(), size) == Hasher::hash_bytes(bytes.data(), size));
+        REQUIRE(Hasher::hash_bytes(bytes.data(), size, 1) != Hasher::hash_bytes(bytes.data(), size, 2));
+    }
+
+    REQUIRE(Hasher::hash(String("licht")) == Hasher::hash(StringRef("licht")));
+    REQUIRE(Hasher::hash("licht") == Hasher::hash_bytes("licht", 5));
+}
+
+TEST_CASE("Every prefix and single-bit change gives a distinct hash.", "[Hasher::hash_bytes]") {
+    Array<uint8> bytes = make_bytes(512);
+    HashSet<uint64> hashes;
+
+    for (size_t size = 0; size <= bytes.size(); ++size) {
+        hashes.insert(Hasher::hash_bytes(bytes.data(), size));
+    }
+    REQUIRE(hashes.size() == bytes.size() + 1);
+
+    hashes.clear();
+    Array<uint8> flipped = make_bytes(64);
+    for (size_t bit = 0; bit < flipped.size() * 8; ++bit) {
+        flipped[bit / 8] ^= static_cast<uint8>(1u << (bit % 8));
+        hashes.insert(Hasher::hash_bytes(flipped.data(), flipped.size()));
+        flipped[bit / 8] ^= static_cast<uint8>(1u << (bit % 8));
+    }
+    REQUIRE(hashes.size() == flipped.size() * 8);
+}
+
+TEST_CASE("Streaming gives the same hash as a single call.", "[HashStream]") {
+    Array<uint8> bytes = make_bytes(1024);
+
+    for (size_t size : {0, 1, 3, 4, 15, 16, 17, 47, 48, 49, 95, 96, 97, 200, 1024}) {
+        const uint64 expected = Hasher::hash_bytes(bytes.data(), size, 42);
+
+        for (size_t chunk : {1, 7, 16, 48, 50, 333}) {
+            HashStream stream(42);
+            for (size_t offset = 0; offset < size; offset += chunk) {
+                stream.update(bytes.data() + offset, offset + chunk < size ? chunk : size - offset);
+            }
+            REQUIRE(stream.finalize() == expected);
+        }
+    }
+
+    HashStream stream;
+    stream.update(bytes.data(), 100);
+    REQUIRE(stream.finalize() == Hasher::hash_bytes(bytes.data(), 100));
+    stream.update(bytes.data() + 100, 100);
+    REQUIRE(stream.finalize() == Hasher::hash_bytes(bytes.data(), 200));
+
+    stream.reset();
+    REQUIRE(stream.finalize() == Hasher::hash_bytes(nullptr, 0));
+}
+
+TEST_CASE("Combining hashes depends on every value and on their order.", "[Hasher::combine]") {
+    REQUIRE(Hasher::hash_values(1, 2) != Hasher::hash_values(2, 1));
+    REQUIRE(Hasher::hash_values(1, 2) != Hasher::hash_values(1, 3));
+    REQUIRE(Hasher::hash_values(0) != Hasher::hash_values(0, 0));
+    REQUIRE(Hasher::hash_values(1, String("a")) == Hasher::combine(Hasher::combine(0, Hasher::hash(1)), Hasher::hash(String("a"))));
+
+    HashSet<uint64> hashes;
+    for (uint32 x = 0; x < 64; ++x) {
+        for (uint32 y = 0; y < 64; ++y) {
+            hashes.insert(Hasher::hash_values(x, y));
+        }
+    }
+    REQUIRE(hashes.size() == 64 * 64);
+}
@@ -0,0 +1,132 @@
+#include <catch2/catch_all.hpp>
+
+#include <thread>
+
+#include "licht/core/memory/frame_allocator.hpp"
+
+using namespace licht;
+
+namespace {
+
+struct DrawCommand {
+    uint32 mesh = 0;
+    uint32 material = 0;
+    float32 depth = 0.0f;
+};
+
+}  // namespace
+
+TEST_CASE("FrameAllocator - Allocates aligned blocks from the current frame", "[FrameAllocator]") {
+    FrameAllocator allocator(2, 1024 * 1024, 4096);
+
+    allocator.begin_frame(0);
+
+    void* block = allocator.allocate(24, 64);
+    REQUIRE(block != nullptr);
+    REQUIRE(reinterpret_cast<uintptr_t>(block) % 64 == 0);
+
+    ArrayView<DrawCommand> commands = allocator.allocate_array<DrawCommand>(100);
+    REQUIRE(commands.size() == 100);
+    REQUIRE(reinterpret_cast<uintptr_t>(commands.data()) % alignof(DrawCommand) == 0);
+    for (const DrawCommand& command : commands) {
+        REQUIRE(command.mesh == 0);
+    }
+
+    Array<uint32> indices = {4, 8, 15, 16, 23, 42};
+    ArrayView<uint32> copied = allocator.copy_array(indices);
+    REQUIRE(copied.size() == 6);
+    REQUIRE(copied[5] == 42);
+
+    DrawCommand* command = allocator.create<DrawCommand>(DrawCommand{7, 3, 1.5f});
+    REQUIRE(command->material == 3);
+
+    REQUIRE(allocator.get_used_size(0) >= 4096);
+    REQUIRE(allocator.get_used_size(1) == 0);
+    REQUIRE(allocator.allocate_array<uint32>(0).empty());
+}
+
+TEST_CASE("FrameAllocator - Reuses a frame once it comes around again", "[FrameAllocator]") {
+    FrameAllocator allocator(2, 64 * 1024, 4096);
+    allocator.set_poison_on_reset(true);
+
+    allocator.begin_frame(0);
+    uint32* first = allocator.create<uint32>(0xCAFEu);
+
+    allocator.begin_frame(1);
+    uint32* second = allocator.create<uint32>(1u);
+    REQUIRE(second != first);
+    REQUIRE(*first == 0xCAFEu);
+
+    // The frame's memory is poisoned, a pointer kept past its frame reads garbage.
+    allocator.begin_frame(0);
+    REQUIRE(*first == 0xDDDDDDDDu);
+    REQUIRE(allocator.get_used_size(0) == 0);
+
+    uint32* third = allocator.create<uint32>(2u);
+    REQUIRE(third == first);
+}
+
+TEST_CASE("FrameAllocator - Falls back to the heap when a frame is full", "[FrameAllocator]") {
+    FrameAllocator allocator(1, 8 * 1024, 1024);
+    allocator.begin_frame(0);
+
+    ArrayView<uint8> large = allocator.allocate_array<uint8>(64 * 1024);
+    REQUIRE(large.size() == 64 * 1024);
+    large[large.size() - 1] = 1;
+    REQUIRE(allocator.get_overflow_size(0) == 64 * 1024);
+
+    allocator.begin_frame(0);
+    REQUIRE(allocator.get_overflow_size(0) == 0);
+}
+
+TEST_CASE("FrameAllocator - Threads allocate from their own sub-arenas", "[FrameAllocator]") {
+    FrameAllocator allocator(2, 4 * 1024 * 1024, 16 * 1024);
+
+    for (uint32 frame = 0; frame < 4; frame++) {
+        allocator.begin_frame(frame % 2);
+
+        Array<std::thread> threads;
+        Array<uint64*> blocks[4];
+        for (uint32 t = 0; t < 4; t++) {
+            threads.append(std::thread([&allocator, &blocks, t]() {
+                for (uint64 i = 0; i < 1000; i++) {
+                    uint64* value = allocator.create<uint64>(t * 1000 + i);
+                    blocks[t].append(value);
+                }
+            }));
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        for (uint32 t = 0; t < 4; t++) {
+            for (uint64 i = 0; i < 1000; i++) {
+                REQUIRE(*blocks[t][i] == t * 1000 + i);
+            }
+        }
+    }
+}
+
+TEST_CASE("FrameAllocator - A thread keeps its sub-arena in each allocator it uses", "[FrameAllocator]") {
+    FrameAllocator first(1, 1024 * 1024, 4096);
+    FrameAllocator second(1, 1024 * 1024, 4096);
+    first.begin_frame(0);
+    second.begin_frame(0);
+
+    for (uint32 i = 0; i < 100; i++) {
+        REQUIRE(first.create<uint32>(i) != nullptr);
+        REQUIRE(second.create<uint32>(i) != nullptr);
+    }
+
+    // One sub-arena carved from each, instead of one per switch between them.
+    const size_t first_used = first.get_used_size(0);
+    const size_t second_used = second.get_used_size(0);
+    REQUIRE(first_used < 2 * 4096);
+    REQUIRE(second_used < 2 * 4096);
+
+    first.begin_frame(0);
+    REQUIRE(first.create<uint32>(1u) != nullptr);
+    REQUIRE(second.create<uint32>(2u) != nullptr);
+    REQUIRE(first.get_used_size(0) < 2 * 4096);
+    REQUIRE(second.get_used_size(0) == second_used);
+}
@@ -0,0 +1,119 @@
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <thread>
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/memory/intrusive_ref.hpp"
+#include "licht/core/memory/memory_trace.hpp"
+
+using namespace licht;
+
+namespace {
+
+struct Counted : IntrusiveRefCounted {
+    uint32& destroyed;
+
+    explicit Counted(uint32& destroyed)
+        : destroyed(destroyed) {}
+
+    ~Counted() {
+        destroyed++;
+    }
+};
+
+struct Shape : IntrusiveRefCounted {
+    virtual ~Shape() = default;
+
+    virtual void destroy_self() = 0;
+};
+
+struct Circle : Shape {
+    std::atomic<uint32>& destroyed;
+    float64 radius = 1.0;
+
+    explicit Circle(std::atomic<uint32>& destroyed)
+        : destroyed(destroyed) {}
+
+    ~Circle() override {
+        destroyed++;
+    }
+
+    void destroy_self() override {
+        ldelete(DefaultAllocator::get_instance(), this);
+    }
+};
+
+struct Plain : IntrusiveRefCounted {
+    uint32 id = 0;
+};
+
+struct PlainDerived : Plain {
+    uint64 payload[8] = {};
+};
+
+}  // namespace
+
+TEST_CASE("IntrusiveRef - Counts references in the object", "[IntrusiveRef]") {
+    uint32 destroyed = 0;
+    const size_t allocation_count = MemoryTrace::global_get_allocation_count();
+    {
+        IntrusiveRef<Counted> ref = new_intrusive_ref<Counted>(destroyed);
+        REQUIRE(MemoryTrace::global_get_allocation_count() == allocation_count + 1);
+        REQUIRE(ref.is_unique());
+
+        IntrusiveRef<Counted> copy = ref;
+        REQUIRE(ref.get_reference_count() == 2);
+
+        // A raw pointer turns back into a reference.
+        IntrusiveRef<Counted> from_raw(copy.get_resource());
+        REQUIRE(from_raw == ref);
+        REQUIRE(ref.get_reference_count() == 3);
+
+        IntrusiveRef<Counted> moved = std::move(copy);
+        REQUIRE_FALSE(copy.is_valid());
+        REQUIRE(ref.get_reference_count() == 3);
+
+        moved = ref;
+        REQUIRE(ref.get_reference_count() == 3);
+        REQUIRE(destroyed == 0);
+    }
+    REQUIRE(destroyed == 1);
+}
+
+TEST_CASE("IntrusiveRef - Frees derived objects through destroy_self", "[IntrusiveRef]") {
+    constexpr uint32 thread_count = 4;
+    std::atomic<uint32> destroyed = 0;
+    {
+        IntrusiveRef<Shape> shape = new_intrusive_ref<Circle>(destroyed);
+        REQUIRE(shape.is_unique());
+
+        Array<std::thread> threads(thread_count);
+        for (uint32 t = 0; t < thread_count; t++) {
+            threads.append(std::thread([shape]() {
+                for (uint32 i = 0; i < 10000; i++) {
+                    IntrusiveRef<Shape> copy = shape;
+                }
+            }));
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+
+        REQUIRE(shape.is_unique());
+        shape.reset(shape.get_resource());
+        REQUIRE(shape.is_unique());
+    }
+    REQUIRE(destroyed == 1);
+}
+
+TEST_CASE("IntrusiveRef - Converts to a base only when it frees through destroy_self", "[IntrusiveRef]") {
+    STATIC_REQUIRE(std::is_constructible_v<IntrusiveRef<Shape>, IntrusiveRef<Circle>>);
+    STATIC_REQUIRE(std::is_constructible_v<IntrusiveRef<Shape>, Circle*>);
+
+    // `Plain` would be freed with its own, smaller size.
+    STATIC_REQUIRE_FALSE(std::is_constructible_v<IntrusiveRef<Plain>, IntrusiveRef<PlainDerived>>);
+    STATIC_REQUIRE_FALSE(std::is_constructible_v<IntrusiveRef<Plain>, PlainDerived*>);
+    STATIC_REQUIRE_FALSE(std::is_assignable_v<IntrusiveRef<Plain>&, IntrusiveRef<PlainDerived>>);
+    STATIC_REQUIRE(std::is_constructible_v<IntrusiveRef<PlainDerived>, PlainDerived*>);
+}
@@ -0,0 +1,105 @@
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+#include <thread>
+
+#include "licht/core/memory/local_ref.hpp"
+#include "licht/core/memory/memory_trace.hpp"
+#include "licht/core/memory/shared_ref.hpp"
+
+using namespace licht;
+
+namespace {
+
+struct Base {
+    virtual ~Base() = default;
+};
+
+struct Tracked : Base {
+    std::atomic<uint32>& destroyed;
+    uint32 value;
+
+    Tracked(std::atomic<uint32>& destroyed, uint32 value)
+        : destroyed(destroyed)
+        , value(value) {}
+
+    ~Tracked() override {
+        destroyed++;
+    }
+};
+
+}  // namespace
+
+TEST_CASE("LocalRef - Counts copies without touching the shared count", "[LocalRef]") {
+    std::atomic<uint32> destroyed = 0;
+    {
+        const size_t allocation_count = MemoryTrace::global_get_allocation_count();
+        LocalRef<Tracked> ref = new_local_ref<Tracked>(destroyed, 7u);
+        REQUIRE(MemoryTrace::global_get_allocation_count() == allocation_count + 1);
+        REQUIRE(ref.is_valid());
+        REQUIRE(ref->value == 7);
+        REQUIRE(ref.get_local_reference_count() == 1);
+
+        SharedRef<Tracked> shared = ref.to_shared();
+        REQUIRE(shared.get_shared_reference_count() == 2);
+
+        {
+            LocalRef<Tracked> copy = ref;
+            LocalRef<Base> base = copy;
+            REQUIRE(ref.get_local_reference_count() == 3);
+            REQUIRE(shared.get_shared_reference_count() == 2);
+        }
+        REQUIRE(ref.get_local_reference_count() == 1);
+
+        ref.reset();
+        REQUIRE_FALSE(ref.is_valid());
+        REQUIRE(shared.is_unique());
+        REQUIRE(destroyed == 0);
+    }
+    REQUIRE(destroyed == 1);
+}
+
+TEST_CASE("LocalRef - Crosses threads through SharedRef", "[LocalRef]") {
+    std::atomic<uint32> destroyed = 0;
+    std::atomic<uint32> failures = 0;
+    {
+        SharedRef<Tracked> shared = new_ref<Tracked>(destroyed, 3u);
+
+        std::thread worker([shared, &failures]() {
+            LocalRef<Tracked> local(shared);
+            for (uint32 i = 0; i < 1000; i++) {
+                LocalRef<Tracked> copy = local;
+                if (copy->value != 3) {
+                    failures++;
+                }
+            }
+            if (local.get_local_reference_count() != 1) {
+                failures++;
+            }
+        });
+        worker.join();
+
+        REQUIRE(failures == 0);
+        REQUIRE(shared.is_unique());
+    }
+    REQUIRE(destroyed == 1);
+}
+
+TEST_CASE("LocalRef - The resource outlives its first local group", "[LocalRef]") {
+    std::atomic<uint32> destroyed = 0;
+    {
+        SharedRef<Tracked> shared;
+        {
+            LocalRef<Tracked> local = new_local_ref<Tracked>(destroyed, 5u);
+            shared = local.to_shared();
+        }
+        REQUIRE(destroyed == 0);
+        REQUIRE(shared.is_unique());
+
+        // A later group gets a counter of its own.
+        LocalRef<Tracked> again(shared);
+        REQUIRE(again->value == 5);
+        REQUIRE(shared.get_shared_reference_count() == 2);
+    }
+    REQUIRE(destroyed == 1);
+}
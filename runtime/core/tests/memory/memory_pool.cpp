@@ -6,6 +6,9 @@
 
 #include <catch2/catch_all.hpp>
 
+#include <atomic>
+#include <thread>
+
 using namespace licht;
 
 struct TestObject {
@@ -74,3 +77,84 @@ TEST_CASE("MemoryPool basic allocation and deallocation.", "[MemoryPool]") {
 
     pool.dispose();
 }
+
+TEST_CASE("MemoryPool - for_each visits only the live resources", "[MemoryPool]") {
+    MemoryPool<TestObject> pool;
+    pool.initialize_pool(&DefaultAllocator::get_instance(), 4);
+
+    Array<TestObject*> objects(100);
+    for (int32 i = 0; i < 100; i++) {
+        objects.append(pool.new_resource("Name", i));
+    }
+    REQUIRE(pool.get_block_capacity() >= 100);
+
+    for (int32 i = 0; i < 100; i += 3) {
+        pool.destroy_resource(objects[i]);
+    }
+
+    int32 visited = 0;
+    int32 sum = 0;
+    pool.for_each([&](TestObject* object) {
+        REQUIRE(object->value % 3 != 0);
+        visited++;
+        sum += object->value;
+    });
+
+    int32 expected_sum = 0;
+    for (int32 i = 0; i < 100; i++) {
+        expected_sum += i % 3 != 0 ? i : 0;
+    }
+    REQUIRE(visited == 66);
+    REQUIRE(sum == expected_sum);
+
+    // Destroying from the functor, as the render pools do on dispose.
+    pool.for_each([&](TestObject* object) {
+        pool.destroy_resource(object);
+    });
+
+    visited = 0;
+    pool.for_each([&](TestObject*) {
+        visited++;
+    });
+    REQUIRE(visited == 0);
+}
+
+TEST_CASE("MemoryPool - Concurrent allocations and deallocations from several threads", "[MemoryPool]") {
+    ConcurrentMemoryPool<TestObject> pool;
+    pool.initialize_pool(&DefaultAllocator::get_instance(), 8);
+
+    constexpr int32 thread_count = 4;
+    constexpr int32 round_count = 2000;
+    constexpr int32 kept_count = 16;
+
+    std::atomic<int32> mismatches = 0;
+    Array<std::thread> threads(thread_count);
+    for (int32 t = 0; t < thread_count; t++) {
+        threads.append(std::thread([&pool, &mismatches, t]() {
+            TestObject* objects[kept_count] = {};
+            for (int32 round = 0; round < round_count; round++) {
+                TestObject*& object = objects[round % kept_count];
+                if (object) {
+                    if (object->value != t * round_count + round - kept_count) {
+                        mismatches.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    pool.destroy_resource(object);
+                }
+                object = pool.new_resource("Name", t * round_count + round);
+            }
+        }));
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    REQUIRE(mismatches.load() == 0);
+
+    // Each thread keeps its last objects alive, every other block went back to the pool.
+    int32 visited = 0;
+    pool.for_each([&](TestObject* object) {
+        REQUIRE(object->value % round_count >= round_count - kept_count);
+        visited++;
+    });
+    REQUIRE(visited == thread_count * kept_count);
+}
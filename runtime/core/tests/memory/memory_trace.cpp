@@ -0,0 +1,136 @@
+#include <catch2/catch_all.hpp>
+
+#include <thread>
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/memory/memory.hpp"
+#include "licht/core/memory/memory_trace.hpp"
+
+using namespace licht;
+
+TEST_CASE("MemoryTrace - Accounts allocations to the tag of the scope", "[MemoryTrace]") {
+    const MemoryTraceSnapshot before = MemoryTrace::global_capture_snapshot();
+
+    void* blocks[10];
+    {
+        MemoryTagScope assets(MemoryTag::Assets);
+        REQUIRE(MemoryTrace::get_current_tag() == MemoryTag::Assets);
+        {
+            MemoryTagScope rhi(MemoryTag::RHI);
+            REQUIRE(MemoryTrace::get_current_tag() == MemoryTag::RHI);
+        }
+        REQUIRE(MemoryTrace::get_current_tag() == MemoryTag::Assets);
+
+        for (void*& block : blocks) {
+            block = Memory::allocate(100);
+        }
+    }
+    REQUIRE(MemoryTrace::get_current_tag() == MemoryTag::General);
+
+    const MemoryTraceSnapshot allocated = MemoryTrace::global_capture_snapshot().diff(before);
+    REQUIRE(allocated.get(MemoryTag::Assets).allocation_count == 10);
+    REQUIRE(allocated.get(MemoryTag::Assets).allocated_bytes == 1000);
+    REQUIRE(allocated.get(MemoryTag::Assets).current_bytes == 1000);
+    // 100 bytes fall in the 65..128 bucket.
+    REQUIRE(allocated.get(MemoryTag::Assets).size_histogram[3] == 10);
+    REQUIRE(allocated.get(MemoryTag::RHI).allocation_count == 0);
+
+    {
+        MemoryTagScope assets(MemoryTag::Assets);
+        for (void* block : blocks) {
+            Memory::free(block, 100);
+        }
+    }
+
+    const MemoryTraceSnapshot freed = MemoryTrace::global_capture_snapshot().diff(before);
+    REQUIRE(freed.get(MemoryTag::Assets).free_count == 10);
+    REQUIRE(freed.get(MemoryTag::Assets).current_bytes == 0);
+    REQUIRE(freed.get(MemoryTag::Assets).peak_bytes >= 1000);
+}
+
+TEST_CASE("MemoryTrace - Counts the allocations of the last frame", "[MemoryTrace]") {
+    MemoryTrace::global_mark_frame();
+    {
+        MemoryTagScope assets(MemoryTag::Assets);
+        for (uint32 i = 0; i < 5; i++) {
+            Memory::free(Memory::allocate(32), 32);
+        }
+    }
+    MemoryTrace::global_mark_frame();
+
+    REQUIRE(MemoryTrace::global_get_frame_allocation_count() >= 5);
+
+    const MemoryTraceSnapshot snapshot = MemoryTrace::global_capture_snapshot();
+    REQUIRE(snapshot.get(MemoryTag::Assets).frame_allocation_count == 5);
+    REQUIRE(snapshot.get_total().frame_allocation_count == MemoryTrace::global_get_frame_allocation_count());
+}
+
+TEST_CASE("MemoryTrace - Sums the counters of every thread, exited ones included", "[MemoryTrace]") {
+    constexpr uint32 thread_count = 4;
+    constexpr uint32 allocation_count = 1000;
+
+    const MemoryTraceSnapshot before = MemoryTrace::global_capture_snapshot();
+
+    // Two waves, so that the second reuses the counters left by the first.
+    for (uint32 wave = 0; wave < 2; wave++) {
+        Array<std::thread> threads(thread_count);
+        for (uint32 t = 0; t < thread_count; t++) {
+            threads.append(std::thread([]() {
+                MemoryTagScope messaging(MemoryTag::Messaging);
+                for (uint32 i = 0; i < allocation_count; i++) {
+                    Memory::free(Memory::allocate(48), 48);
+                }
+            }));
+        }
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    const MemoryTraceSnapshot delta = MemoryTrace::global_capture_snapshot().diff(before);
+    REQUIRE(delta.get(MemoryTag::Messaging).allocation_count == 2 * thread_count * allocation_count);
+    REQUIRE(delta.get(MemoryTag::Messaging).free_count == 2 * thread_count * allocation_count);
+    REQUIRE(delta.get(MemoryTag::Messaging).current_bytes == 0);
+}
+
+TEST_CASE("MemoryTrace - Frees are accounted to the tag of the allocation", "[MemoryTrace]") {
+    const MemoryTraceSnapshot before = MemoryTrace::global_capture_snapshot();
+
+    const size_t sizes[] = {64, 3000, 64 * 1024};
+    void* blocks[3];
+    {
+        MemoryTagScope renderer(MemoryTag::Renderer);
+        for (size_t i = 0; i < 3; i++) {
+            blocks[i] = Memory::allocate(sizes[i]);
+        }
+    }
+
+    // Freed by another thread, under another tag.
+    std::thread([&]() {
+        MemoryTagScope jobs(MemoryTag::Jobs);
+        for (size_t i = 0; i < 3; i++) {
+            Memory::free(blocks[i], sizes[i]);
+        }
+    }).join();
+
+    const MemoryTraceSnapshot delta = MemoryTrace::global_capture_snapshot().diff(before);
+    REQUIRE(delta.get(MemoryTag::Renderer).free_count == 3);
+    REQUIRE(delta.get(MemoryTag::Renderer).current_bytes == 0);
+    REQUIRE(delta.get(MemoryTag::Jobs).free_count == 0);
+}
+
+TEST_CASE("MemoryTrace - Peaks follow every allocation, not only frame marks", "[MemoryTrace]") {
+    const int64 peak_before = MemoryTrace::global_capture_snapshot().get(MemoryTag::Assets).peak_bytes;
+    const int64 current_before = MemoryTrace::global_capture_snapshot().get(MemoryTag::Assets).current_bytes;
+
+    // A spike freed before any frame mark or snapshot.
+    constexpr size_t spike_size = 16 * 1024 * 1024;
+    {
+        MemoryTagScope assets(MemoryTag::Assets);
+        Memory::free(Memory::allocate(spike_size), spike_size);
+    }
+
+    const MemoryTagStatistics assets = MemoryTrace::global_capture_snapshot().get(MemoryTag::Assets);
+    REQUIRE(assets.peak_bytes >= current_before + static_cast<int64>(spike_size));
+    REQUIRE(assets.peak_bytes >= peak_before);
+}
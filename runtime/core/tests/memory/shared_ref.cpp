@@ -1,7 +1,9 @@
 #include <catch2/catch_all.hpp>
 
 #include "licht/core/containers/array.hpp"
+#include "licht/core/memory/memory_trace.hpp"
 #include "licht/core/memory/shared_ref.hpp"
+#include "licht/core/memory/shared_ref_cast.hpp"
 
 using namespace licht;
 
@@ -100,3 +102,63 @@ TEST_CASE("Construct correctely in an Array.", "[SharedRef::SharedRef]") {
         REQUIRE(base->x == 2);
     }
 }
+
+TEST_CASE("SharedRef - new_ref allocates the resource and its counter together", "[SharedRef]") {
+    struct Tracked {
+        uint32& destroyed;
+        uint64 payload[4] = {};
+
+        explicit Tracked(uint32& destroyed)
+            : destroyed(destroyed) {}
+
+        ~Tracked() {
+            destroyed++;
+        }
+    };
+
+    uint32 destroyed = 0;
+    const size_t allocation_count = MemoryTrace::global_get_allocation_count();
+    {
+        SharedRef<Tracked> ref = new_ref<Tracked>(destroyed);
+        REQUIRE(MemoryTrace::global_get_allocation_count() == allocation_count + 1);
+        REQUIRE(ref.get_shared_reference_count() == 1);
+        REQUIRE(Memory::is_aligned(reinterpret_cast<uintptr_t>(ref.get_resource()), alignof(Tracked)));
+
+        SharedRef<Tracked> copy = ref;
+        REQUIRE(copy.get_shared_reference_count() == 2);
+        ref.reset();
+        REQUIRE(destroyed == 0);
+    }
+    REQUIRE(destroyed == 1);
+}
+
+TEST_CASE("SharedRef - Raw pointers and deleters keep a separate counter", "[SharedRef]") {
+    struct Base {
+        virtual ~Base() = default;
+    };
+    struct Derived : Base {
+        uint32& destroyed;
+
+        explicit Derived(uint32& destroyed)
+            : destroyed(destroyed) {}
+
+        ~Derived() override {
+            destroyed++;
+        }
+    };
+
+    uint32 destroyed = 0;
+    {
+        SharedRef<Base> ref(lnew_args<Derived>(DefaultAllocator::get_instance(), destroyed));
+        SharedRef<Derived> derived = static_ref_cast<Derived>(ref);
+        REQUIRE(ref.get_shared_reference_count() == 2);
+    }
+    REQUIRE(destroyed == 1);
+
+    {
+        SharedRef<Base> ref = new_ref<Derived>(destroyed);
+        SharedRef<Derived> derived = static_ref_cast<Derived>(ref);
+        REQUIRE(derived.get_shared_reference_count() == 2);
+    }
+    REQUIRE(destroyed == 2);
+}
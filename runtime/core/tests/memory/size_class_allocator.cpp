@@ -0,0 +1,126 @@
+#include <catch2/catch_all.hpp>
+
+#include <thread>
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/memory/default_allocator.hpp"
+#include "licht/core/memory/deleter.hpp"
+#include "licht/core/memory/shared_ref.hpp"
+#include "licht/core/memory/size_class_allocator.hpp"
+
+using namespace licht;
+
+TEST_CASE("SizeClassAllocator - Blocks hold their size", "[SizeClassAllocator]") {
+    Array<uint8*> blocks;
+    for (size_t size = 0; size <= 3 * SizeClassAllocator::max_small_size; size += 24) {
+        REQUIRE(SizeClassAllocator::get_allocation_size(size) >= size);
+
+        uint8* block = static_cast<uint8*>(SizeClassAllocator::allocate(size));
+        REQUIRE(block != nullptr);
+        REQUIRE(reinterpret_cast<uintptr_t>(block) % SizeClassAllocator::default_alignment == 0);
+        for (size_t i = 0; i < size; i++) {
+            block[i] = static_cast<uint8>(size);
+        }
+        blocks.append(block);
+    }
+
+    size_t size = 0;
+    for (uint8* block : blocks) {
+        for (size_t i = 0; i < size; i++) {
+            REQUIRE(block[i] == static_cast<uint8>(size));
+        }
+        SizeClassAllocator::free(block, size);
+        size += 24;
+    }
+}
+
+TEST_CASE("SizeClassAllocator - Honors large alignments without a header", "[SizeClassAllocator]") {
+    for (size_t alignment = 1; alignment <= 64 * 1024; alignment *= 2) {
+        for (size_t size : {size_t(8), size_t(100), size_t(5000), size_t(100000)}) {
+            void* block = SizeClassAllocator::allocate(size, alignment);
+            REQUIRE(block != nullptr);
+            REQUIRE(reinterpret_cast<uintptr_t>(block) % alignment == 0);
+            SizeClassAllocator::free(block, size, alignment);
+        }
+    }
+}
+
+TEST_CASE("SizeClassAllocator - Reuses the last freed block of a class", "[SizeClassAllocator]") {
+    void* first = SizeClassAllocator::allocate(40);
+    SizeClassAllocator::free(first, 40);
+
+    void* second = SizeClassAllocator::allocate(48);
+    REQUIRE(second == first);
+    SizeClassAllocator::free(second, 48);
+}
+
+TEST_CASE("SizeClassAllocator - Blocks freed through a base class deleter return to their class", "[SizeClassAllocator]") {
+    struct Base {
+        uint64 id = 0;
+    };
+    struct Derived : Base {
+        uint64 payload[64] = {};
+    };
+    REQUIRE(SizeClassAllocator::get_allocation_size(sizeof(Base)) != SizeClassAllocator::get_allocation_size(sizeof(Derived)));
+
+    Derived* derived = lnew(DefaultAllocator::get_instance(), Derived());
+    void* block = derived;
+    {
+        // Frees `sizeof(Base)` bytes of a `Derived` block.
+        SharedRef<Base> ref(derived, create_deleter<Base>(DefaultAllocator::get_instance()));
+    }
+
+    void* base = SizeClassAllocator::allocate(sizeof(Base));
+    void* reused = SizeClassAllocator::allocate(sizeof(Derived));
+    REQUIRE(base != block);
+    REQUIRE(reused == block);
+
+    SizeClassAllocator::free(reused, sizeof(Derived));
+    SizeClassAllocator::free(base, sizeof(Base));
+}
+
+TEST_CASE("SizeClassAllocator - Frees from another thread and returns empty spans", "[SizeClassAllocator]") {
+    constexpr size_t block_count = 20000;
+    constexpr size_t block_size = 1000;
+
+    const size_t span_count_before = SizeClassAllocator::get_statistics().span_count;
+
+    Array<void*> blocks(block_count);
+    std::thread producer([&blocks]() {
+        for (size_t i = 0; i < block_count; i++) {
+            blocks.append(SizeClassAllocator::allocate(block_size));
+        }
+    });
+    producer.join();
+
+    REQUIRE(SizeClassAllocator::get_statistics().span_count > span_count_before);
+
+    std::thread consumer([&blocks]() {
+        for (void* block : blocks) {
+            SizeClassAllocator::free(block, block_size);
+        }
+    });
+    consumer.join();
+
+    // Both threads flushed their cache on exit, only one free span per class and the retained ones may stay.
+    REQUIRE(SizeClassAllocator::get_statistics().span_count <= span_count_before + 1 + SizeClassAllocator::max_retained_spans);
+}
+
+TEST_CASE("SizeClassAllocator - Blocks keep the tag they were allocated with", "[SizeClassAllocator]") {
+    const size_t sizes[] = {16, 100, 8192, 20000};
+    const size_t alignments[] = {16, 64, 4096};
+
+    for (size_t size : sizes) {
+        for (size_t alignment : alignments) {
+            void* blocks[64];
+            for (uint32 i = 0; i < 64; i++) {
+                blocks[i] = SizeClassAllocator::allocate(size, alignment, static_cast<uint8>(i));
+                REQUIRE(reinterpret_cast<uintptr_t>(blocks[i]) % alignment == 0);
+            }
+            for (uint32 i = 0; i < 64; i++) {
+                REQUIRE(SizeClassAllocator::get_tag(blocks[i], size, alignment) == static_cast<uint8>(i));
+                SizeClassAllocator::free(blocks[i], size, alignment);
+            }
+        }
+    }
+}
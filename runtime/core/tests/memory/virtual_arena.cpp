@@ -0,0 +1,91 @@
+#include <catch2/catch_all.hpp>
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/memory/memory.hpp"
+#include "licht/core/memory/virtual_arena.hpp"
+
+using namespace licht;
+
+TEST_CASE("VirtualArena - Grows past the committed size without moving blocks", "[VirtualArena]") {
+    VirtualArena arena(256 * 1024 * 1024);
+    REQUIRE(arena.is_valid());
+    REQUIRE(arena.get_committed_size() == 0);
+
+    Array<uint8*> blocks;
+    for (uint32 i = 0; i < 64; i++) {
+        uint8* block = static_cast<uint8*>(arena.allocate(100 * 1024, 64));
+        REQUIRE(block != nullptr);
+        REQUIRE(Memory::is_aligned(reinterpret_cast<uintptr_t>(block), 64));
+        Memory::write(block, static_cast<int32>(i), 100 * 1024);
+        blocks.append(block);
+    }
+
+    REQUIRE(arena.get_committed_size() >= 64 * 100 * 1024);
+    REQUIRE(arena.get_committed_size() < arena.get_reserved_size());
+    for (uint32 i = 0; i < blocks.size(); i++) {
+        REQUIRE(blocks[i][0] == static_cast<uint8>(i));
+        REQUIRE(blocks[i][100 * 1024 - 1] == static_cast<uint8>(i));
+    }
+}
+
+TEST_CASE("VirtualArena - Returns nullptr past the reservation", "[VirtualArena]") {
+    VirtualArena arena(1024 * 1024);
+    REQUIRE(arena.allocate(arena.get_reserved_size(), 16) != nullptr);
+    REQUIRE(arena.allocate(1, 1) == nullptr);
+
+    arena.reset();
+    REQUIRE(arena.allocate(1, 1) != nullptr);
+}
+
+TEST_CASE("VirtualArena - Reset decommits past the retained size", "[VirtualArena]") {
+    constexpr size_t retained_size = 256 * 1024;
+    VirtualArena arena(64 * 1024 * 1024, retained_size);
+    const size_t retained_committed = arena.get_committed_size();
+    REQUIRE(retained_committed >= retained_size);
+
+    void* first = arena.allocate(8 * 1024 * 1024, 16);
+    REQUIRE(first != nullptr);
+    REQUIRE(arena.get_committed_size() >= 8 * 1024 * 1024);
+
+    arena.reset();
+    REQUIRE(arena.get_offset() == 0);
+    REQUIRE(arena.get_committed_size() == retained_committed);
+    REQUIRE(arena.get_high_water_mark() >= 8 * 1024 * 1024);
+
+    // Decommitted pages come back zeroed.
+    uint8* block = static_cast<uint8*>(arena.allocate(8 * 1024 * 1024, 16));
+    REQUIRE(block == first);
+    REQUIRE(block[8 * 1024 * 1024 - 1] == 0);
+}
+
+TEST_CASE("VirtualArena - Rewinds to a marker and tracks the high-water mark", "[VirtualArena]") {
+    VirtualArena arena(16 * 1024 * 1024);
+
+    arena.allocate(1000, 8);
+    const size_t marker = arena.get_offset();
+
+    void* scratch = arena.allocate(50000, 8);
+    REQUIRE(arena.get_high_water_mark() == marker + 50000);
+
+    arena.rewind(marker);
+    REQUIRE(arena.get_offset() == marker);
+    REQUIRE(arena.allocate(50000, 8) == scratch);
+
+    arena.rewind(marker);
+    arena.reset_high_water_mark();
+    REQUIRE(arena.get_high_water_mark() == marker);
+}
+
+TEST_CASE("VirtualArena - Huge pages are a hint", "[VirtualArena]") {
+    VirtualArena arena;
+    REQUIRE(arena.initialize(64 * 1024 * 1024, 0, true));
+
+    uint8* block = static_cast<uint8*>(arena.allocate(4 * 1024 * 1024, 16));
+    REQUIRE(block != nullptr);
+    Memory::write(block, 1, 4 * 1024 * 1024);
+    REQUIRE(block[4 * 1024 * 1024 - 1] == 1);
+
+    VirtualArena moved = std::move(arena);
+    REQUIRE_FALSE(arena.is_valid());
+    REQUIRE(moved.get_buffer() == block);
+}
@@ -0,0 +1,66 @@
+#include <catch2/catch_all.hpp>
+
+#include <thread>
+
+#include "licht/core/platform/cpu_topology.hpp"
+#include "licht/core/platform/platform_thread.hpp"
+
+using namespace licht;
+
+TEST_CASE("CpuTopology - Every logical processor belongs to one core", "[CpuTopology]") {
+    const CpuTopology& topology = platform_get_cpu_topology();
+
+    REQUIRE(topology.logical_processor_count > 0);
+    REQUIRE(topology.get_physical_core_count() > 0);
+    REQUIRE(topology.get_physical_core_count() <= topology.logical_processor_count);
+    REQUIRE_FALSE(topology.numa_nodes.empty());
+
+    Array<uint32> processors;
+    for (const CpuCore& core : topology.cores) {
+        REQUIRE_FALSE(core.logical_processors.empty());
+        for (uint32 processor : core.logical_processors) {
+            REQUIRE_FALSE(processors.contains(processor));
+            processors.append(processor);
+        }
+    }
+    REQUIRE(processors.size() == topology.logical_processor_count);
+
+    REQUIRE(topology.get_primary_logical_processors().size() == topology.get_physical_core_count());
+
+    for (const CpuCacheGroup& cache : topology.caches) {
+        REQUIRE(cache.level >= 2);
+        REQUIRE_FALSE(cache.logical_processors.empty());
+        // Caches only list the processors the process can run on, like cores.
+        for (uint32 processor : cache.logical_processors) {
+            REQUIRE(processors.contains(processor));
+        }
+    }
+
+    for (const CpuNumaNode& node : topology.numa_nodes) {
+        for (uint32 processor : node.logical_processors) {
+            REQUIRE(processors.contains(processor));
+        }
+    }
+}
+
+TEST_CASE("CpuTopology - Threads are pinned, named and prioritized", "[CpuTopology]") {
+    const CpuTopology& topology = platform_get_cpu_topology();
+    const Array<uint32>& core_processors = topology.cores[topology.cores.size() - 1].logical_processors;
+
+    bool pinned = false;
+    bool named = false;
+    bool prioritized = false;
+
+    std::thread thread([&]() {
+        pinned = platform_set_current_thread_affinity(core_processors);
+        named = platform_set_current_thread_name("Test Thread With A Long Name");
+        prioritized = platform_set_current_thread_priority(ThreadPriority::Low);
+    });
+    thread.join();
+
+    REQUIRE(pinned);
+    REQUIRE(named);
+    REQUIRE(prioritized);
+
+    REQUIRE_FALSE(platform_set_current_thread_affinity(Array<uint32>()));
+}
@@ -0,0 +1,105 @@
+#include <catch2/catch_all.hpp>
+
+#include <thread>
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/containers/hash_map.hpp"
+#include "licht/core/string/format.hpp"
+#include "licht/core/string/name.hpp"
+#include "licht/core/string/string_builder.hpp"
+
+using namespace licht;
+
+TEST_CASE("Name - Interns equal strings to the same id", "[string][name]") {
+    Name a("name.test.interning");
+    Name b(StringRef("name.test.interning"));
+    Name c(String("name.test.interning"));
+
+    REQUIRE(a == b);
+    REQUIRE(b == c);
+    REQUIRE(a.id() == c.id());
+    REQUIRE_FALSE(a.is_none());
+    REQUIRE(a != Name("name.test.interning.other"));
+}
+
+TEST_CASE("Name - Gives the interned characters back", "[string][name]") {
+    Name name("licht.rhi.vulkan");
+    REQUIRE(name.to_string() == "licht.rhi.vulkan");
+
+    // The characters are shared, not copied per name.
+    REQUIRE(Name("licht.rhi.vulkan").to_string().data() == name.to_string().data());
+
+    String long_string = StringBuilder().append('n', 4096).build();
+    REQUIRE(Name(long_string).to_string() == StringRef(long_string));
+}
+
+TEST_CASE("Name - None name", "[string][name]") {
+    Name none;
+    REQUIRE(none.is_none());
+    REQUIRE(none.id() == 0);
+    REQUIRE(none.to_string().empty());
+    REQUIRE(Name("") == none);
+}
+
+TEST_CASE("Name - Find does not intern", "[string][name]") {
+    const uint32 count = Name::get_interned_count();
+    REQUIRE(Name::find("name.test.never.interned").is_none());
+    REQUIRE(Name::get_interned_count() == count);
+
+    Name name("name.test.found");
+    REQUIRE(Name::find("name.test.found") == name);
+}
+
+TEST_CASE("Name - Keys a hash map", "[string][name]") {
+    HashMap<Name, int32> map;
+    map.put("projectdir", 1);
+    map.put("enginedir", 2);
+
+    REQUIRE(map.get(Name("projectdir")) == 1);
+    REQUIRE(map.get(Name("enginedir")) == 2);
+    REQUIRE_FALSE(map.contains(Name("name.test.missing")));
+}
+
+TEST_CASE("Name - Concurrent interning", "[string][name]") {
+    constexpr int32 thread_count = 4;
+    constexpr int32 name_count = 2000;
+
+    Array<String> strings;
+    for (int32 i = 0; i < name_count; i++) {
+        strings.append(vformat("name.test.concurrent.%d", i));
+    }
+
+    Array<Array<Name>> results(thread_count);
+    for (int32 t = 0; t < thread_count; t++) {
+        results.append(Array<Name>());
+    }
+
+    Array<std::thread> threads;
+    for (int32 t = 0; t < thread_count; t++) {
+        threads.append(std::thread([&, t]() {
+            Array<Name>& names = results[t];
+            // Each thread walks the strings from a different offset to race on the same entries.
+            for (int32 i = 0; i < name_count; i++) {
+                const int32 index = (i + t * (name_count / thread_count)) % name_count;
+                names.append(Name(strings[index]));
+            }
+        }));
+    }
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (int32 i = 0; i < name_count; i++) {
+        Name expected = Name::find(strings[i]);
+        REQUIRE_FALSE(expected.is_none());
+        REQUIRE(expected.to_string() == StringRef(strings[i]));
+    }
+
+    for (int32 t = 0; t < thread_count; t++) {
+        for (int32 i = 0; i < name_count; i++) {
+            const int32 index = (i + t * (name_count / thread_count)) % name_count;
+            REQUIRE(results[t][i] == Name::find(strings[index]));
+        }
+    }
+}
@@ -1,6 +1,7 @@
 #include <catch2/catch_all.hpp>
 
 #include <cstring>
+#include "licht/core/memory/memory_trace.hpp"
 #include "licht/core/string/string.hpp"
 
 using namespace licht;
@@ -140,6 +141,25 @@ TEST_CASE("StringBase - Capacity management", "[string]") {
 
         REQUIRE(str.size() == 10);
         REQUIRE(str.data()[10] == '\0');  // Null-terminated
+        for (size_t i = 5; i < 10; i++) {
+            REQUIRE(str.data()[i] == '\0');
+        }
+
+        String long_str("Hello");
+        long_str.resize(100);
+        REQUIRE(strncmp(long_str.data(), "Hello", 5) == 0);
+        for (size_t i = 5; i <= 100; i++) {
+            REQUIRE(long_str.data()[i] == '\0');
+        }
+    }
+
+    SECTION("Resize without initialization") {
+        String str("Hello");
+        str.resize_uninitialized(8);
+        memcpy(str.data() + 5, "abc", 3);
+
+        REQUIRE(str == "Helloabc");
+        REQUIRE(str.data()[8] == '\0');
     }
 
     SECTION("Reserve operation") {
@@ -241,3 +261,74 @@ TEST_CASE("String - Output stream operator", "[string][ostream]") {
         REQUIRE(oss.str() == "");
     }
 }
+
+TEST_CASE("String - Small string optimization", "[string][sso]") {
+    SECTION("Short strings stay inline") {
+        const size_t allocations = MemoryTrace::global_get_allocation_count();
+
+        String str("channel.render");
+        REQUIRE(str.is_inline());
+        REQUIRE(str.capacity() == String::inline_capacity);
+
+        String copy = str;
+        copy.append(".frame");
+        REQUIRE(copy.size() == 20);
+        REQUIRE(copy.is_inline());
+        REQUIRE(MemoryTrace::global_get_allocation_count() == allocations);
+    }
+
+    SECTION("Growing past the inline capacity moves to the heap") {
+        String str("0123456789012345678901");
+        str.append('2');
+        REQUIRE(str.is_inline());
+
+        str.append("3");
+        REQUIRE_FALSE(str.is_inline());
+        REQUIRE(str.size() == 24);
+        REQUIRE(strcmp(str.data(), "012345678901234567890123") == 0);
+
+        str.clear();
+        REQUIRE(str.empty());
+        REQUIRE(strcmp(str.data(), "") == 0);
+    }
+
+    SECTION("Move steals the heap buffer") {
+        String str("a string long enough to live on the heap");
+        const char* data = str.data();
+
+        String moved(std::move(str));
+        REQUIRE(moved.data() == data);
+        REQUIRE(str.empty());
+        REQUIRE(str.is_inline());
+
+        str = std::move(moved);
+        REQUIRE(str.data() == data);
+        REQUIRE(moved.empty());
+    }
+
+    SECTION("Appends are amortized") {
+        String str;
+        const size_t allocations = MemoryTrace::global_get_allocation_count();
+        for (int32 i = 0; i < 4096; i++) {
+            str.append('x');
+        }
+        REQUIRE(str.size() == 4096);
+        REQUIRE(MemoryTrace::global_get_allocation_count() - allocations <= 10);
+    }
+
+    SECTION("Appending a string to itself") {
+        String str("self");
+        for (int32 i = 0; i < 4; i++) {
+            str.append(str);
+        }
+        REQUIRE(str.size() == 64);
+        REQUIRE(strncmp(str.data() + 60, "self", 4) == 0);
+    }
+
+    SECTION("Equality takes the size into account") {
+        String with_zero("ab");
+        with_zero.append('\0');
+        REQUIRE_FALSE(with_zero == String("ab"));
+        REQUIRE(String("ab") == String("ab"));
+    }
+}
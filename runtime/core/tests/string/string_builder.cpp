@@ -0,0 +1,38 @@
+#include <catch2/catch_all.hpp>
+
+#include <cstring>
+#include "licht/core/memory/memory_trace.hpp"
+#include "licht/core/string/string_builder.hpp"
+
+using namespace licht;
+
+TEST_CASE("StringBuilder - Appends and builds", "[string][builder]") {
+    StringBuilder builder;
+    builder.append("assets").append('/').append(StringRef("models")).append(String("/sponza"));
+    builder.append('.').append("gltf", 4);
+    REQUIRE(builder.size() == 25);
+    REQUIRE(builder.view() == "assets/models/sponza.gltf");
+
+    String path = builder.build();
+    REQUIRE(path == "assets/models/sponza.gltf");
+    REQUIRE(builder.empty());
+
+    builder.append('-', 3);
+    REQUIRE(builder.view() == "---");
+}
+
+TEST_CASE("StringBuilder - Concat allocates once", "[string][builder]") {
+    StringRef projectdir = "/home/user/projects/licht/samples/ludo";
+
+    const size_t allocations = MemoryTrace::global_get_allocation_count();
+    String path = StringBuilder::concat(projectdir, "/assets/shaders/", String("ludo.material"), '.', "vert");
+    REQUIRE(MemoryTrace::global_get_allocation_count() - allocations == 1);
+
+    REQUIRE(path == "/home/user/projects/licht/samples/ludo/assets/shaders/ludo.material.vert");
+    REQUIRE(path.size() == strlen(path.data()));
+
+    const size_t concat_allocations = MemoryTrace::global_get_allocation_count();
+    String joined = projectdir + "/assets";
+    REQUIRE(MemoryTrace::global_get_allocation_count() - concat_allocations == 1);
+    REQUIRE(joined == "/home/user/projects/licht/samples/ludo/assets");
+}
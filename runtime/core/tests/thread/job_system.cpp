@@ -0,0 +1,88 @@
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+
+#include "licht/core/thread/job_system.hpp"
+
+using namespace licht;
+
+TEST_CASE("JobSystem - Waits for every job of a counter", "[JobSystem]") {
+    const size_t worker_count = GENERATE(size_t(0), size_t(1), size_t(4));
+    JobSystem jobs(worker_count);
+
+    std::atomic<uint32> run_count = 0;
+    JobCounter counter;
+    for (uint32 i = 0; i < 1000; i++) {
+        jobs.run([&run_count]() { run_count.fetch_add(1, std::memory_order_relaxed); }, &counter);
+    }
+
+    jobs.wait(counter);
+    REQUIRE(counter.is_done());
+    REQUIRE(run_count.load() == 1000);
+}
+
+TEST_CASE("JobSystem - Jobs spawning and waiting on jobs", "[JobSystem]") {
+    JobSystem jobs(3);
+
+    // Recursive fan-out: each job spawns two children and waits for them, which only works
+    // if a waiting worker runs other jobs.
+    std::atomic<uint32> leaf_count = 0;
+    Function<void(uint32)> spawn = [&](uint32 depth) {
+        if (depth == 0) {
+            leaf_count.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        JobCounter children;
+        jobs.run([&spawn, depth]() { spawn(depth - 1); }, &children);
+        jobs.run([&spawn, depth]() { spawn(depth - 1); }, &children);
+        jobs.wait(children);
+    };
+
+    JobCounter root;
+    jobs.run([&spawn]() { spawn(10); }, &root);
+    jobs.wait(root);
+
+    REQUIRE(leaf_count.load() == 1024);
+}
+
+TEST_CASE("JobSystem - run_after starts jobs once their dependency is done", "[JobSystem]") {
+    const size_t worker_count = GENERATE(size_t(0), size_t(4));
+    JobSystem jobs(worker_count);
+
+    std::atomic<uint32> first_stage_count = 0;
+    std::atomic<bool> second_stage_saw_all = false;
+
+    JobCounter first_stage;
+    JobCounter second_stage;
+
+    for (uint32 i = 0; i < 64; i++) {
+        jobs.run([&first_stage_count]() { first_stage_count.fetch_add(1); }, &first_stage);
+    }
+
+    jobs.run_after(first_stage, [&]() {
+        second_stage_saw_all.store(first_stage_count.load() == 64);
+    }, &second_stage);
+
+    jobs.wait(second_stage);
+    REQUIRE(second_stage_saw_all.load());
+    jobs.wait(first_stage);
+
+    // A dependency already done runs the job right away.
+    JobCounter third_stage;
+    bool third_ran = false;
+    jobs.run_after(first_stage, [&third_ran]() { third_ran = true; }, &third_stage);
+    jobs.wait(third_stage);
+    REQUIRE(third_ran);
+}
+
+TEST_CASE("JobSystem - Stop runs the jobs left", "[JobSystem]") {
+    std::atomic<uint32> run_count = 0;
+    {
+        JobSystem jobs(2);
+        for (uint32 i = 0; i < 500; i++) {
+            jobs.run([&run_count]() { run_count.fetch_add(1, std::memory_order_relaxed); });
+        }
+    }
+    REQUIRE(run_count.load() == 500);
+}
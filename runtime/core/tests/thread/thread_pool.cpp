@@ -0,0 +1,93 @@
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+
+#include "licht/core/thread/thread_pool.hpp"
+
+using namespace licht;
+
+TEST_CASE("ThreadPool - Runs every submitted task before stopping", "[ThreadPool]") {
+    std::atomic<uint32> run_count = 0;
+    {
+        ThreadPool pool(3);
+        REQUIRE(pool.get_concurrency() == 4);
+
+        for (uint32 i = 0; i < 1000; i++) {
+            pool.submit([&run_count]() { run_count.fetch_add(1, std::memory_order_relaxed); });
+        }
+    }
+    REQUIRE(run_count.load() == 1000);
+}
+
+TEST_CASE("ThreadPool - Without workers, runs on the caller", "[ThreadPool]") {
+    ThreadPool pool;
+    REQUIRE_FALSE(pool.is_running());
+
+    uint32 value = 0;
+    pool.submit([&value]() { value = 42; });
+    REQUIRE(value == 42);
+
+    uint64 sum = 0;
+    pool.run_parallel(100, [&sum](size_t i) { sum += i; });
+    REQUIRE(sum == 4950);
+}
+
+TEST_CASE("ThreadPool - run_parallel calls each index once, nested included", "[ThreadPool]") {
+    const size_t worker_count = GENERATE(size_t(1), size_t(4));
+    ThreadPool pool(worker_count);
+
+    constexpr size_t outer_count = 16;
+    constexpr size_t inner_count = 256;
+    std::atomic<uint32> calls[outer_count * inner_count] = {};
+
+    pool.run_parallel(outer_count, [&](size_t outer) {
+        pool.run_parallel(inner_count, [&](size_t inner) {
+            calls[outer * inner_count + inner].fetch_add(1, std::memory_order_relaxed);
+        });
+    });
+
+    bool all_called_once = true;
+    for (const std::atomic<uint32>& call : calls) {
+        all_called_once &= call.load() == 1;
+    }
+    REQUIRE(all_called_once);
+}
+
+TEST_CASE("ThreadPool - Restarts after a stop", "[ThreadPool]") {
+    ThreadPool pool(2);
+    pool.stop();
+    REQUIRE_FALSE(pool.is_running());
+
+    pool.start(2);
+    REQUIRE(pool.get_worker_count() == 2);
+
+    std::atomic<uint32> run_count = 0;
+    pool.run_parallel(64, [&run_count](size_t) { run_count.fetch_add(1, std::memory_order_relaxed); });
+    REQUIRE(run_count.load() == 64);
+}
+
+TEST_CASE("ThreadPool - Runs its tasks on the workers of a job system", "[ThreadPool]") {
+    JobSystem jobs(3);
+    ThreadPool pool;
+    pool.start(jobs);
+    REQUIRE(pool.is_running());
+    REQUIRE(pool.get_concurrency() == 4);
+
+    std::atomic<uint32> run_count = 0;
+    pool.run_parallel(64, [&run_count](size_t) { run_count.fetch_add(1, std::memory_order_relaxed); });
+    REQUIRE(run_count.load() == 64);
+
+    // Nested in a job, the worker waiting on `run_parallel` runs jobs meanwhile.
+    std::atomic<uint32> nested_count = 0;
+    JobCounter counter;
+    for (uint32 i = 0; i < 8; i++) {
+        jobs.run([&]() {
+            pool.run_parallel(32, [&](size_t) { nested_count.fetch_add(1, std::memory_order_relaxed); });
+        }, &counter);
+    }
+    jobs.wait(counter);
+    REQUIRE(nested_count.load() == 8 * 32);
+
+    pool.stop();
+    REQUIRE_FALSE(pool.is_running());
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "licht/engine/engine_exports.hpp"
+#include "licht/engine/engine_loop.hpp"
 #include "licht/core/containers/array.hpp"
 #include "licht/core/modules/module_manifest.hpp"
 #include "licht/core/string/string_ref.hpp"
@@ -21,6 +22,8 @@ public:
 
     ModuleManifest& get_manifest();
 
+    EngineLoop& get_loop();
+
 public:
     Engine();
     ~Engine() = default;
@@ -34,6 +37,7 @@ public:
 private:
     Array<const ModuleManifestInformation*> ordered_module_informations_;
     ModuleManifest manifest_;
+    EngineLoop loop_;
     
     StringRef project_directory_;
 };
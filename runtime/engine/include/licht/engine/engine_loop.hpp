@@ -1 +1,39 @@
 #pragma once
+
+#include "licht/core/defines.hpp"
+#include "licht/engine/engine_exports.hpp"
+#include "licht/engine/frame_graph.hpp"
+
+namespace licht {
+
+/**
+ * @brief Ticks a frame: resumes the coroutines waiting for it, then runs the systems of the frame graph.
+ */
+class LICHT_ENGINE_API EngineLoop {
+public:
+    void tick(float64 delta_time);
+
+    /**
+     * @brief Finishes the frame the pipeline holds, to call before tearing down what the systems use.
+     */
+    void flush();
+
+    inline FrameGraph& get_frame_graph() {
+        return frame_graph_;
+    }
+
+public:
+    EngineLoop() = default;
+    ~EngineLoop() = default;
+
+    EngineLoop(const EngineLoop&) = delete;
+    EngineLoop(EngineLoop&&) = delete;
+
+    EngineLoop& operator=(const EngineLoop&) = delete;
+    EngineLoop& operator=(EngineLoop&&) = delete;
+
+private:
+    FrameGraph frame_graph_;
+};
+
+}  //namespace licht
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "licht/core/containers/array.hpp"
+#include "licht/core/defines.hpp"
+#include "licht/core/function/function.hpp"
+#include "licht/core/string/name.hpp"
+#include "licht/core/thread/job_system.hpp"
+#include "licht/engine/engine_exports.hpp"
+
+namespace licht {
+
+/**
+ * @brief Half of a frame a system belongs to. When the graph is pipelined, the render stage of frame N
+ * runs at the same time as the simulation stage of frame N + 1.
+ */
+enum class FrameStage : uint8 {
+    Simulation,
+    Render,
+};
+
+enum class FrameSystemThread : uint8 {
+    /**
+     * @brief Runs on any worker of the job system.
+     */
+    Any,
+    /**
+     * @brief Runs on the thread ticking the frame, e.g. to poll the window or present.
+     */
+    Main,
+};
+
+struct FrameContext {
+    /**
+     * @brief Frame the stage is working on. Pipelined render systems see the index of the frame they render,
+     * one behind the simulation, and can pick the matching half of a double-buffered snapshot with it.
+     */
+    uint64 frame_index = 0;
+    float64 delta_time = 0.0;
+};
+
+using FrameSystemFunction = Function<void(const FrameContext&)>;
+
+/**
+ * @brief A unit of per-frame work and the resources it touches. Resources are plain names: two systems
+ * conflict when one writes a resource the other reads or writes.
+ */
+struct FrameSystemDescription {
+    Name name;
+    FrameSystemFunction function;
+    Array<Name> reads;
+    Array<Name> writes;
+    FrameStage stage = FrameStage::Simulation;
+    FrameSystemThread thread = FrameSystemThread::Any;
+};
+
+/**
+ * @brief Runs the systems of a frame as a DAG on the job system.
+ *
+ * Within a stage, a system runs after every system added before it that it conflicts with,
+ * i.e. the registration order is the order of conflicting systems, and independent systems run in parallel.
+ * Without pipelining, the render stage is ordered after the simulation stage the same way.
+ * The DAG is rebuilt on the first frame after the systems change.
+ */
+class LICHT_ENGINE_API FrameGraph {
+public:
+    void add_system(FrameSystemDescription description);
+
+    void remove_system(Name name);
+
+    bool has_system(Name name) const;
+
+    /**
+     * @brief Overlaps the render stage of frame N with the simulation stage of frame N + 1.
+     * Render systems must then only read what the simulation handed them for their frame.
+     */
+    void set_pipelined(bool pipelined);
+
+    inline bool is_pipelined() const {
+        return pipelined_;
+    }
+
+    /**
+     * @brief Runs the simulation stage of the next frame, and the render stage of that frame,
+     * or of the previous one when pipelined. Returns once both are done.
+     */
+    void run_frame(float64 delta_time, JobSystem& job_system = JobSystem::get_instance());
+
+    /**
+     * @brief Renders the last simulated frame if the pipeline holds one, e.g. before shutting down.
+     */
+    void flush(JobSystem& job_system = JobSystem::get_instance());
+
+    /**
+     * @brief Number of frames simulated so far.
+     */
+    inline uint64 get_frame_index() const {
+        return frame_index_;
+    }
+
+    /**
+     * @brief Systems `name` waits for in the current DAG.
+     */
+    Array<Name> get_dependencies(Name name);
+
+public:
+    FrameGraph() = default;
+    ~FrameGraph() = default;
+
+    FrameGraph(const FrameGraph&) = delete;
+    FrameGraph(FrameGraph&&) = delete;
+
+    FrameGraph& operator=(const FrameGraph&) = delete;
+    FrameGraph& operator=(FrameGraph&&) = delete;
+
+private:
+    struct Node {
+        Array<uint32> successors;
+        Array<uint32> predecessors;
+    };
+
+    struct Execution;
+
+    void compile();
+    void link_stage_nodes(const Array<uint32>& order);
+
+    void execute(const FrameContext* simulation_context, const FrameContext* render_context, JobSystem& job_system);
+
+private:
+    Array<FrameSystemDescription> systems_;
+    Array<Node> nodes_;
+
+    uint64 frame_index_ = 0;
+    float64 last_delta_time_ = 0.0;
+    bool has_pending_render_ = false;
+    bool pipelined_ = false;
+    bool dirty_ = true;
+};
+
+}  //namespace licht
@@ -2,6 +2,8 @@
 
 #include "licht/engine/engine_exports.hpp"
 #include "licht/core/containers/hash_map.hpp"
+#include "licht/core/string/name.hpp"
+#include "licht/core/string/string.hpp"
 #include "licht/core/string/string_ref.hpp"
 
 namespace licht {
@@ -10,11 +12,11 @@ class LICHT_ENGINE_API ProjectSettings {
 public:
     static ProjectSettings& get_instance();
 
-    StringRef get_name(StringRef name);
-    void insert(StringRef name, StringRef value);
+    StringRef get_name(Name name);
+    void insert(Name name, StringRef value);
 
 private:
-    HashMap<StringRef, String> settings_names;
+    HashMap<Name, String> settings_names;
 };
 
 }
\ No newline at end of file
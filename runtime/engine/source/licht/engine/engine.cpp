@@ -1,5 +1,7 @@
 #include "licht/engine/engine.hpp"
 #include "licht/engine/project_settings.hpp"
+#include "licht/core/thread/job_system.hpp"
+#include "licht/core/thread/thread_pool.hpp"
 
 namespace licht {
 
@@ -13,11 +15,15 @@ Engine& Engine::get_instance() {
 }
 
 void Engine::startup() {
-
+    JobSystem::get_instance().start(JobSystem::get_default_worker_count());
+    // The pool runs its tasks on the job workers: one worker per core for the frame and for `parallel_for` alike.
+    ThreadPool::get_instance().start(JobSystem::get_instance());
 }
 
 void Engine::shutdown() {
-
+    loop_.flush();
+    ThreadPool::get_instance().stop();
+    JobSystem::get_instance().stop();
 }
 
 StringRef Engine::get_project_directory() {
@@ -36,4 +42,8 @@ ModuleManifest& Engine::get_manifest() {
     return manifest_;
 }
 
+EngineLoop& Engine::get_loop() {
+    return loop_;
+}
+
 }  //namespace licht
\ No newline at end of file
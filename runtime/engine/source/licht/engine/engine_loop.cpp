@@ -0,0 +1,19 @@
+#include "licht/engine/engine_loop.hpp"
+#include "licht/core/async/frame_scheduler.hpp"
+#include "licht/core/memory/memory_trace.hpp"
+
+namespace licht {
+
+void EngineLoop::tick(float64 delta_time) {
+    MemoryTrace::global_mark_frame();
+    MemoryTagScope memory_tag(MemoryTag::Engine);
+
+    FrameScheduler::get_instance().tick();
+    frame_graph_.run_frame(delta_time);
+}
+
+void EngineLoop::flush() {
+    frame_graph_.flush();
+}
+
+}  //namespace licht
@@ -0,0 +1,265 @@
+#include "licht/engine/frame_graph.hpp"
+#include "licht/core/containers/hash_map.hpp"
+#include "licht/core/platform/cpu.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <utility>
+
+namespace licht {
+
+/**
+ * @brief State of one run of the DAG. A system is dispatched once all its predecessors are done;
+ * the thread running `run_frame` drains the main-thread systems and helps with the jobs in the meantime.
+ */
+struct FrameGraph::Execution {
+    FrameGraph& graph;
+    JobSystem& job_system;
+
+    /**
+     * @brief Context of each stage, null for a stage skipped this time.
+     */
+    const FrameContext* contexts[2];
+
+    Array<std::atomic<uint32>> remaining_predecessors;
+    std::atomic<uint32> unfinished_count;
+
+    std::mutex main_thread_mutex;
+    Array<uint32> main_thread_ready;
+
+    Execution(FrameGraph& in_graph, JobSystem& in_job_system, const FrameContext* simulation_context, const FrameContext* render_context)
+        : graph(in_graph)
+        , job_system(in_job_system)
+        , contexts{simulation_context, render_context}
+        , remaining_predecessors(in_graph.systems_.size())
+        , unfinished_count(static_cast<uint32>(in_graph.systems_.size())) {
+        for (const Node& node : graph.nodes_) {
+            remaining_predecessors.emplace_back(static_cast<uint32>(node.predecessors.size()));
+        }
+    }
+
+    const FrameContext* get_context(uint32 index) const {
+        return contexts[static_cast<uint8>(graph.systems_[index].stage)];
+    }
+
+    void dispatch(uint32 index) {
+        if (!get_context(index)) {
+            complete(index);
+            return;
+        }
+
+        if (graph.systems_[index].thread == FrameSystemThread::Main) {
+            std::lock_guard lock(main_thread_mutex);
+            main_thread_ready.append(index);
+            return;
+        }
+
+        job_system.run([this, index]() { run(index); });
+    }
+
+    void run(uint32 index) {
+        graph.systems_[index].function(*get_context(index));
+        complete(index);
+    }
+
+    void complete(uint32 index) {
+        for (uint32 successor : graph.nodes_[index].successors) {
+            if (remaining_predecessors[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                dispatch(successor);
+            }
+        }
+
+        // Last access to the execution from this system.
+        unfinished_count.fetch_sub(1, std::memory_order_release);
+    }
+
+    bool try_pop_main_thread(uint32& out_index) {
+        std::lock_guard lock(main_thread_mutex);
+        if (main_thread_ready.empty()) {
+            return false;
+        }
+
+        out_index = main_thread_ready.back();
+        main_thread_ready.pop();
+        return true;
+    }
+};
+
+void FrameGraph::add_system(FrameSystemDescription description) {
+    LCHECK_MSG(!has_system(description.name), "A frame system with this name already exists.");
+
+    systems_.append(std::move(description));
+    dirty_ = true;
+}
+
+void FrameGraph::remove_system(Name name) {
+    systems_.remove_if([name](const FrameSystemDescription& system) -> bool {
+        return system.name == name;
+    });
+    dirty_ = true;
+}
+
+bool FrameGraph::has_system(Name name) const {
+    for (const FrameSystemDescription& system : systems_) {
+        if (system.name == name) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void FrameGraph::set_pipelined(bool pipelined) {
+    if (pipelined_ != pipelined) {
+        pipelined_ = pipelined;
+        dirty_ = true;
+    }
+}
+
+void FrameGraph::run_frame(float64 delta_time, JobSystem& job_system) {
+    if (!pipelined_ && has_pending_render_) {
+        flush(job_system);
+    }
+
+    if (dirty_) {
+        compile();
+    }
+
+    const FrameContext simulation_context = {frame_index_, delta_time};
+
+    if (pipelined_) {
+        const FrameContext render_context = {frame_index_ - 1, last_delta_time_};
+        execute(&simulation_context, has_pending_render_ ? &render_context : nullptr, job_system);
+        has_pending_render_ = true;
+    } else {
+        execute(&simulation_context, &simulation_context, job_system);
+    }
+
+    last_delta_time_ = delta_time;
+    frame_index_++;
+}
+
+void FrameGraph::flush(JobSystem& job_system) {
+    if (!has_pending_render_) {
+        return;
+    }
+
+    if (dirty_) {
+        compile();
+    }
+
+    const FrameContext render_context = {frame_index_ - 1, last_delta_time_};
+    execute(nullptr, &render_context, job_system);
+    has_pending_render_ = false;
+}
+
+Array<Name> FrameGraph::get_dependencies(Name name) {
+    if (dirty_) {
+        compile();
+    }
+
+    Array<Name> dependencies;
+    for (uint32 i = 0; i < systems_.size(); i++) {
+        if (systems_[i].name == name) {
+            for (uint32 predecessor : nodes_[i].predecessors) {
+                dependencies.append(systems_[predecessor].name);
+            }
+        }
+    }
+    return dependencies;
+}
+
+void FrameGraph::compile() {
+    nodes_.clear();
+    nodes_.resize(systems_.size());
+
+    Array<uint32> simulation_order;
+    Array<uint32> render_order;
+    for (uint32 i = 0; i < systems_.size(); i++) {
+        if (systems_[i].stage == FrameStage::Simulation) {
+            simulation_order.append(i);
+        } else {
+            render_order.append(i);
+        }
+    }
+
+    if (pipelined_) {
+        // The stages of a frame never run together, no edge between them.
+        link_stage_nodes(simulation_order);
+        link_stage_nodes(render_order);
+    } else {
+        for (uint32 index : render_order) {
+            simulation_order.append(index);
+        }
+        link_stage_nodes(simulation_order);
+    }
+
+    dirty_ = false;
+}
+
+void FrameGraph::link_stage_nodes(const Array<uint32>& order) {
+    HashMap<Name, uint32> last_writers;
+    HashMap<Name, Array<uint32>> readers_since_write;
+
+    auto add_edge = [this](uint32 from, uint32 to) {
+        if (from == to || nodes_[to].predecessors.contains(from)) {
+            return;
+        }
+        nodes_[to].predecessors.append(from);
+        nodes_[from].successors.append(to);
+    };
+
+    for (uint32 index : order) {
+        const FrameSystemDescription& system = systems_[index];
+
+        // Read after write.
+        for (const Name& resource : system.reads) {
+            if (const uint32* writer = last_writers.get_ptr(resource)) {
+                add_edge(*writer, index);
+            }
+            readers_since_write[resource].append(index);
+        }
+
+        // Write after write and write after read.
+        for (const Name& resource : system.writes) {
+            if (const uint32* writer = last_writers.get_ptr(resource)) {
+                add_edge(*writer, index);
+            }
+            if (Array<uint32>* readers = readers_since_write.get_ptr(resource)) {
+                for (uint32 reader : *readers) {
+                    add_edge(reader, index);
+                }
+                readers->clear();
+            }
+            last_writers[resource] = index;
+        }
+    }
+}
+
+void FrameGraph::execute(const FrameContext* simulation_context, const FrameContext* render_context, JobSystem& job_system) {
+    if (systems_.empty()) {
+        return;
+    }
+
+    Execution execution(*this, job_system, simulation_context, render_context);
+
+    for (uint32 i = 0; i < systems_.size(); i++) {
+        if (nodes_[i].predecessors.empty()) {
+            execution.dispatch(i);
+        }
+    }
+
+    SpinWait spin;
+    while (execution.unfinished_count.load(std::memory_order_acquire) != 0) {
+        uint32 index = 0;
+        if (execution.try_pop_main_thread(index)) {
+            execution.run(index);
+            spin.reset();
+        } else if (job_system.try_run_one_job()) {
+            spin.reset();
+        } else {
+            spin.wait();
+        }
+    }
+}
+
+}  //namespace licht
@@ -7,12 +7,13 @@ ProjectSettings& ProjectSettings::get_instance() {
     return settings;
 }
 
-StringRef ProjectSettings::get_name(StringRef name) {
-    return settings_names[name];
+StringRef ProjectSettings::get_name(Name name) {
+    const String* value = settings_names.get_ptr(name);
+    return value ? StringRef(*value) : StringRef();
 }
 
-void ProjectSettings::insert(StringRef name, StringRef value) {
-    settings_names[name] = String(value);
+void ProjectSettings::insert(Name name, StringRef value) {
+    settings_names.put(name, String(value));
 }
 
 }  //namespace licht
\ No newline at end of file
@@ -0,0 +1,160 @@
+#include <catch2/catch_all.hpp>
+
+#include <atomic>
+
+#include "licht/core/thread/job_system.hpp"
+#include "licht/engine/frame_graph.hpp"
+
+using namespace licht;
+
+namespace {
+
+/**
+ * @brief Records the position at which each system ran in the frame.
+ */
+struct RunOrder {
+    std::atomic<uint32> next = 0;
+    std::atomic<uint32> positions[8] = {};
+
+    FrameSystemFunction record(uint32 system) {
+        return [this, system](const FrameContext&) -> void {
+            positions[system].store(next.fetch_add(1) + 1);
+        };
+    }
+
+    uint32 get(uint32 system) const {
+        return positions[system].load();
+    }
+};
+
+FrameSystemDescription make_system(const char* name, FrameSystemFunction function, Array<Name> reads, Array<Name> writes) {
+    FrameSystemDescription description;
+    description.name = Name(name);
+    description.function = std::move(function);
+    description.reads = std::move(reads);
+    description.writes = std::move(writes);
+    return description;
+}
+
+}  // namespace
+
+TEST_CASE("FrameGraph - Conflicting systems depend on the ones registered before them", "[FrameGraph]") {
+    FrameGraph graph;
+    graph.add_system(make_system("writer", nullptr, {}, {Name("transforms")}));
+    graph.add_system(make_system("reader", nullptr, {Name("transforms")}, {}));
+    graph.add_system(make_system("rewriter", nullptr, {}, {Name("transforms")}));
+    graph.add_system(make_system("independent", nullptr, {Name("audio")}, {Name("mixer")}));
+
+    // Read after write.
+    Array<Name> reader_dependencies = graph.get_dependencies(Name("reader"));
+    REQUIRE(reader_dependencies.size() == 1);
+    REQUIRE(reader_dependencies.contains(Name("writer")));
+
+    // Write after write and write after read.
+    Array<Name> rewriter_dependencies = graph.get_dependencies(Name("rewriter"));
+    REQUIRE(rewriter_dependencies.size() == 2);
+    REQUIRE(rewriter_dependencies.contains(Name("writer")));
+    REQUIRE(rewriter_dependencies.contains(Name("reader")));
+
+    REQUIRE(graph.get_dependencies(Name("writer")).empty());
+    REQUIRE(graph.get_dependencies(Name("independent")).empty());
+}
+
+TEST_CASE("FrameGraph - Readers of the same resource do not depend on each other", "[FrameGraph]") {
+    FrameGraph graph;
+    graph.add_system(make_system("writer", nullptr, {}, {Name("transforms")}));
+    graph.add_system(make_system("first_reader", nullptr, {Name("transforms")}, {}));
+    graph.add_system(make_system("second_reader", nullptr, {Name("transforms")}, {}));
+
+    Array<Name> dependencies = graph.get_dependencies(Name("second_reader"));
+    REQUIRE(dependencies.size() == 1);
+    REQUIRE(dependencies.contains(Name("writer")));
+}
+
+TEST_CASE("FrameGraph - The dependencies follow the removed systems", "[FrameGraph]") {
+    FrameGraph graph;
+    graph.add_system(make_system("writer", nullptr, {}, {Name("transforms")}));
+    graph.add_system(make_system("reader", nullptr, {Name("transforms")}, {}));
+    REQUIRE(graph.get_dependencies(Name("reader")).size() == 1);
+
+    graph.remove_system(Name("writer"));
+    REQUIRE_FALSE(graph.has_system(Name("writer")));
+    REQUIRE(graph.get_dependencies(Name("reader")).empty());
+}
+
+TEST_CASE("FrameGraph - Conflicting systems run in registration order", "[FrameGraph]") {
+    const size_t worker_count = GENERATE(size_t(0), size_t(4));
+    JobSystem jobs(worker_count);
+
+    RunOrder order;
+    FrameGraph graph;
+    graph.add_system(make_system("writer", order.record(0), {}, {Name("transforms")}));
+    graph.add_system(make_system("first_reader", order.record(1), {Name("transforms")}, {}));
+    graph.add_system(make_system("second_reader", order.record(2), {Name("transforms")}, {}));
+    graph.add_system(make_system("rewriter", order.record(3), {}, {Name("transforms")}));
+    graph.add_system(make_system("last_reader", order.record(4), {Name("transforms")}, {}));
+
+    for (uint32 frame = 0; frame < 100; frame++) {
+        graph.run_frame(0.016, jobs);
+
+        REQUIRE(order.get(0) < order.get(1));
+        REQUIRE(order.get(0) < order.get(2));
+        REQUIRE(order.get(1) < order.get(3));
+        REQUIRE(order.get(2) < order.get(3));
+        REQUIRE(order.get(3) < order.get(4));
+        order.next = 0;
+    }
+}
+
+TEST_CASE("FrameGraph - The render stage runs after the simulation when not pipelined", "[FrameGraph]") {
+    JobSystem jobs(2);
+
+    RunOrder order;
+    FrameGraph graph;
+
+    FrameSystemDescription render_system = make_system("render", order.record(0), {Name("camera")}, {});
+    render_system.stage = FrameStage::Render;
+    render_system.thread = FrameSystemThread::Main;
+    graph.add_system(std::move(render_system));
+
+    graph.add_system(make_system("camera", order.record(1), {}, {Name("camera")}));
+
+    REQUIRE(graph.get_dependencies(Name("render")).contains(Name("camera")));
+
+    graph.run_frame(0.016, jobs);
+    REQUIRE(order.get(1) < order.get(0));
+    REQUIRE(graph.get_frame_index() == 1);
+}
+
+TEST_CASE("FrameGraph - Pipelined render systems see the previous frame", "[FrameGraph]") {
+    JobSystem jobs(2);
+
+    std::atomic<uint32> render_count = 0;
+    std::atomic<uint64> rendered_frame = 0;
+
+    FrameGraph graph;
+    graph.set_pipelined(true);
+    graph.add_system(make_system("simulation", [](const FrameContext&) -> void {}, {}, {Name("snapshot")}));
+
+    FrameSystemDescription render_system = make_system("render", nullptr, {Name("snapshot")}, {});
+    render_system.stage = FrameStage::Render;
+    render_system.function = [&](const FrameContext& context) -> void {
+        rendered_frame = context.frame_index;
+        render_count++;
+    };
+    graph.add_system(std::move(render_system));
+
+    // The stages of a frame never run together, so no edge between them.
+    REQUIRE(graph.get_dependencies(Name("render")).empty());
+
+    graph.run_frame(0.016, jobs);
+    REQUIRE(render_count == 0);
+
+    graph.run_frame(0.016, jobs);
+    REQUIRE(render_count == 1);
+    REQUIRE(rendered_frame == 0);
+
+    graph.flush(jobs);
+    REQUIRE(render_count == 2);
+    REQUIRE(rendered_frame == 1);
+}
@@ -10,4 +10,19 @@ target("licht.engine", function()
     })
 
     add_defines("LICHT_ENGINE_EXPORTS")
-end)
\ No newline at end of file
+end)
+
+target("licht.engine.tests", function()
+    set_kind("binary")
+    set_group("engine.tests")
+
+    add_deps("licht.engine")
+
+    add_packages("catch2")
+
+    add_includedirs("tests")
+
+    add_files("tests/**.cpp")
+
+    add_defines("LICHT_ENGINE_EXPORTS")
+end)
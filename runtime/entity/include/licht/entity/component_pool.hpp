@@ -56,11 +56,11 @@ public:
         storage_.clear();
     }
 
-    const SparseSet<ComponentType, Entity>& storage() const {
+    const SparseSet<ComponentType, Entity, uint32>& storage() const {
         return storage_;
     }
 
-    SparseSet<ComponentType, Entity>& storage() {
+    SparseSet<ComponentType, Entity, uint32>& storage() {
         return storage_;
     }
 
@@ -69,6 +69,6 @@ public:
     }
 
 private:
-    SparseSet<ComponentType, Entity> storage_;
+    SparseSet<ComponentType, Entity, uint32> storage_;
 };
 }  //namespace licht
\ No newline at end of file
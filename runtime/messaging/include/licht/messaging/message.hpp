@@ -3,13 +3,16 @@
 #include "licht/core/containers/array.hpp"
 #include "licht/core/memory/shared_ref.hpp"
 #include "licht/core/memory/shared_ref_cast.hpp"
-#include "licht/core/string/string.hpp"
+#include "licht/core/string/name.hpp"
 #include "message_exports.hpp"
 #include "message_receiver.hpp"
 
 namespace licht {
 
-using MessageAddress = String;
+/**
+ * @brief Interned so that routing a message compares ids rather than characters.
+ */
+using MessageAddress = Name;
 
 struct LICHT_MESSAGING_API Message {
     virtual ~Message() = default;
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "licht/core/containers/hash_map.hpp"
+#include "licht/core/memory/local_ref.hpp"
 #include "licht/core/memory/shared_ref.hpp"
 #include "licht/messaging/message.hpp"
 #include "licht/messaging/message_receiver.hpp"
@@ -12,13 +13,13 @@ class LICHT_MESSAGING_API MessageBus {
 public:
     static MessageBus& get_instance();
 
-    void register_receiver(const MessageAddress& address, const SharedRef<MessageReceiver>& receiver);
+    void register_receiver(MessageAddress address, const SharedRef<MessageReceiver>& receiver);
 
-    void unregister_receiver(const MessageAddress& address);
+    void unregister_receiver(MessageAddress address);
 
-    void send(const MessageAddress& address, const SharedRef<Message>& message);
+    void send(MessageAddress address, const SharedRef<Message>& message);
 
-    void dispatch(const MessageAddress& address);
+    void dispatch(MessageAddress address);
 
     void process_messages();
 
@@ -27,7 +28,10 @@ public:
     
 private:
     HashMap<MessageAddress, Array<SharedRef<MessageReceiver>>> receivers_;
-    Array<SharedRef<MessageContext>> pending_messages_; 
+    /**
+     * @brief Contexts never leave the thread using the bus, their references are counted without atomics.
+     */
+    Array<LocalRef<MessageContext>> pending_messages_;
 };
 
 }
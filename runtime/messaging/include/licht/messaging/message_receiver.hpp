@@ -1,6 +1,6 @@
 #pragma once
 
-#include "licht/core/memory/shared_ref.hpp"
+#include "licht/core/memory/local_ref.hpp"
 #include "message_exports.hpp"
 
 namespace licht {
@@ -9,7 +9,10 @@ class MessageContext;
 
 class LICHT_MESSAGING_API MessageReceiver {
 public:
-    virtual void receive_message(const SharedRef<MessageContext>& context) = 0; 
+    /**
+     * @brief Called on the thread using the bus, `LocalRef::to_shared` hands the context over to other threads.
+     */
+    virtual void receive_message(const LocalRef<MessageContext>& context) = 0;
 
     virtual ~MessageReceiver() = default;
 };
@@ -1,4 +1,6 @@
 #include "licht/messaging/message_bus.hpp"
+#include "licht/core/memory/memory_trace.hpp"
+#include "licht/core/memory/local_ref.hpp"
 #include "licht/core/memory/shared_ref.hpp"
 
 #include "message_impl.hpp"
@@ -10,30 +12,33 @@ MessageBus::MessageBus()
     , pending_messages_(1024) {
 }
 
-void MessageBus::register_receiver(const MessageAddress& address, const SharedRef<MessageReceiver>& receiver) {
+void MessageBus::register_receiver(MessageAddress address, const SharedRef<MessageReceiver>& receiver) {
+    MemoryTagScope memory_tag(MemoryTag::Messaging);
+
     receivers_.get_or_add(address, Array<SharedRef<MessageReceiver>>()).append(receiver);
 }
 
-void MessageBus::unregister_receiver(const MessageAddress& receiver) {
-    receivers_.remove(receiver);
+void MessageBus::unregister_receiver(MessageAddress address) {
+    receivers_.remove(address);
 }
 
-void MessageBus::send(const MessageAddress& address, const SharedRef<Message>& message) {
+void MessageBus::send(MessageAddress address, const SharedRef<Message>& message) {
+    MemoryTagScope memory_tag(MemoryTag::Messaging);
+
     Array<MessageAddress> receipents;  // TODO:
-    pending_messages_.append(new_ref<MessageContextImpl>(receipents, address, message));
+    pending_messages_.append(new_local_ref<MessageContextImpl>(receipents, address, message));
 }
 
-void MessageBus::dispatch(const MessageAddress& address) {
-    Array<SharedRef<MessageContext>> to_dispatch(1024);
+void MessageBus::dispatch(MessageAddress address) {
+    Array<LocalRef<MessageContext>> to_dispatch;
 
-    for (auto it = pending_messages_.begin(); it != pending_messages_.end();) {
-        if ((*it)->get_sender() == address) {
-            to_dispatch.push_back(*it);
-            pending_messages_.remove(*it);
-        } else {
-            ++it;
+    pending_messages_.remove_if([&](const LocalRef<MessageContext>& context) -> bool {
+        if (context->get_sender() != address) {
+            return false;
         }
-    }
+        to_dispatch.append(context);
+        return true;
+    });
 
     if (auto receipents = receivers_.get_ptr(address)) {
         for (auto& context : to_dispatch) {
@@ -48,7 +53,7 @@ void MessageBus::dispatch(const MessageAddress& address) {
 
 void MessageBus::process_messages() {
     while (!pending_messages_.empty()) {
-        SharedRef<MessageContext> context = pending_messages_.back();
+        LocalRef<MessageContext> context = pending_messages_.back();
         pending_messages_.pop();
         if (auto* it = receivers_.get_ptr(context->get_sender())) {
             for (SharedRef<MessageReceiver>& receiver : *it) {
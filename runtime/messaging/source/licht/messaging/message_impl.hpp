@@ -13,7 +13,7 @@ public:
 
     virtual MessageAddress get_sender() const override;
 
-    MessageContextImpl(const Array<MessageAddress>& receipents, const MessageAddress& sender, const SharedRef<Message>& message)
+    MessageContextImpl(const Array<MessageAddress>& receipents, MessageAddress sender, const SharedRef<Message>& message)
         : receipents_(receipents)
         , sender_(sender)
         , message_(message) {}
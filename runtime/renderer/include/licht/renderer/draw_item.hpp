@@ -1,6 +1,7 @@
 #pragma once
 
 #include "licht/core/containers/array.hpp"
+#include "licht/core/containers/inline_array.hpp"
 #include "licht/core/math/matrix4.hpp"
 #include "licht/renderer/mesh/static_mesh.hpp"
 #include "licht/rhi/buffer.hpp"
@@ -20,16 +21,16 @@ public:
     ~DrawItem() = default;
 
 public:
-    Array<RHIBuffer*> vertex_buffers;
+    InlineArray<RHIBuffer*, 4> vertex_buffers;
     RHIBuffer* index_buffer = nullptr;
     size_t index_start = 0;
     size_t index_count = 0;
     size_t vertex_start = 0;
     size_t vertex_count = 0;
 
-    Array<RHISampler*> samplers;
-    Array<RHITexture*> textures;
-    Array<RHITextureView*> texture_views;
+    InlineArray<RHISampler*, 2> samplers;
+    InlineArray<RHITexture*, 2> textures;
+    InlineArray<RHITextureView*, 2> texture_views;
 
     Array<RHIShaderResourceGroup*> shader_groups;
 
@@ -23,6 +23,8 @@ class LICHT_RENDERER_API StaticMesh {
 public:
     void append_submesh(const StaticSubMesh& submesh);
 
+    void append_submesh(StaticSubMesh&& submesh);
+
     const Array<StaticSubMesh>& get_submeshes() const { return submeshes_; }
 
     Array<StaticSubMesh>& get_submeshes() { return submeshes_; }
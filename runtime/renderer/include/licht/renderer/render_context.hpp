@@ -1,6 +1,8 @@
 #pragma once
 
 #include "licht/core/defines.hpp"
+#include "licht/core/function/inplace_function.hpp"
+#include "licht/core/memory/frame_allocator.hpp"
 #include "licht/core/memory/shared_ref.hpp"
 #include "licht/core/platform/display.hpp"
 #include "licht/core/platform/window_handle.hpp"
@@ -79,8 +81,8 @@ public:
         frame_context_.frame_height = height;
     }
 
-    void on_reset(Function<void()>&& on_reset) {
-        on_reset_ = on_reset;
+    void on_reset(InplaceFunction<void()>&& on_reset) {
+        on_reset_ = std::move(on_reset);
     }
 
     uint32 get_frame_count() const {
@@ -111,6 +113,13 @@ public:
         return graphics_queue_;
     }
 
+    /**
+     * @brief Memory released once the GPU is done with the current frame, see `FrameAllocator`.
+     */
+    FrameAllocator& get_frame_allocator() {
+        return frame_allocator_;
+    }
+
     RHICommandBuffer* get_current_command_buffer() {
         return current_cmd_;
     }
@@ -131,10 +140,13 @@ public:
         : window_handle_(Display::InvalidWindowHandle) {}
 
 private:
+    static constexpr size_t frame_allocator_size = 4 * 1024 * 1024;
+
     SharedRef<RHIDeviceMemoryUploader> uploader_;
-    Function<void()> on_reset_;
+    InplaceFunction<void()> on_reset_;
     WindowHandle window_handle_;
     RHIFrameContext frame_context_;
+    FrameAllocator frame_allocator_;
     RHIDeviceRef device_;
     RHICommandAllocator* command_allocator_;
     RHIBufferPoolRef buffer_pool_;
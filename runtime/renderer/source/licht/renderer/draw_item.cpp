@@ -26,6 +26,8 @@ DrawItem DrawItem::create(SharedRef<RHIDevice> device, RHIDeviceMemoryUploader&
     vertex_buffers[3] = uploader.send_buffer(RHIStagingBufferContext(
         RHIBufferUsageFlags::Vertex, submesh.tangents.size(), submesh.tangents.data()));
 
+    item.vertex_buffers = InlineArray<RHIBuffer*, 4>(vertex_buffers, vertex_buffer_size);
+
     FixedArray<TextureBuffer*, 2> textures = {
         &submesh.material.diffuse_texture,
         &submesh.material.normal_texture,
@@ -49,7 +51,6 @@ DrawItem DrawItem::create(SharedRef<RHIDevice> device, RHIDeviceMemoryUploader&
         tex_desc.height = texture_buffer.height;
         tex_desc.mip_levels = Math::floor(Math::log2(Math::max(tex_desc.width, tex_desc.height))) + 1;
 
-        item.vertex_buffers = Array<RHIBuffer*>(vertex_buffers, vertex_buffer_size);
         item.textures.append(uploader.send_texture(RHIStagingBufferContext(
                                                        RHIBufferUsageFlags::Storage, texture_buffer.data.size(), texture_buffer.data.data()),
                                                    tex_desc));
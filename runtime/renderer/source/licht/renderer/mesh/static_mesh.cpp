@@ -6,4 +6,8 @@ void StaticMesh::append_submesh(const StaticSubMesh& submesh) {
     submeshes_.append(submesh);
 }
 
+void StaticMesh::append_submesh(StaticSubMesh&& submesh) {
+    submeshes_.append(std::move(submesh));
+}
+
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "licht/renderer/mesh/static_mesh_loader.hpp"
+#include "licht/core/algorithm/parallel.hpp"
 #include "licht/core/containers/array.hpp"
 #include "licht/core/defines.hpp"
 #include "licht/core/math/vector3.hpp"
@@ -169,28 +170,32 @@ static void recompute_normals(StaticSubMesh& mesh) {
     Array<Vector3f> normals;
     normals.resize(vertex_count, Vector3f(0.0));
 
-    for (size_t i = 0; i < index_count; i += 3) {
-        uint32 i0 = mesh.indices[i];
-        uint32 i1 = mesh.indices[i + 1];
-        uint32 i2 = mesh.indices[i + 2];
+    // Face normals are computed in parallel, vertices shared between faces are accumulated serially.
+    Array<Vector3f> face_normals;
+    face_normals.resize(index_count / 3, Vector3f(0.0));
 
-        Vector3f v0 = positions[i0];
-        Vector3f v1 = positions[i1];
-        Vector3f v2 = positions[i2];
+    parallel_for(face_normals.size(), [&](size_t face) {
+        Vector3f v0 = positions[mesh.indices[face * 3]];
+        Vector3f v1 = positions[mesh.indices[face * 3 + 1]];
+        Vector3f v2 = positions[mesh.indices[face * 3 + 2]];
 
         Vector3f e1 = v1 - v0;
         Vector3f e2 = v2 - v0;
 
-        Vector3f n = Vector3f::normalize(Vector3f::cross(e1, e2));
+        face_normals[face] = Vector3f::normalize(Vector3f::cross(e1, e2));
+    });
 
-        normals[i0] += n;
-        normals[i1] += n;
-        normals[i2] += n;
+    for (size_t face = 0; face < face_normals.size(); face++) {
+        const Vector3f& n = face_normals[face];
+
+        normals[mesh.indices[face * 3]] += n;
+        normals[mesh.indices[face * 3 + 1]] += n;
+        normals[mesh.indices[face * 3 + 2]] += n;
     }
 
-    for (Vector3f& n : normals) {
+    parallel_for(normals, [](Vector3f& n) {
         n = Vector3f::normalize(n);
-    }
+    });
 
     mesh.normals = Array<uint8>(reinterpret_cast<uint8*>(normals.data()), vertex_count * sizeof(Vector3f));
 }
@@ -257,7 +262,7 @@ static void recompute_tangents(StaticSubMesh& mesh) {
         tan2[i2] += tdir;
     }
 
-    for (size_t i = 0; i < vertex_count; ++i) {
+    parallel_for(vertex_count, [&](size_t i) {
         const Vector3f& n = normals[i];
         const Vector3f& t = tan1[i];
 
@@ -266,7 +271,7 @@ static void recompute_tangents(StaticSubMesh& mesh) {
         float32 w = (Vector3f::dot(Vector3f::cross(n, t), tan2[i]) < 0.0f) ? -1.0f : 1.0f;
 
         tangents[i] = Vector4f(tangent.x, tangent.y, tangent.z, w);
-    }
+    });
 
     mesh.tangents = Array<uint8>(reinterpret_cast<uint8*>(tangents.data()), vertex_count * sizeof(Vector4f));
 }
@@ -345,9 +350,9 @@ static void gltf_create_meshes(tinygltf::Model& model, Array<StaticMesh>& out_me
 
             }
 
-            mesh.append_submesh(submesh);
+            mesh.append_submesh(std::move(submesh));
         }
-        out_meshes.append(mesh);
+        out_meshes.append(std::move(mesh));
     }
 }
 
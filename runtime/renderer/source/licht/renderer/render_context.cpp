@@ -1,3 +1,4 @@
+#include "licht/core/memory/memory_trace.hpp"
 #include "licht/core/memory/shared_ref.hpp"
 #include "licht/core/modules/module_registry.hpp"
 #include "licht/core/platform/display.hpp"
@@ -13,6 +14,7 @@
 namespace licht {
 
 void RenderContext::initialize(WindowHandle window_handle) {
+    MemoryTagScope memory_tag(MemoryTag::Renderer);
 
     ModuleRegistry& registry = ModuleRegistry::get_instance();
     RHIModule* module = registry.get_module<RHIModule>("licht.rhi");
@@ -56,6 +58,8 @@ void RenderContext::initialize(WindowHandle window_handle) {
     for (uint32 i = 0; i < swapchain_->get_texture_views().size(); i++) {
         frame_context_.frame_in_flight_fences.append(nullptr);
     }
+
+    frame_allocator_.initialize(frame_context_.frame_count, frame_allocator_size);
 }
 
 void RenderContext::shutdown() {
@@ -74,9 +78,13 @@ void RenderContext::shutdown() {
     frame_context_.render_finished_semaphores.clear();
     frame_context_.in_flight_fences.clear();
     frame_context_.frame_in_flight_fences.clear();
+
+    frame_allocator_.destroy();
 }
 
 RenderResult RenderContext::begin_frame() {
+    MemoryTagScope memory_tag(MemoryTag::Renderer);
+
     swapchain_->acquire_next_frame(frame_context_);
 
     if (frame_context_.out_of_date) {
@@ -84,6 +92,10 @@ RenderResult RenderContext::begin_frame() {
         return RenderResult::OutOfDate;
     }
 
+    // Once its fence is signaled, the GPU no longer reads what the frame allocated the last time around.
+    device_->wait_fence(frame_context_.in_flight_fences[frame_context_.current_frame]);
+    frame_allocator_.begin_frame(frame_context_.current_frame);
+
     current_cmd_ = command_allocator_->open(frame_context_.current_frame);
     command_allocator_->reset_command_buffer(current_cmd_);
 
@@ -93,6 +105,8 @@ RenderResult RenderContext::begin_frame() {
 }
 
 RenderResult RenderContext::end_frame() {
+    MemoryTagScope memory_tag(MemoryTag::Renderer);
+
     current_cmd_->end();
 
     frame_context_.frame_in_flight_fences[frame_context_.frame_index] =
@@ -100,10 +114,16 @@ RenderResult RenderContext::end_frame() {
 
     device_->reset_fence(frame_context_.in_flight_fences[frame_context_.current_frame]);
 
-    graphics_queue_->submit({current_cmd_},
-                            {frame_context_.current_frame_available_semaphore()},
-                            {frame_context_.current_render_finished_semaphore()},
-                            frame_context_.current_in_flight_fence());
+    // The submit lists live until the frame comes around again, instead of three heap arrays per frame.
+    ArrayView<RHICommandBuffer*> command_buffers = frame_allocator_.copy_array(&current_cmd_, 1);
+
+    ArrayView<RHISemaphore*> wait_semaphores = frame_allocator_.allocate_array<RHISemaphore*>(1);
+    wait_semaphores[0] = frame_context_.current_frame_available_semaphore();
+
+    ArrayView<RHISemaphore*> signal_semaphores = frame_allocator_.allocate_array<RHISemaphore*>(1);
+    signal_semaphores[0] = frame_context_.current_render_finished_semaphore();
+
+    graphics_queue_->submit(command_buffers, wait_semaphores, signal_semaphores, frame_context_.current_in_flight_fence());
 
     present_queue_->present(swapchain_, frame_context_);
 
@@ -1,4 +1,5 @@
 #include "licht/core/string/string.hpp"
+#include "licht/core/string/string_builder.hpp"
 #include "licht/renderer/shader/shader_compiler.hpp"
 #include "licht/core/trace/trace.hpp"
 
@@ -22,13 +23,7 @@ bool SPIRVShaderCompiler::compile_glsl_file(StringRef input_filepath, StringRef
             break;
     }
 
-    String cmd = "glslangValidator ";
-    cmd.append(stage_flag);
-    cmd.append(" ");
-    cmd.append(input_filepath);
-    cmd.append(" -o ");
-    cmd.append(output_filepath);
-    cmd.append(" -Os");
+    String cmd = StringBuilder::concat("glslangValidator ", stage_flag, " ", input_filepath, " -o ", output_filepath, " -Os");
 
     int32 result = std::system(cmd.data());
     
@@ -1,4 +1,5 @@
 #include "licht/rhi_vulkan/vulkan_buffer_pool.hpp"
+#include "licht/core/memory/memory_trace.hpp"
 #include "licht/core/defines.hpp"
 #include "vulkan_buffer_pool.hpp"
 
@@ -9,6 +10,8 @@ void VulkanBufferPool::initialize_pool(Allocator* allocator, size_t block_count)
 }
 
 RHIBuffer* VulkanBufferPool::create_buffer(const RHIBufferDescription& description) {
+    MemoryTagScope memory_tag(MemoryTag::RHI);
+
     VulkanBuffer* vulkan_buffer = pool_.new_resource();
     vulkan_buffer->initialize(description);
     return vulkan_buffer;
@@ -26,6 +29,8 @@ void VulkanBufferPool::dispose() {
 }
 
 void VulkanBufferPool::destroy_vulkan_buffer(VulkanBuffer* vulkan_buffer) {
+    MemoryTagScope memory_tag(MemoryTag::RHI);
+
     vulkan_buffer->destroy();
     pool_.destroy_resource(vulkan_buffer);
 }
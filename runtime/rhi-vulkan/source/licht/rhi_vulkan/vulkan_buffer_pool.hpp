@@ -27,7 +27,7 @@ private:
     void destroy_vulkan_buffer(VulkanBuffer* vulkan_buffer);
 
 private:
-    MemoryPool<VulkanBuffer> pool_;
+    ConcurrentMemoryPool<VulkanBuffer> pool_;
 };
 
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "licht/rhi_vulkan/vulkan_command_buffer.hpp"
 #include "licht/core/containers/array.hpp"
+#include "licht/core/containers/inline_array.hpp"
 #include "licht/core/defines.hpp"
 #include "licht/core/memory/linear_allocator.hpp"
 #include "licht/core/memory/memory.hpp"
@@ -177,13 +178,14 @@ void VulkanCommandBuffer::bind_shader_resource_group(RHIGraphicsPipeline* pipeli
                                         nullptr);
 }
 
-void VulkanCommandBuffer::bind_vertex_buffers(const Array<RHIBuffer*>& buffers) {
-    Array<VkDeviceSize> offsets;
+void VulkanCommandBuffer::bind_vertex_buffers(ArrayView<RHIBuffer*> buffers) {
+    InlineArray<VkDeviceSize, 8> offsets;
     offsets.resize(buffers.size(), 0);
 
-    Array<VkBuffer> vk_buffers = buffers.map<VkBuffer>([](RHIBuffer* buffer_handle) -> VkBuffer {
-        return static_cast<VulkanBuffer*>(buffer_handle)->get_handle();
-    });
+    InlineArray<VkBuffer, 8> vk_buffers(buffers.size());
+    for (RHIBuffer* buffer_handle : buffers) {
+        vk_buffers.append(static_cast<VulkanBuffer*>(buffer_handle)->get_handle());
+    }
 
     VulkanAPI::lvkCmdBindVertexBuffers(command_buffer_,
                                        0,
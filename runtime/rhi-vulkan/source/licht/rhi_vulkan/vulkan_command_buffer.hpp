@@ -28,7 +28,7 @@ public:
 
     virtual void set_shader_constants(RHIGraphicsPipeline* pipeline, const RHIShaderConstants& shader_constants) override;
 
-    virtual void bind_vertex_buffers(const Array<RHIBuffer*>& buffers) override;
+    virtual void bind_vertex_buffers(ArrayView<RHIBuffer*> buffers) override;
 
     virtual void bind_index_buffer(RHIBuffer* buffer) override;
 
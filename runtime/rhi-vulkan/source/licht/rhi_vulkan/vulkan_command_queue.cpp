@@ -1,5 +1,6 @@
 #include "licht/rhi_vulkan/vulkan_command_queue.hpp"
 #include "licht/core/containers/array.hpp"
+#include "licht/core/containers/inline_array.hpp"
 #include "licht/rhi/swapchain.hpp"
 #include "licht/rhi_vulkan/vulkan_command_buffer.hpp"
 #include "licht/rhi_vulkan/vulkan_context.hpp"
@@ -16,7 +17,7 @@ VulkanCommandQueue::VulkanCommandQueue(VulkanContext& context, VkQueue queue, RH
     : context_(context), queue_(queue), type_(type), queue_family_index_(queue_family_index), is_present_mode_supported_(is_present_mode_supported) {
 }
 
-bool VulkanCommandQueue::is_present_mode() {
+bool VulkanCommandQueue::is_present_mode() const {
     return is_present_mode_supported_;
 }
 
@@ -24,17 +25,17 @@ void VulkanCommandQueue::wait_idle() {
     LICHT_VULKAN_CHECK(VulkanAPI::lvkQueueWaitIdle(queue_));
 }
 
-void VulkanCommandQueue::submit(const Array<RHICommandBuffer*>& command_buffers,
-                                const Array<RHISemaphore*>& wait_semaphores,
-                                const Array<RHISemaphore*>& signal_semaphores,
+void VulkanCommandQueue::submit(ArrayView<RHICommandBuffer*> command_buffers,
+                                ArrayView<RHISemaphore*> wait_semaphores,
+                                ArrayView<RHISemaphore*> signal_semaphores,
                                 const RHIFence* fence) const {
 
     VkSubmitInfo submit_info = {};
     submit_info.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
 
     // Command buffers
-    Array<VkCommandBuffer> vk_command_buffers(command_buffers.size());
-    for (RHICommandBuffer*& cmd : command_buffers) {
+    InlineArray<VkCommandBuffer, 4> vk_command_buffers(command_buffers.size());
+    for (RHICommandBuffer* cmd : command_buffers) {
         VulkanCommandBuffer* vk_cmd_ref = static_cast<VulkanCommandBuffer*>(cmd);
         vk_command_buffers.append(vk_cmd_ref->get_handle());
     }
@@ -43,7 +44,7 @@ void VulkanCommandQueue::submit(const Array<RHICommandBuffer*>& command_buffers,
     submit_info.pCommandBuffers = vk_command_buffers.data();
 
     // Wait semaphores
-    Array<VkSemaphore> wait_vksemaphores(wait_semaphores.size());
+    InlineArray<VkSemaphore, 4> wait_vksemaphores(wait_semaphores.size());
     for (RHISemaphore* sem : wait_semaphores) {
         wait_vksemaphores.append(static_cast<RHIVulkanSemaphore*>(sem)->get_handle());
     }
@@ -52,7 +53,7 @@ void VulkanCommandQueue::submit(const Array<RHICommandBuffer*>& command_buffers,
     submit_info.pWaitSemaphores = wait_vksemaphores.data();
 
     // Signal semaphores
-    Array<VkSemaphore> signal_vksemaphores(signal_semaphores.size());
+    InlineArray<VkSemaphore, 4> signal_vksemaphores(signal_semaphores.size());
     for (RHISemaphore* sem : signal_semaphores) {
         signal_vksemaphores.append(static_cast<RHIVulkanSemaphore*>(sem)->get_handle());
     }
@@ -61,7 +62,7 @@ void VulkanCommandQueue::submit(const Array<RHICommandBuffer*>& command_buffers,
     submit_info.pSignalSemaphores = signal_vksemaphores.data();
 
     // Waiting pipeline stage policy
-    Array<VkPipelineStageFlags> wait_stages(wait_semaphores.size());
+    InlineArray<VkPipelineStageFlags, 4> wait_stages(wait_semaphores.size());
     for (size_t i = 0; i < wait_semaphores.size(); i++) {
         wait_stages.append(VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
     }
@@ -10,9 +10,9 @@ namespace licht {
 
 class VulkanCommandQueue : public RHICommandQueue {
 public:
-    virtual void submit(const Array<RHICommandBuffer*>& command_buffers,
-                        const Array<RHISemaphore*>& wait_semaphores,
-                        const Array<RHISemaphore*>& signal_semaphores,
+    virtual void submit(ArrayView<RHICommandBuffer*> command_buffers,
+                        ArrayView<RHISemaphore*> wait_semaphores,
+                        ArrayView<RHISemaphore*> signal_semaphores,
                         const RHIFence* fence) const override;
 
     virtual void present(RHISwapchain* swapchain, RHIFrameContext& context) const override;
@@ -27,7 +27,7 @@ public:
         return queue_;
     }
 
-    virtual bool is_present_mode() override;
+    virtual bool is_present_mode() const override;
 
     inline uint32 get_queue_family_index() {
         return queue_family_index_;
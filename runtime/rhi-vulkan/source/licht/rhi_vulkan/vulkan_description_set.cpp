@@ -163,10 +163,9 @@ RHIShaderResourceGroup* VulkanShaderResourceGroupPool::allocate_group(RHIShaderR
     descriptor_set_allocation_info.descriptorSetCount = 1;
     descriptor_set_allocation_info.pSetLayouts = &vk_layout_handle;
 
-    size_t group_index;
-    if (!free_groups_.empty()) {
-        group_index = *free_groups_.begin();
-        free_groups_.remove(group_index);
+    size_t group_index = free_groups_.find_first();
+    if (group_index != DynamicBitSet::npos) {
+        free_groups_.reset(group_index);
     } else {
         LCHECK(next_index_to_allocate_ < max_groups_);
         group_index = next_index_to_allocate_++;
@@ -197,7 +196,7 @@ void VulkanShaderResourceGroupPool::deallocate_group(RHIShaderResourceGroup* gro
     VulkanShaderResourceGroup* vk_group = static_cast<VulkanShaderResourceGroup*>(group);
     VkDescriptorSet& descriptor_set = vk_group->get_handle();
 
-    free_groups_.add(vk_group->get_index_pool());
+    free_groups_.set(vk_group->get_index_pool());
 
     LICHT_VULKAN_CHECK(VulkanAPI::lvkFreeDescriptorSets(context.device,
                                                         descriptor_pool_,
@@ -211,16 +210,16 @@ void VulkanShaderResourceGroupPool::dispose() {
     for (size_t i = 0; i < get_count(); i++) {
         deallocate_group(get_group(i));
     }
-    free_groups_.clear();
+    free_groups_.reset_all();
     allocated_groups_.clear();
 }
 
 void VulkanShaderResourceGroupPool::initialize(size_t max_groups, const Array<RHIShaderResourceBinding>& total_bindings) {
     max_groups_ = max_groups;
 
-    // free_groups_ doesn't need to be resize; its size is determined by the number of elements added.
-    // next_index_to_allocate_ is implicitly 0 at start.
+    // A group is only marked free once it has been allocated then deallocated.
     next_index_to_allocate_ = 0;
+    free_groups_.resize(max_groups);
     allocated_groups_.resize(max_groups);
 
     VulkanContext& context = vulkan_context_get();
@@ -1,8 +1,8 @@
 #pragma once
 
 #include "licht/core/containers/array.hpp"
+#include "licht/core/containers/bit_set.hpp"
 #include "licht/core/containers/hash_map.hpp"
-#include "licht/core/containers/hash_set.hpp"
 #include "licht/rhi/shader_resource.hpp"
 
 #include <vulkan/vulkan_core.h>
@@ -105,7 +105,7 @@ public:
     virtual ~VulkanShaderResourceGroupPool() override = default;
 
 private:
-    HashSet<size_t> free_groups_; 
+    DynamicBitSet free_groups_;
     Array<VulkanShaderResourceGroup> allocated_groups_;
     VkDescriptorPool descriptor_pool_ = VK_NULL_HANDLE;
     size_t max_groups_ = 0;
@@ -119,7 +119,7 @@ RHIBufferPoolRef VulkanDevice::create_buffer_pool() {
 RHITexturePoolRef VulkanDevice::create_texture_pool() {
     return SharedRef<VulkanTexturePool>(
         lnew(allocator_, VulkanTexturePool()),
-        create_deleter<RHITexturePool>(allocator_));
+        create_deleter<VulkanTexturePool>(allocator_));
 }
 
 RHITextureView* VulkanDevice::create_texture_view(const RHITextureViewDescription& description) {
@@ -256,7 +256,7 @@ void VulkanDevice::destroy_fence(RHIFence* fence) {
     ldelete(allocator_, vk_fence);
 }
 
-Array<RHICommandQueueRef> VulkanDevice::get_command_queues() {
+const Array<RHICommandQueueRef>& VulkanDevice::get_command_queues() {
     return context_.command_queues;
 }
 
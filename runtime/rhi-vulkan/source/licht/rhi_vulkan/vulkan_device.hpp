@@ -58,7 +58,7 @@ public:
     virtual RHIFence* create_fence() override;
     virtual void destroy_fence(RHIFence* fence) override;
 
-    virtual Array<RHICommandQueueRef> get_command_queues() override;
+    virtual const Array<RHICommandQueueRef>& get_command_queues() override;
 
 public:
     VulkanDevice();
@@ -1,4 +1,5 @@
 #include "licht/rhi_vulkan/vulkan_texture_pool.hpp"
+#include "licht/core/memory/memory_trace.hpp"
 #include "vulkan_texture_pool.hpp"
 
 namespace licht {
@@ -8,6 +9,8 @@ void VulkanTexturePool::initialize_pool(Allocator* allocator, size_t block_count
 }
 
 RHITexture* VulkanTexturePool::create_texture(const RHITextureDescription& description) {
+    MemoryTagScope memory_tag(MemoryTag::RHI);
+
     VulkanTexture* vk_texture = pool_.new_resource();
     vk_texture->initialize(description);
     return vk_texture;
@@ -25,6 +28,8 @@ void VulkanTexturePool::dispose() {
 }
 
 void VulkanTexturePool::destroy_vulkan_texture(VulkanTexture* vulkan_texture) {
+    MemoryTagScope memory_tag(MemoryTag::RHI);
+
     vulkan_texture->destroy();
     pool_.destroy_resource(vulkan_texture);
 }
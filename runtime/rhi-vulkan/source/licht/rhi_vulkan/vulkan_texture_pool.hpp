@@ -29,7 +29,7 @@ private:
     void destroy_vulkan_texture(VulkanTexture* vk_texture);
 
 private:
-    MemoryPool<VulkanTexture> pool_;
+    ConcurrentMemoryPool<VulkanTexture> pool_;
 };
 
 }  //namespace licht
\ No newline at end of file
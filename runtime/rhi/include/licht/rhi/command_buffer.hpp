@@ -1,6 +1,7 @@
 #pragma once
 
 #include "licht/core/containers/array.hpp"
+#include "licht/core/containers/array_view.hpp"
 #include "licht/core/defines.hpp"
 #include "licht/core/math/vector4.hpp"
 #include "licht/rhi/rhi_forwards.hpp"
@@ -109,9 +110,9 @@ public:
 
     /**
      * @brief Bind vertex buffers for rendering.
-     * @param buffers Array of buffer handles to bind.
+     * @param buffers Buffer handles to bind.
      */
-    virtual void bind_vertex_buffers(const Array<RHIBuffer*>& buffers) = 0;
+    virtual void bind_vertex_buffers(ArrayView<RHIBuffer*> buffers) = 0;
 
     virtual void bind_index_buffer(RHIBuffer* buffer) = 0;
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "licht/core/containers/array_view.hpp"
 #include "licht/rhi/command_buffer.hpp"
 #include "licht/rhi/fence.hpp"
 #include "licht/rhi/semaphore.hpp"
@@ -16,9 +17,13 @@ namespace licht {
  */
 class RHICommandQueue {
 public:
-    virtual void submit(const Array<RHICommandBuffer*>& command_buffers,
-                        const Array<RHISemaphore*>& wait_semaphores,
-                        const Array<RHISemaphore*>& signal_semaphores,
+    /**
+     * @brief Submit command buffers to the queue.
+     * The views only need to outlive the call, e.g. arrays of the frame allocator.
+     */
+    virtual void submit(ArrayView<RHICommandBuffer*> command_buffers,
+                        ArrayView<RHISemaphore*> wait_semaphores,
+                        ArrayView<RHISemaphore*> signal_semaphores,
                         const RHIFence* fence) const = 0;
 
     /**
@@ -59,7 +64,7 @@ public:
      * @brief Check if the queue supports the present mode.
      * @return Return true if supported, false otherwise.
      */
-    virtual bool is_present_mode() = 0;
+    virtual bool is_present_mode() const = 0;
 
     /**
      * @brief Destructor.
@@ -59,16 +59,16 @@ public:
     virtual RHIFence* create_fence() = 0;
     virtual void destroy_fence(RHIFence* fence) = 0;
 
-    virtual Array<SharedRef<RHICommandQueue>> get_command_queues() = 0;
+    virtual const Array<SharedRef<RHICommandQueue>>& get_command_queues() = 0;
 
     inline SharedRef<RHICommandQueue> get_graphics_queue() {
-        return *get_command_queues().get_if([](SharedRef<RHICommandQueue> command_queue) -> bool {
+        return *get_command_queues().get_if([](const SharedRef<RHICommandQueue>& command_queue) -> bool {
             return command_queue->is_graphics_type();
         });
     }
 
     inline SharedRef<RHICommandQueue> get_present_queue() {
-        return *get_command_queues().get_if([](SharedRef<RHICommandQueue> command_queue) -> bool {
+        return *get_command_queues().get_if([](const SharedRef<RHICommandQueue>& command_queue) -> bool {
             return command_queue->is_present_mode();
         });
     }
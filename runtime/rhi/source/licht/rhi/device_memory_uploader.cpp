@@ -122,7 +122,7 @@ void RHIDeviceMemoryUploader::upload(const RHICommandQueueRef& queue) {
     // Submit and wait for transfer to complete
     RHIFence* upload_fence = device_->create_fence();
     device_->reset_fence(upload_fence);
-    queue->submit({transfer_cmd}, {}, {}, upload_fence);
+    queue->submit(ArrayView<RHICommandBuffer*>(&transfer_cmd, 1), {}, {}, upload_fence);
 
     device_->wait_fence(upload_fence);
     device_->destroy_fence(upload_fence);
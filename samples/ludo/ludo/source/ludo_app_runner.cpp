@@ -14,6 +14,8 @@
 #include <licht/core/time/delta_timer.hpp>
 #include <licht/core/time/frame_rate_monitor.hpp>
 #include <licht/core/trace/trace.hpp>
+#include <licht/engine/engine.hpp>
+#include <licht/engine/frame_graph.hpp>
 #include <licht/rhi/rhi_module.hpp>
 #include <licht/scene/camera.hpp>
 
@@ -113,24 +115,49 @@ void LudoAppRunner::on_run_delegate() {
     // Unlimited by default, can switch by pressing F1.
     bool limited_frame_rate = false;
 
-    // Main loop.
-    while (g_is_app_running) {
-        float64 delta_time = timer.tick();
+    // Per-frame work runs as systems of the engine frame graph, ordered by the resources they read and write.
+    FrameGraph& frame_graph = Engine::get_instance().get_loop().get_frame_graph();
 
-        // Frame rate limiting.
-        if (limited_frame_rate) {
-            delta_time = timer.limit(delta_time, TargetFrameRate);
-        }
-
-        // Handle window and platform events.
+    // Handle window and platform events, the mouse callback moves the camera.
+    FrameSystemDescription input_system;
+    input_system.name = Name("ludo.input");
+    input_system.thread = FrameSystemThread::Main;
+    input_system.writes = {Name("input"), Name("camera")};
+    input_system.function = [&display](const FrameContext&) -> void {
         display.handle_events();
-
-        // Update the camera, must be call once per frame.
-        camera_on_tick(camera, delta_time);
-
-        // Tick the render frame script with a delta time.
-        render_frame_script.on_tick(delta_time);
-
+    };
+    frame_graph.add_system(std::move(input_system));
+
+    // Update the camera, must be call once per frame.
+    FrameSystemDescription camera_system;
+    camera_system.name = Name("ludo.camera");
+    camera_system.reads = {Name("input")};
+    camera_system.writes = {Name("camera")};
+    camera_system.function = [this, &camera](const FrameContext& context) -> void {
+        camera_on_tick(camera, context.delta_time);
+    };
+    frame_graph.add_system(std::move(camera_system));
+
+    // Tick the render frame script with a delta time.
+    FrameSystemDescription render_system;
+    render_system.name = Name("ludo.render");
+    render_system.stage = FrameStage::Render;
+    render_system.thread = FrameSystemThread::Main;
+    render_system.reads = {Name("camera")};
+    render_system.function = [&render_frame_script](const FrameContext& context) -> void {
+        render_frame_script.on_tick(context.delta_time);
+    };
+    frame_graph.add_system(std::move(render_system));
+
+    // Key shortcuts run after the frame is rendered, as in the loop before the frame graph:
+    // writing the camera the render system reads orders them after it.
+    FrameSystemDescription controls_system;
+    controls_system.name = Name("ludo.controls");
+    controls_system.stage = FrameStage::Render;
+    controls_system.thread = FrameSystemThread::Main;
+    controls_system.reads = {Name("input")};
+    controls_system.writes = {Name("camera")};
+    controls_system.function = [&camera, &limited_frame_rate](const FrameContext&) -> void {
         // Restart the initial camera state.
         if (Input::key_is_pressed(VirtualKey::C)) {
             camera = initial_camera;
@@ -150,8 +177,29 @@ void LudoAppRunner::on_run_delegate() {
         if (Input::key_is_pressed(VirtualKey::Escape)) {
             ludo_stop_app();
         }
+    };
+    frame_graph.add_system(std::move(controls_system));
+
+    // Main loop.
+    while (g_is_app_running) {
+        float64 delta_time = timer.tick();
+
+        // Frame rate limiting.
+        if (limited_frame_rate) {
+            delta_time = timer.limit(delta_time, TargetFrameRate);
+        }
+
+        // Resume the coroutines waiting for this frame, then run the frame graph.
+        Engine::get_instance().get_loop().tick(delta_time);
     }
 
+    // The systems capture the locals of this run, they go before a restart registers them again.
+    Engine::get_instance().get_loop().flush();
+    frame_graph.remove_system(Name("ludo.input"));
+    frame_graph.remove_system(Name("ludo.camera"));
+    frame_graph.remove_system(Name("ludo.controls"));
+    frame_graph.remove_system(Name("ludo.render"));
+
     // Do not forget to stop it.
     render_frame_script.on_shutdown();
     // TODO: Need to be done by a manager
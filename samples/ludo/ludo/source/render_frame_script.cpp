@@ -106,7 +106,7 @@ void RenderFrameScript::on_startup() {
         for (StaticSubMesh& submesh : mesh.get_submeshes()) {
             DrawItem item = DrawItem::create(device_, uploader, submesh);
             item.model_constant.model = Matrix4f::scale(item.model_constant.model, Vector3f(0.005f));
-            packet_.items.append(item);
+            packet_.items.append(std::move(item));
         }
     }
 